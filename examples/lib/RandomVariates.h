@@ -7,38 +7,150 @@
 #ifndef RANDOMVARIATES_H_
 #define RANDOMVARIATES_H_
 
+#include <largenet2/sim/random/AliasTable.h>
+#include <largenet2/sim/random/distributions.h>
 #include <cmath>
 #include <cassert>
+#include <cstddef>
 
 namespace myrng
 {
 
+namespace detail
+{
+
+/**
+ * Layer tables of a 256-layer ziggurat for a monotonically decreasing density
+ * @p f on [0, infinity) (G. Marsaglia and W. W. Tsang, "The Ziggurat Method
+ * for Generating Random Variables", J. Stat. Softw. 5, 8 (2000)).
+ *
+ * Layer i covers the densities between f(x[i]) and f(x[i+1]) and has width
+ * x[i]; all layers have the same area. Layer 0 is the base strip, including
+ * the tail beyond x[1] = r.
+ */
+struct ZigguratTable
+{
+	enum
+	{
+		Layers = 256
+	};
+	double x[Layers + 1];
+	double f[Layers + 1];
+
+	/**
+	 * @param r start of the tail
+	 * @param v area of each layer
+	 * @param density the (unnormalized) density
+	 * @param inverse its inverse
+	 */
+	ZigguratTable(double r, double v, double(*density)(double),
+			double(*inverse)(double))
+	{
+		x[0] = v / density(r);
+		x[1] = r;
+		for (int i = 1; i < Layers - 1; ++i)
+			x[i + 1] = inverse(v / x[i] + density(x[i]));
+		x[Layers] = 0;
+		for (int i = 0; i <= Layers; ++i)
+			f[i] = density(x[i]);
+	}
+};
+
+inline double expDensity(double x)
+{
+	return std::exp(-x);
+}
+inline double expInverse(double y)
+{
+	return -std::log(y);
+}
+inline double normalDensity(double x)
+{
+	return std::exp(-0.5 * x * x);
+}
+inline double normalInverse(double y)
+{
+	return std::sqrt(-2.0 * std::log(y));
+}
+
+inline const ZigguratTable& exponentialZiggurat()
+{
+	static const ZigguratTable t(7.69711747013104972, 3.949659822581572e-3,
+			expDensity, expInverse);
+	return t;
+}
+
+inline const ZigguratTable& normalZiggurat()
+{
+	static const ZigguratTable t(3.6541528853610088, 4.92867323399e-3,
+			normalDensity, normalInverse);
+	return t;
+}
+
+}
+
 /**
  * Random variates generation.
  *
  * Generates random variates according to different distributions
  * using the supplied random number generator @p Engine.
  *
+ * Uniform variates are generated in blocks of BufferSize numbers by the
+ * engine's fill() method and handed out from a buffer, so that the engine
+ * runs in a tight loop. Exponential()
+ * and Normal01() use the ziggurat method, which needs two uniform variates
+ * and no logarithm for more than 98% of all draws. After changing
+ * the state of the engine by other means than seed() (e.g., selecting
+ * another stream of a counter-based engine), call resetBuffer() to discard
+ * the buffered numbers.
+ *
  * @author Gerd Zschaler <gzschaler@googlemail.com>
  */
 template<class Engine>
 class RandomVariates: public Engine
 {
 public:
+	/// Number of uniform variates generated at once
+	static const std::size_t BufferSize = 256;
+
 	/**
 	 * Constructor
 	 */
-	RandomVariates() {}
+	RandomVariates() :
+		next_(BufferSize), polar_hasvariate(false), polar_variate(0)
+	{
+	}
 
 	/**
 	 *  Seed the random number generator engine.
 	 *
-	 *  This is an alias for Engine::seed()
+	 *  This is an alias for seed()
 	 *  @param s New seed
 	 */
 	void Seed(unsigned long int s)
+	{
+		seed(s);
+	}
+
+	/**
+	 * Seed the random number generator engine and discard buffered
+	 * variates.
+	 * @param s New seed
+	 */
+	void seed(unsigned long int s)
 	{
 		Engine::seed(s);
+		resetBuffer();
+	}
+
+	/**
+	 * Discard buffered variates, so that the next variate is generated from
+	 * the current state of the engine.
+	 */
+	void resetBuffer()
+	{
+		next_ = BufferSize;
+		polar_hasvariate = false;
 	}
 
 	/**
@@ -55,7 +167,31 @@ public:
 	 */
 	double Uniform01()
 	{
-		return (*this)();
+		if (next_ == BufferSize)
+			refill();
+		return buffer_[next_++];
+	}
+
+	/**
+	 * Fill @p out with @p n uniformly distributed random numbers in (0,1).
+	 *
+	 * The result is the same as that of @p n calls to Uniform01().
+	 */
+	void Uniform01(double* out, std::size_t n)
+	{
+		while (n > 0)
+		{
+			if (next_ == BufferSize)
+				refill();
+			std::size_t k = BufferSize - next_;
+			if (k > n)
+				k = n;
+			for (std::size_t i = 0; i < k; ++i)
+				out[i] = buffer_[next_ + i];
+			next_ += k;
+			out += k;
+			n -= k;
+		}
 	}
 
 	/**
@@ -170,6 +306,56 @@ public:
 		return (ret - 1);
 	}
 
+	/**
+	 * Choose between table.size() choices using a precomputed alias table.
+	 *
+	 * Takes O(1) time, independent of the number of choices, and should be
+	 * preferred to Choices() when sampling repeatedly from the same
+	 * distribution.\n
+	 * Example:
+	 * \code
+	 * std::vector<double> weights(3, 0.2);
+	 * weights[2] = 0.6;
+	 * sim::random::AliasTable table(weights);
+	 * std::size_t result = rng.Choice(table);
+	 * \endcode
+	 * \return An integer value between 0 and table.size()-1
+	 */
+	std::size_t Choice(const sim::random::AliasTable& table)
+	{
+		return table.sample(*this);
+	}
+
+	/**
+	 * Poisson distribution.
+	 *
+	 * Uses inversion for small means and the transformed rejection method
+	 * PTRS otherwise, see sim::random::poisson().
+	 * \param mean has to be non-negative.
+	 * \return A Poisson distributed random number with mean @p mean.
+	 */
+	unsigned long Poisson(double mean)
+	{
+		assert(mean >= 0);
+		return sim::random::poisson(*this, mean);
+	}
+
+	/**
+	 * Binomial distribution.
+	 *
+	 * Uses inversion for small expected numbers of successes and the
+	 * transformed rejection method BTRD otherwise, see
+	 * sim::random::binomial().
+	 * \param n number of trials
+	 * \param p success probability in [0,1]
+	 * \return The number of successes in @p n trials.
+	 */
+	unsigned long Binomial(unsigned long n, double p)
+	{
+		assert(p >= 0 && p <= 1);
+		return sim::random::binomial(*this, n, p);
+	}
+
 	/**
 	 * Normal(0,1) distribution with polar method.
 	 *
@@ -210,6 +396,45 @@ public:
 		}
 	}
 
+	/**
+	 * Normal(0,1) distribution with the ziggurat method.
+	 *
+	 * Faster than Normal01Polar(), since it usually needs two uniform
+	 * variates and no transcendental function.
+	 * \return A gaussian distributed random number \f$ u\sim N(0,1) \f$.
+	 */
+	double Normal01()
+	{
+		const detail::ZigguratTable& t = detail::normalZiggurat();
+		while (true)
+		{
+			// the layer and the sign from one variate and the position from
+			// another, as a 32 bit variate has too few bits for both
+			const int j = static_cast<int> (2 * detail::ZigguratTable::Layers
+					* Uniform01());
+			const int i = j % detail::ZigguratTable::Layers;
+			const double sign = j < detail::ZigguratTable::Layers ? 1.0 : -1.0;
+			const double z = Uniform01() * t.x[i];
+			if (z < t.x[i + 1])
+				return sign * z;
+			if (i == 0)
+			{
+				// tail beyond r
+				const double r = t.x[1];
+				double x, y;
+				do
+				{
+					x = -std::log(positiveUniform01()) / r;
+					y = -std::log(positiveUniform01());
+				} while (2 * y < x * x);
+				return sign * (r + x);
+			}
+			if (t.f[i] + Uniform01() * (t.f[i + 1] - t.f[i])
+					< detail::normalDensity(z))
+				return sign * z;
+		}
+	}
+
 	/**
 	 * Gaussian distribution with polar method.
 	 *
@@ -235,9 +460,8 @@ public:
 	/**
 	 * Exponential distribution.
 	 *
-	 * Uses the logarithm method:
-	 * Let \f$ U \sim U(0,1)\f$. Then \f$ T=-mean \cdot \ln{U} \f$
-	 * is exponentially distributed.\n
+	 * Uses the ziggurat method, which avoids the logarithm of the inversion
+	 * method \f$ T=-mean \cdot \ln{U} \f$ for more than 98% of all draws.\n
 	 * Example:
 	 * \code
 	 * // the time it takes before your next telephone call (in minutes)
@@ -254,8 +478,33 @@ public:
 	double Exponential(double mean)
 	{
 		assert(mean > 0);
-		double U = Uniform01();
-		return -mean * log(U);
+		const detail::ZigguratTable& t = detail::exponentialZiggurat();
+		while (true)
+		{
+			// the layer and the position within the layer from separate
+			// variates
+			const int i = static_cast<int> (detail::ZigguratTable::Layers
+					* Uniform01());
+			const double z = Uniform01() * t.x[i];
+			if (z < t.x[i + 1])
+				return mean * z;
+			if (i == 0)
+				// the tail beyond r is again exponential
+				return mean * (t.x[1] - std::log(positiveUniform01()));
+			if (t.f[i] + Uniform01() * (t.f[i + 1] - t.f[i])
+					< detail::expDensity(z))
+				return mean * z;
+		}
+	}
+
+	/**
+	 * Fill @p out with @p n exponentially distributed random numbers with
+	 * mean @p mean.
+	 */
+	void Exponential(double mean, double* out, std::size_t n)
+	{
+		for (std::size_t i = 0; i < n; ++i)
+			out[i] = Exponential(mean);
 	}
 
 	/**
@@ -316,6 +565,25 @@ public:
 	}
 
 private:
+	/// Uniform01(), excluding the 0 that a 32 bit engine can return
+	double positiveUniform01()
+	{
+		double u;
+		do
+			u = Uniform01();
+		while (u <= 0);
+		return u;
+	}
+
+	void refill()
+	{
+		Engine::fill(buffer_, BufferSize);
+		next_ = 0;
+	}
+
+	double buffer_[BufferSize]; // buffered uniform variates
+	std::size_t next_; // index of the next buffered variate
+
 	// Polar Method variables
 	bool polar_hasvariate; // A random number is still stored
 	double polar_variate; // The random number
@@ -7,6 +7,8 @@
  * @file WELLEngine.h
  */
 
+#include <cstddef>
+
 namespace myrng
 {
 
@@ -46,13 +48,66 @@ protected:
 	~WELLEngine() {}
 	/// Produce a random number.
 	double operator()();
+	/// Produce @p n random numbers, the same as @p n calls to operator()().
+	void fill(double* out, std::size_t n);
 
 private:
 	unsigned long int seed_; ///< the initial seed
 
-	unsigned int z0, z1, z2, state_i;
+	unsigned int state_i;
 	unsigned int STATE[32];
 };
 
+inline double WELLEngine::operator()()
+{
+	/**
+	 * This generator is an Implementation of WELL1024a
+	 * (F. Panneton, P. L'Ecuyer, and M. Matsumoto,
+	 * "Improved Long-Period Generators Based on Linear Recurrences Modulo 2",
+	 * ACM Transactions on Mathematical Software, 32, 1 (2006), 1-16.)
+	 */
+	const unsigned int z0 = STATE[(state_i + 31) & 0x0000001fU];
+	const unsigned int z1 = (STATE[state_i]) ^ STATE[(state_i + 3) & 0x0000001fU];
+	const unsigned int z2 = (STATE[(state_i + 24) & 0x0000001fU]
+			^ (STATE[(state_i + 24) & 0x0000001fU] << (19)))
+			^ (STATE[(state_i + 10) & 0x0000001fU]
+					^ (STATE[(state_i + 10) & 0x0000001fU] << (14)));
+
+	STATE[state_i] = z1 ^ z2;
+	STATE[(state_i + 31) & 0x0000001fU] = (z0 ^ (z0 << (11)))
+			^ (z1 ^ (z1 << (7))) ^ (z2 ^ (z2 << (13)));
+
+	state_i = (state_i + 31) & 0x0000001fUL;
+	return ((double) STATE[state_i] * 2.32830643653869628906e-10);
+}
+
+inline void WELLEngine::fill(double* out, const std::size_t n)
+{
+	// The recurrence only allows three outputs in flight, so the gain comes
+	// from keeping the index in a register and leaving the conversion to
+	// double to a separate, vectorisable loop.
+	unsigned int raw[64];
+	unsigned int i = state_i;
+	for (std::size_t done = 0; done < n; done += 64)
+	{
+		const std::size_t m = n - done < 64 ? n - done : 64;
+		for (std::size_t k = 0; k < m; ++k)
+		{
+			const unsigned int z0 = STATE[(i + 31) & 0x1fU];
+			const unsigned int z1 = STATE[i] ^ STATE[(i + 3) & 0x1fU];
+			const unsigned int a = STATE[(i + 24) & 0x1fU], b = STATE[(i + 10)
+					& 0x1fU];
+			const unsigned int z2 = (a ^ (a << 19)) ^ (b ^ (b << 14));
+			STATE[i] = z1 ^ z2;
+			i = (i + 31) & 0x1fU;
+			raw[k] = STATE[i] = (z0 ^ (z0 << 11)) ^ (z1 ^ (z1 << 7)) ^ (z2
+					^ (z2 << 13));
+		}
+		for (std::size_t k = 0; k < m; ++k)
+			out[done + k] = raw[k] * 2.32830643653869628906e-10;
+	}
+	state_i = i;
+}
+
 } /* namespace myrng */
 #endif /* WELLENGINE_H_ */
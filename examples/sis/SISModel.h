@@ -2,8 +2,8 @@
 #define SISMODEL_H_
 
 #include <largenet2.h>
-#include <largenet2/sim/gillespie/DirectMethod.h>
-#include <boost/bind.hpp>
+#include <largenet2/sim/gillespie/StaticDirectMethod.h>
+#include <boost/tuple/tuple.hpp>
 #include "../lib/util.h"
 
 /**
@@ -78,31 +78,21 @@ public:
 
 	/**
 	 * Constructor
+	 *
+	 * The different processes are handed to the Gillespie stepper.
+	 * Each process object provides a rate() method which computes
+	 * the instantaneous reaction rate for the process and an operator()
+	 * which performs the action of the process. As the process set is
+	 * fixed at compile time, the stepper can inline these calls.
+	 *
 	 * @param net Graph instance to use for the simulation
 	 * @param p SIS model parameters
 	 * @param rng Random number generator to use for the simulation
 	 */
 	SISModel(largenet::Graph& net, Params p, RandomGen& rng) :
-	net_(net), par_(p), rng_(rng)
-	{
-		// Register the different processes with the Gillespie stepper.
-		// Each process is registered with a rate function which computes
-		// the instantaneous reaction rate for the process and an "action"
-		// function which performs the action of the process. Note how
-		// the convenient use of boost::bind allows to use SISModel member
-		// functions for this.
-		stepper.registerProcess(
-				boost::bind(&self_type::infectionRate, this),
-				boost::bind(&self_type::infect, this)
-				);
-		stepper.registerProcess(
-				boost::bind(&self_type::recoveryRate, this),
-				boost::bind(&self_type::recover, this)
-				);
-		stepper.registerProcess(
-				boost::bind(&self_type::rewiringRate, this),
-				boost::bind(&self_type::rewire, this)
-				);
+	net_(net), par_(p), stepper(boost::make_tuple(Infection(*this),
+			Recovery(*this), Rewiring(*this))), rng_(rng)
+	{
 	}
 
 	/**
@@ -128,6 +118,40 @@ public:
 	}
 
 private:
+	/// Infection process along S-I-links
+	class Infection
+	{
+	public:
+		explicit Infection(self_type& m) : m_(m) {}
+		double rate() const { return m_.infectionRate(); }
+		void operator()() { m_.infect(); }
+	private:
+		self_type& m_;
+	};
+	/// Recovery process of I-nodes
+	class Recovery
+	{
+	public:
+		explicit Recovery(self_type& m) : m_(m) {}
+		double rate() const { return m_.recoveryRate(); }
+		void operator()() { m_.recover(); }
+	private:
+		self_type& m_;
+	};
+	/// Rewiring process of S-I-links
+	class Rewiring
+	{
+	public:
+		explicit Rewiring(self_type& m) : m_(m) {}
+		double rate() const { return m_.rewiringRate(); }
+		void operator()() { m_.rewire(); }
+	private:
+		self_type& m_;
+	};
+	friend class Infection;
+	friend class Recovery;
+	friend class Rewiring;
+
 	double infectionRate() const
 	{
 		return net_.numberOfEdges(SI) * par_.p;
@@ -197,7 +221,7 @@ private:
 private:
 	largenet::Graph& net_;
 	Params par_;
-	sim::gillespie::DirectMethod stepper;
+	sim::gillespie::StaticDirectMethod<Infection, Recovery, Rewiring> stepper;
 	RandomGen& rng_;
 };
 
@@ -0,0 +1,102 @@
+/**
+ * @example sis-ensemble.cpp
+ * @section sis_ensemble_example SIS model ensemble example
+ *
+ * This runs many independent realizations of the adaptive SIS model from the
+ * @ref sis_example in parallel using sim::ensemble::EnsembleRunner. Each
+ * replica owns its network, model, and random number generator. The time
+ * series of all replicas are averaged in memory on a common time grid, and
+ * only the ensemble mean and variance are written to standard output.
+ *
+ * The replicas use the counter-based sim::random::PhiloxEngine, so that the
+ * seeds handed out by the runner select independent random streams.
+ *
+ * Usage: sis-ensemble [replicas [threads [seed]]]
+ */
+
+#include "SISModel.h"
+#include "../lib/RandomVariates.h"
+#include <largenet2.h>
+#include <largenet2/StateConsistencyListener.h>
+#include <largenet2/generators/generators.h>
+#include <largenet2/sim/ensemble/EnsembleRunner.h>
+#include <largenet2/sim/random/PhiloxEngine.h>
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+
+using namespace std;
+using namespace largenet;
+
+typedef myrng::RandomVariates<sim::random::PhiloxEngine> rng_t;
+typedef SISModel<rng_t> model_t;
+
+/**
+ * One realization of the SIS model
+ */
+class SISReplica: public sim::ensemble::Replica
+{
+public:
+	SISReplica(unsigned int N, unsigned int L, double initial_infected,
+			model_t::Params params, unsigned long seed) :
+			net_(model_t::node_states, model_t::link_states), scl_(
+					auto_ptr<model_t::EdgeStateCalculator>(
+							new model_t::EdgeStateCalculator))
+	{
+		rng_.seed(seed);
+		net_.addGraphListener(&scl_);
+		generators::randomGnm(net_, N, L, rng_, false);
+		Graph::NodeIteratorRange nodes = net_.nodes();
+		for (Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+			net_.setNodeState(n->id(),
+					rng_.Chance(initial_infected) ? model_t::I : model_t::S);
+		model_.reset(new model_t(net_, params, rng_));
+	}
+
+private:
+	double doStep()
+	{
+		return model_->step(rng_);
+	}
+	bool doStopped() const
+	{
+		return net_.numberOfNodes(model_t::I) == 0;
+	}
+	void doObserve(std::vector<double>& values) const
+	{
+		values[0] = net_.numberOfNodes(model_t::I);
+		values[1] = net_.numberOfEdges(model_t::SI);
+	}
+
+	Graph net_;
+	StateConsistencyListener<model_t::EdgeStateCalculator> scl_;
+	rng_t rng_;
+	auto_ptr<model_t> model_;
+};
+
+sim::ensemble::Replica* makeReplica(unsigned int, unsigned long seed)
+{
+	const model_t::Params params =
+	{ 0.006, 0.002, 0.2 };
+	return new SISReplica(10000, 100000, 0.2, params, seed);
+}
+
+int main(int argc, char **argv)
+{
+	const unsigned int replicas = argc > 1 ? atoi(argv[1]) : 16;
+	const double tmax = 1000; // maximum simulation time
+	const double interval = 1; // time grid spacing
+
+	// two observables: infected nodes and S-I links
+	sim::ensemble::EnsembleRunner runner(makeReplica, 2, tmax, interval);
+	if (argc > 2)
+		runner.setThreads(atoi(argv[2]));
+	if (argc > 3)
+		runner.setSeed(atol(argv[3]));
+
+	runner.run(replicas);
+
+	// (time - samples - mean I - var I - mean SI - var SI)
+	runner.statistics().write(std::cout);
+	return 0;
+}
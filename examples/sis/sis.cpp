@@ -18,6 +18,10 @@
  * unstable. Additionally, the rewiring activity (non-zero @p w) allows for a bistable regime
  * where both states coexist, and the final outcome depends on the initial conditions.
  *
+ * The simulation runs until @p tmax. If a relative precision is given as the first
+ * command line argument, e.g. @c 0.01, it ends as soon as the stationary means of all
+ * node and link counts are known to that precision, and reports them to std::cerr.
+ *
  * @author Gerd Zschaler <gzschaler@googlemail.com>
  */
 
@@ -27,8 +31,11 @@
 #include <largenet2.h>
 #include <largenet2/StateConsistencyListener.h>
 #include <largenet2/generators/generators.h>
+#include <largenet2/sim/output/Outputter.h>
+#include <largenet2/sim/output/SteadyStateDetector.h>
 #include <iostream>
 #include <memory>
+#include <cstdlib>
 
 using namespace std;
 using namespace largenet;
@@ -59,6 +66,10 @@ int main(int argc, char **argv)
 
 	const double tmax = 1000; // maximum simulation time
 
+	// relative precision of the steady-state means for ending the run
+	// early, 0 to always run until tmax
+	const double precision = argc > 1 ? atof(argv[1]) : 0;
+
 	// Create a Graph object with SISModel::node_states possible node
 	// states and SISModel::link_states possible link states
 	Graph net(model_t::node_states, model_t::link_states);
@@ -109,13 +120,28 @@ int main(int argc, char **argv)
 	// (time - S-nodes - I-nodes - S-S-links - S-I-links - I-I-links)
 	std::cout << "# t\tS\tI\tSS\tSI\tII\n";
 
+	// If requested, detect the steady state of all node and link counts,
+	// reporting to std::cerr, so that the run can end as soon as the
+	// stationary means are known to the given precision
+	sim::output::Outputter steadyState;
+	if (precision > 0)
+	{
+		sim::output::SteadyStateDetector* ssd =
+				new sim::output::SteadyStateDetector(std::cerr, net, 1.0);
+		ssd->setPrecision(precision);
+		steadyState.addOutput(ssd);
+	}
+	steadyState.writeHeaders();
+
 	// Simulation loop
-	// Perform model steps until simulation time exceeds maximum or the model
-	// has stopped (no further changes possible)
+	// Perform model steps until simulation time exceeds maximum, the model
+	// has stopped (no further changes possible), or a requested steady state
+	// has been reached
 	double t = 0, next = 0;
 	double interval = 1; // output interval
-	while ((t <= tmax) && (!model.stopped()))
+	while ((t <= tmax) && (!model.stopped()) && (!steadyState.stopRequested()))
 	{
+		steadyState.output(t);
 		// only write output at specified intervals
 		if (t >= next)
 		{
@@ -10,6 +10,7 @@
 #include <largenet2.h>
 #include <largenet2/base/GraphListener.h>
 #include <memory>
+#include <vector>
 
 namespace largenet {
 
@@ -71,7 +72,25 @@ private:
 			g.setEdgeState((*it)->id(), (*lsc_)(g.nodeState((*it)->source()->id()),
 					g.nodeState((*it)->target()->id())));
 	}
+	virtual void afterNodeStatesRebuildEvent(largenet::Graph& g,
+			const std::vector<largenet::node_state_t>& oldStates)
+	{
+		// recompute all edge states at once instead of per changed node
+		g.nodeStates(nodeStates_);
+		g.edgeStates(edgeStates_);
+		largenet::Graph::EdgeIteratorRange edges = g.edges();
+		for (largenet::Graph::EdgeIterator it = edges.first; it != edges.second; ++it)
+			edgeStates_[it.id()] = (*lsc_)(nodeStates_[it->source()->id()],
+					nodeStates_[it->target()->id()]);
+		g.setEdgeStates(edgeStates_);
+	}
+	virtual void afterEdgeStatesRebuildEvent(largenet::Graph& g,
+			const std::vector<largenet::edge_state_t>& oldStates)
+	{
+	}
 	std::auto_ptr<EdgeStateCalculator> lsc_;
+	std::vector<largenet::node_state_t> nodeStates_;
+	std::vector<largenet::edge_state_t> edgeStates_;
 };
 }
 #endif /* STATECONSISTENCYLISTENER_H_ */
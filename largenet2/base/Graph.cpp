@@ -42,6 +42,36 @@ void Graph::setEdgeState(const edge_id_t e, const edge_state_t s)
 	afterEdgeStateChange(e, old, s);
 }
 
+void Graph::setNodeStates(const std::vector<node_state_t>& states)
+{
+	if (numberOfNodes() > 0 && states.size() <= maxNodeID())
+		throw std::invalid_argument("Too few node states.");
+	if (listeners_.empty())
+	{
+		nodes_.setCategories(states);
+		return;
+	}
+	std::vector<node_state_t> old;
+	nodeStates(old);
+	nodes_.setCategories(states);
+	afterNodeStatesRebuild(old);
+}
+
+void Graph::setEdgeStates(const std::vector<edge_state_t>& states)
+{
+	if (numberOfEdges() > 0 && states.size() <= maxEdgeID())
+		throw std::invalid_argument("Too few edge states.");
+	if (listeners_.empty())
+	{
+		edges_.setCategories(states);
+		return;
+	}
+	std::vector<edge_state_t> old;
+	edgeStates(old);
+	edges_.setCategories(states);
+	afterEdgeStatesRebuild(old);
+}
+
 node_id_t Graph::addNode()
 {
 	return addNode(0);
@@ -84,13 +114,23 @@ void Graph::removeNode(const node_id_t n)
 {
 	assert(nodes_.valid(n));
 	beforeNodeRemove(n);
-	// remove adjacent edges
-	Node::edge_iterator_range iters = node(n)->outEdges();
+	// remove adjacent edges; collect their IDs first, since removing an edge
+	// unregisters it from the node's edge sets
+	std::vector<edge_id_t> adjacent;
+	const Node* v = node(n);
+	Node::edge_iterator_range iters = v->outEdges();
 	for (Node::edge_iterator it = iters.first; it != iters.second; ++it)
-		removeEdge((*it)->id());
-	iters = node(n)->inEdges();
+		adjacent.push_back((*it)->id());
+	iters = v->inEdges();
 	for (Node::edge_iterator it = iters.first; it != iters.second; ++it)
-		removeEdge((*it)->id());
+		if (!(*it)->isLoop())
+			adjacent.push_back((*it)->id());
+	iters = v->undirectedEdges();
+	for (Node::edge_iterator it = iters.first; it != iters.second; ++it)
+		adjacent.push_back((*it)->id());
+	for (std::vector<edge_id_t>::const_iterator e = adjacent.begin(); e
+			!= adjacent.end(); ++e)
+		removeEdge(*e);
 	nodes_.erase(n);
 }
 
@@ -222,4 +262,18 @@ void Graph::afterEdgeStateChange(const edge_id_t e,
 		(*i)->afterEdgeStateChange(*this, *edge(e), oldState, newState);
 }
 
+void Graph::afterNodeStatesRebuild(const std::vector<node_state_t>& oldStates)
+{
+	for (ListenerContainer::iterator i = listeners_.begin(); i
+			!= listeners_.end(); ++i)
+		(*i)->afterNodeStatesRebuild(*this, oldStates);
+}
+
+void Graph::afterEdgeStatesRebuild(const std::vector<edge_state_t>& oldStates)
+{
+	for (ListenerContainer::iterator i = listeners_.begin(); i
+			!= listeners_.end(); ++i)
+		(*i)->afterEdgeStatesRebuild(*this, oldStates);
+}
+
 }
@@ -7,6 +7,7 @@
 #include <largenet2/base/repo/CPtrRepository.h>
 #include <boost/noncopyable.hpp>
 #include <list>
+#include <vector>
 #include <utility>
 #include <memory>
 #include <stdexcept>
@@ -116,6 +117,14 @@ public:
 	 * Get number of edges in state @p s
 	 */
 	edge_size_t numberOfEdges(edge_state_t s) const;
+	/**
+	 * Get the largest valid node ID (0 if there are no nodes)
+	 */
+	node_id_t maxNodeID() const;
+	/**
+	 * Get the largest valid edge ID (0 if there are no edges)
+	 */
+	edge_id_t maxEdgeID() const;
 	/**
 	 * Get number of possible node states
 	 */
@@ -289,6 +298,36 @@ public:
 	 * @param s new edge state
 	 */
 	void setEdgeState(edge_id_t e, edge_state_t s);
+	/**
+	 * Set the states of all nodes at once.
+	 *
+	 * This rebuilds the node state bookkeeping in one pass and is much faster
+	 * than calling setNodeState() for every node when many nodes change
+	 * their state, e.g. in synchronous updates. Graph listeners are notified
+	 * by a single GraphListener::afterNodeStatesRebuild() event.
+	 * @param states new node states indexed by node ID, with more than
+	 * maxNodeID() elements
+	 */
+	void setNodeStates(const std::vector<node_state_t>& states);
+	/**
+	 * Set the states of all edges at once.
+	 * @see setNodeStates()
+	 * @param states new edge states indexed by edge ID, with more than
+	 * maxEdgeID() elements
+	 */
+	void setEdgeStates(const std::vector<edge_state_t>& states);
+	/**
+	 * Get the states of all nodes.
+	 * @param states vector to store the node states in, indexed by node ID.
+	 * It is enlarged to maxNodeID() + 1 elements if necessary.
+	 */
+	void nodeStates(std::vector<node_state_t>& states) const;
+	/**
+	 * Get the states of all edges.
+	 * @param states vector to store the edge states in, indexed by edge ID.
+	 * It is enlarged to maxEdgeID() + 1 elements if necessary.
+	 */
+	void edgeStates(std::vector<edge_state_t>& states) const;
 	/**
 	 * Get node state of node @p n
 	 * @param n node ID
@@ -360,6 +399,8 @@ private:
 			node_state_t newState);
 	void afterEdgeStateChange(edge_id_t e, edge_state_t oldState,
 			edge_state_t newState);
+	void afterNodeStatesRebuild(const std::vector<node_state_t>& oldStates);
+	void afterEdgeStatesRebuild(const std::vector<edge_state_t>& oldStates);
 
 	std::auto_ptr<ElementFactory> elf_;
 	NodeContainer nodes_;
@@ -397,6 +438,26 @@ inline edge_state_size_t Graph::numberOfEdgeStates() const
 	return edges_.numberOfCategories();
 }
 
+inline node_id_t Graph::maxNodeID() const
+{
+	return nodes_.maxID();
+}
+
+inline edge_id_t Graph::maxEdgeID() const
+{
+	return edges_.maxID();
+}
+
+inline void Graph::nodeStates(std::vector<node_state_t>& states) const
+{
+	nodes_.categories(states);
+}
+
+inline void Graph::edgeStates(std::vector<edge_state_t>& states) const
+{
+	edges_.categories(states);
+}
+
 inline Node* Graph::node(const node_id_t n)
 {
 	if (nodes_.valid(n))
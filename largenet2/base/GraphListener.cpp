@@ -0,0 +1,36 @@
+/**
+ * @file GraphListener.cpp
+ * @date 18.10.2026
+ */
+
+#include "GraphListener.h"
+#include <largenet2/base/Graph.h>
+
+namespace largenet
+{
+
+void GraphListener::afterNodeStatesRebuildEvent(Graph& g,
+		const std::vector<node_state_t>& oldStates)
+{
+	Graph::NodeIteratorRange nodes = g.nodes();
+	for (Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+	{
+		const node_state_t s = g.nodeState(n.id());
+		if (oldStates[n.id()] != s)
+			afterNodeStateChangeEvent(g, *n, oldStates[n.id()], s);
+	}
+}
+
+void GraphListener::afterEdgeStatesRebuildEvent(Graph& g,
+		const std::vector<edge_state_t>& oldStates)
+{
+	Graph::EdgeIteratorRange edges = g.edges();
+	for (Graph::EdgeIterator e = edges.first; e != edges.second; ++e)
+	{
+		const edge_state_t s = g.edgeState(e.id());
+		if (oldStates[e.id()] != s)
+			afterEdgeStateChangeEvent(g, *e, oldStates[e.id()], s);
+	}
+}
+
+}
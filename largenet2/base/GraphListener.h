@@ -2,6 +2,7 @@
 #define GRAPHLISTENER_H_
 
 #include <largenet2/base/types.h>
+#include <vector>
 
 namespace largenet
 {
@@ -32,6 +33,26 @@ public:
 	{
 		afterEdgeStateChangeEvent(g, e, oldState, newState);
 	}
+	/**
+	 * Called after all node states have been set at once by
+	 * Graph::setNodeStates(). Unless overridden, this generates an
+	 * afterNodeStateChange event for each node that changed its state.
+	 * @param oldStates previous node states indexed by node ID
+	 */
+	void afterNodeStatesRebuild(Graph& g, const std::vector<node_state_t>& oldStates)
+	{
+		afterNodeStatesRebuildEvent(g, oldStates);
+	}
+	/**
+	 * Called after all edge states have been set at once by
+	 * Graph::setEdgeStates(). Unless overridden, this generates an
+	 * afterEdgeStateChange event for each edge that changed its state.
+	 * @param oldStates previous edge states indexed by edge ID
+	 */
+	void afterEdgeStatesRebuild(Graph& g, const std::vector<edge_state_t>& oldStates)
+	{
+		afterEdgeStatesRebuildEvent(g, oldStates);
+	}
 
 private:
 	// these are not pure virtual, to ease implementing only a few methods
@@ -42,6 +63,8 @@ private:
 	virtual void beforeGraphClearEvent(Graph& g) {}
 	virtual void afterNodeStateChangeEvent(Graph& g, Node& n, node_state_t oldState, node_state_t newState) {}
 	virtual void afterEdgeStateChangeEvent(Graph& g, Edge& e, edge_state_t oldState, edge_state_t newState) {}
+	virtual void afterNodeStatesRebuildEvent(Graph& g, const std::vector<node_state_t>& oldStates);
+	virtual void afterEdgeStatesRebuildEvent(Graph& g, const std::vector<edge_state_t>& oldStates);
 };
 
 }
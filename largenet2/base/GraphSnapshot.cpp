@@ -0,0 +1,73 @@
+/**
+ * @file GraphSnapshot.cpp
+ * @date 18.10.2026
+ */
+
+#include "GraphSnapshot.h"
+#include <largenet2/base/Graph.h>
+#include <stdexcept>
+
+namespace largenet
+{
+
+GraphSnapshot::GraphSnapshot() :
+	nodes_(0), topology_(false)
+{
+}
+
+GraphSnapshot::GraphSnapshot(const Graph& g, const bool topology) :
+	nodes_(0), topology_(false)
+{
+	capture(g, topology);
+}
+
+void GraphSnapshot::capture(const Graph& g, const bool topology)
+{
+	g.nodeStates(nodeStates_);
+	nodes_ = g.numberOfNodes();
+	counts_.resize(g.numberOfNodeStates());
+	for (node_state_t s = 0; s < counts_.size(); ++s)
+		counts_[s] = g.numberOfNodes(s);
+	topology_ = topology;
+	edges_.clear();
+	if (!topology)
+		return;
+	edges_.reserve(g.numberOfEdges());
+	Graph::ConstEdgeIteratorRange edges = g.edges();
+	for (Graph::ConstEdgeIterator e = edges.first; e != edges.second; ++e)
+	{
+		const EdgeRecord r = { e->source()->id(), e->target()->id(),
+				g.edgeState(e.id()), e->isDirected() };
+		edges_.push_back(r);
+	}
+}
+
+void GraphSnapshot::restore(Graph& g) const
+{
+	if (g.numberOfNodes() != nodes_ || (nodes_ > 0 && g.maxNodeID() + 1
+			!= nodeStates_.size()))
+		throw std::invalid_argument("Snapshot does not match graph.");
+	if (!topology_)
+	{
+		g.setNodeStates(nodeStates_);
+		return;
+	}
+	// remove the edges first so that no edge state updates are triggered
+	// by the node state rebuild
+	std::vector<edge_id_t> ids;
+	ids.reserve(g.numberOfEdges());
+	Graph::EdgeIteratorRange edges = g.edges();
+	for (Graph::EdgeIterator e = edges.first; e != edges.second; ++e)
+		ids.push_back(e.id());
+	for (std::vector<edge_id_t>::const_iterator e = ids.begin(); e != ids.end(); ++e)
+		g.removeEdge(*e);
+	g.setNodeStates(nodeStates_);
+	for (std::vector<EdgeRecord>::const_iterator r = edges_.begin(); r
+			!= edges_.end(); ++r)
+	{
+		const edge_id_t e = g.addEdge(r->source, r->target, r->directed);
+		g.setEdgeState(e, r->state);
+	}
+}
+
+}
@@ -0,0 +1,84 @@
+/**
+ * @file GraphSnapshot.h
+ * @date 18.10.2026
+ */
+
+#ifndef GRAPHSNAPSHOT_H_
+#define GRAPHSNAPSHOT_H_
+
+#include <largenet2/base/types.h>
+#include <vector>
+
+namespace largenet
+{
+
+class Graph;
+
+/**
+ * A copy of the node states, and optionally the edges, of a Graph, which can
+ * be written back into the same Graph later.
+ *
+ * Restoring node states uses Graph::setNodeStates(), i.e. a single in-place
+ * rebuild of the state categories. If the topology has been captured as well,
+ * all edges of the graph are replaced by the captured ones, which then carry
+ * new edge IDs. The node set itself is not part of the snapshot and must not
+ * have changed in between.
+ */
+class GraphSnapshot
+{
+public:
+	GraphSnapshot();
+	/**
+	 * Capture the current state of @p g.
+	 * @param g graph
+	 * @param topology whether to capture the edges as well
+	 */
+	explicit GraphSnapshot(const Graph& g, bool topology = false);
+	/**
+	 * Capture the current state of @p g, replacing the stored one.
+	 * @param g graph
+	 * @param topology whether to capture the edges as well
+	 */
+	void capture(const Graph& g, bool topology = false);
+	/**
+	 * Write the stored state back into @p g.
+	 * @throw std::invalid_argument if the node set of @p g does not match
+	 */
+	void restore(Graph& g) const;
+
+	bool empty() const
+	{
+		return nodeStates_.empty();
+	}
+	bool hasTopology() const
+	{
+		return topology_;
+	}
+	/// number of nodes in state @p s
+	node_size_t numberOfNodes(node_state_t s) const
+	{
+		return s < counts_.size() ? counts_[s] : 0;
+	}
+	/// stored node states, indexed by node ID
+	const std::vector<node_state_t>& nodeStates() const
+	{
+		return nodeStates_;
+	}
+
+private:
+	struct EdgeRecord
+	{
+		node_id_t source, target;
+		edge_state_t state;
+		bool directed;
+	};
+	std::vector<node_state_t> nodeStates_;
+	std::vector<node_size_t> counts_;
+	std::vector<EdgeRecord> edges_;
+	node_size_t nodes_;
+	bool topology_;
+};
+
+}
+
+#endif /* GRAPHSNAPSHOT_H_ */
@@ -171,6 +171,24 @@ public:
 	 */
 	void setCategory(id_t id, category_t cat);
 
+	/**
+	 * Set the categories of all items at once.
+	 *
+	 * The category order is rebuilt by a single counting sort, which is much
+	 * faster than calling setCategory() for a large fraction of the items.
+	 * Within each category, items keep their relative order.
+	 * @param cats New categories indexed by item ID. Must have more than
+	 * maxID() elements; entries for invalid IDs are ignored.
+	 */
+	void setCategories(const std::vector<category_t>& cats);
+	/**
+	 * Get the categories of all items.
+	 * @param cats Vector to store the categories in, indexed by item ID. It is
+	 * resized to maxID() + 1 if necessary; entries for invalid IDs are left
+	 * unchanged.
+	 */
+	void categories(std::vector<category_t>& cats) const;
+
 	/**
 	 * Return item with @p id.
 	 * @param id Unique ID of item
@@ -719,6 +737,47 @@ inline void CPtrRepository<T, CloneAllocator, Allocator>::setCategory(
 	setCategory(num, newCat);
 }
 
+template<class T, class CloneAllocator, class Allocator>
+void CPtrRepository<T, CloneAllocator, Allocator>::setCategories(
+		const std::vector<category_t>& cats)
+{
+	assert(nStored_ == 0 || cats.size() > maxID_);
+	std::vector<address_t> pos(C_ + 1, 0);
+	for (address_t n = 0; n < nStored_; ++n)
+	{
+		assert(cats[ids_[n]] < C_);
+		++pos[cats[ids_[n]] + 1];
+	}
+	for (category_t c = 0; c < C_; ++c)
+	{
+		count_[c] = pos[c + 1];
+		pos[c + 1] += pos[c];
+		offset_[c] = pos[c];
+	}
+	std::vector<id_t> sorted(nStored_);
+	for (address_t n = 0; n < nStored_; ++n)
+		sorted[pos[cats[ids_[n]]]++] = ids_[n];
+	for (address_t n = 0; n < nStored_; ++n)
+	{
+		ids_[n] = sorted[n];
+		nums_[sorted[n]] = n;
+	}
+}
+
+template<class T, class CloneAllocator, class Allocator>
+void CPtrRepository<T, CloneAllocator, Allocator>::categories(
+		std::vector<category_t>& cats) const
+{
+	if (cats.size() <= maxID_)
+		cats.resize(maxID_ + 1, 0);
+	for (category_t c = 0; c < C_; ++c)
+	{
+		const address_t end = offset_[c] + count_[c];
+		for (address_t n = offset_[c]; n < end; ++n)
+			cats[ids_[n]] = c;
+	}
+}
+
 template<class T, class CloneAllocator, class Allocator>
 inline typename CPtrRepository<T, CloneAllocator, Allocator>::reference CPtrRepository<
 		T, CloneAllocator, Allocator>::item(const id_t id)
@@ -0,0 +1,218 @@
+/**
+ * @file mapped_graph_boost.h
+ * Boost Graph Library (BGL) concepts to use read-only io::MappedGraph views
+ * in BGL algorithms
+ * @date 18.10.2026
+ */
+
+#ifndef MAPPED_GRAPH_BOOST_H_
+#define MAPPED_GRAPH_BOOST_H_
+
+#include <largenet2/io/MappedGraph.h>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/cstdint.hpp>
+#include <limits>
+#include <utility>
+
+namespace largenet
+{
+namespace detail
+{
+/// BGL edge descriptor of a MappedGraph: its end points
+struct mapped_edge_t
+{
+	mapped_edge_t() :
+		source(0), target(0)
+	{
+	}
+	mapped_edge_t(node_id_t s, node_id_t t) :
+		source(s), target(t)
+	{
+	}
+	node_id_t source, target;
+};
+
+inline bool operator==(const mapped_edge_t& a, const mapped_edge_t& b)
+{
+	return a.source == b.source && a.target == b.target;
+}
+
+inline bool operator!=(const mapped_edge_t& a, const mapped_edge_t& b)
+{
+	return !(a == b);
+}
+
+struct mapped_out_edge
+{
+	typedef mapped_edge_t result_type;
+	mapped_out_edge() :
+		u(0)
+	{
+	}
+	explicit mapped_out_edge(node_id_t n) :
+		u(n)
+	{
+	}
+	mapped_edge_t operator()(boost::uint32_t v) const
+	{
+		return mapped_edge_t(u, v);
+	}
+	node_id_t u;
+};
+
+struct mapped_in_edge
+{
+	typedef mapped_edge_t result_type;
+	mapped_in_edge() :
+		u(0)
+	{
+	}
+	explicit mapped_in_edge(node_id_t n) :
+		u(n)
+	{
+	}
+	mapped_edge_t operator()(boost::uint32_t v) const
+	{
+		return mapped_edge_t(v, u);
+	}
+	node_id_t u;
+};
+
+struct mapped_vertex
+{
+	typedef node_id_t result_type;
+	node_id_t operator()(boost::uint32_t v) const
+	{
+		return v;
+	}
+};
+
+typedef boost::transform_iterator<mapped_out_edge,
+		io::MappedGraph::NeighborIterator> mapped_out_edge_iterator_t;
+typedef boost::transform_iterator<mapped_in_edge,
+		io::MappedGraph::NeighborIterator> mapped_in_edge_iterator_t;
+typedef boost::transform_iterator<mapped_vertex,
+		io::MappedGraph::NeighborIterator> mapped_adjacency_iterator_t;
+}
+}
+
+namespace boost
+{
+struct mapped_graph_traversal_category: public virtual bidirectional_graph_tag,
+		public virtual vertex_list_graph_tag,
+		public virtual adjacency_graph_tag
+{
+};
+
+/**
+ * Undirected edges appear as out- and in-edges in both directions, so that
+ * algorithms see the same reachability as on the original Graph.
+ */
+template<>
+struct graph_traits<largenet::io::MappedGraph>
+{
+	typedef largenet::node_id_t vertex_descriptor;
+	typedef largenet::detail::mapped_edge_t edge_descriptor;
+
+	typedef largenet::detail::mapped_out_edge_iterator_t out_edge_iterator;
+	typedef largenet::detail::mapped_in_edge_iterator_t in_edge_iterator;
+	typedef largenet::detail::mapped_adjacency_iterator_t adjacency_iterator;
+	typedef largenet::io::MappedGraph::NodeIterator vertex_iterator;
+
+	typedef mapped_graph_traversal_category traversal_category;
+	typedef directed_tag directed_category;
+	typedef disallow_parallel_edge_tag edge_parallel_category;
+
+	typedef largenet::node_size_t vertices_size_type;
+	typedef largenet::edge_size_t edges_size_type;
+	typedef largenet::degree_size_t degree_size_type;
+
+	static vertex_descriptor null_vertex()
+	{
+		return std::numeric_limits<vertex_descriptor>::max();
+	}
+};
+}
+
+namespace largenet
+{
+namespace io
+{
+// VertexListGraph concept
+
+inline std::pair<MappedGraph::NodeIterator, MappedGraph::NodeIterator> vertices(
+		const MappedGraph& g)
+{
+	return g.nodes();
+}
+
+inline node_size_t num_vertices(const MappedGraph& g)
+{
+	return g.numberOfNodes();
+}
+
+// IncidenceGraph concept
+
+inline node_id_t source(const detail::mapped_edge_t& e, const MappedGraph&)
+{
+	return e.source;
+}
+
+inline node_id_t target(const detail::mapped_edge_t& e, const MappedGraph&)
+{
+	return e.target;
+}
+
+inline std::pair<detail::mapped_out_edge_iterator_t,
+		detail::mapped_out_edge_iterator_t> out_edges(node_id_t u,
+		const MappedGraph& g)
+{
+	typedef detail::mapped_out_edge_iterator_t ei_t;
+	const MappedGraph::NeighborIteratorRange r = g.successors(u);
+	const detail::mapped_out_edge f(u);
+	return std::make_pair(ei_t(r.first, f), ei_t(r.second, f));
+}
+
+inline degree_size_t out_degree(node_id_t u, const MappedGraph& g)
+{
+	return g.outDegree(u) + g.undirectedDegree(u);
+}
+
+// BidirectionalGraph concept
+
+inline std::pair<detail::mapped_in_edge_iterator_t,
+		detail::mapped_in_edge_iterator_t> in_edges(node_id_t u,
+		const MappedGraph& g)
+{
+	typedef detail::mapped_in_edge_iterator_t ei_t;
+	const MappedGraph::NeighborIteratorRange r = g.predecessors(u);
+	const detail::mapped_in_edge f(u);
+	return std::make_pair(ei_t(r.first, f), ei_t(r.second, f));
+}
+
+inline degree_size_t in_degree(node_id_t u, const MappedGraph& g)
+{
+	return g.inDegree(u) + g.undirectedDegree(u);
+}
+
+inline degree_size_t degree(node_id_t u, const MappedGraph& g)
+{
+	return in_degree(u, g) + out_degree(u, g);
+}
+
+// AdjacencyGraph concept
+
+inline std::pair<detail::mapped_adjacency_iterator_t,
+		detail::mapped_adjacency_iterator_t> adjacent_vertices(node_id_t u,
+		const MappedGraph& g)
+{
+	typedef detail::mapped_adjacency_iterator_t ai_t;
+	const MappedGraph::NeighborIteratorRange r = g.successors(u);
+	return std::make_pair(ai_t(r.first), ai_t(r.second));
+}
+
+}
+}
+
+#endif /* MAPPED_GRAPH_BOOST_H_ */
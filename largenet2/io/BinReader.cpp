@@ -6,8 +6,10 @@
 
 #include "BinReader.h"
 #include <largenet2.h>
-#include <map>
-#include <utility>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <stdexcept>
 
 using namespace std;
 
@@ -16,7 +18,17 @@ namespace largenet
 namespace io
 {
 
-Graph* largenet::io::BinReader::createFromStream(std::istream& strm)
+Graph* BinReader::createFromStream(std::istream& strm)
+{
+	return read(strm, 0);
+}
+
+Graph* BinReader::createFromStream(std::istream& strm, Graph& graphToFill)
+{
+	return read(strm, &graphToFill);
+}
+
+Graph* BinReader::read(std::istream& strm, Graph* graphToFill)
 {
 	streambuf* buf = strm.rdbuf();
 	node_size_t N = 0;
@@ -28,20 +40,32 @@ Graph* largenet::io::BinReader::createFromStream(std::istream& strm)
 	buf->sgetn((char*) (&node_states), sizeof(node_states));
 	buf->sgetn((char*) (&edge_states), sizeof(edge_states));
 
-	Graph* graph = new Graph(node_states, edge_states);
+	auto_ptr<Graph> created;
+	Graph* graph = graphToFill;
+	if (graph == 0)
+	{
+		created.reset(new Graph(node_states, edge_states));
+		graph = created.get();
+	}
+	else if (node_states > graph->numberOfNodeStates() || edge_states
+			> graph->numberOfEdgeStates())
+		throw runtime_error("Binary graph has more states than the graph.");
+	graph->clear();
 
-	typedef pair<node_id_t, node_state_t> node_info_t;
-	typedef map<node_id_t, node_info_t> node_map_t;
-	node_map_t node_map;
-	node_info_t item(0, 0);
+	// file node IDs are mostly dense, so a vector is the cheapest map
+	const node_id_t unmapped = numeric_limits<node_id_t>::max();
+	vector<node_id_t> node_map;
+	node_map.reserve(N);
 	node_id_t nid = 0;
+	node_state_t nst = 0;
 	for (node_size_t i = 0; i < N; ++i)
 	{
-		item.second = 0;
+		nst = 0;
 		buf->sgetn((char*)(&nid), sizeof(nid));
-		buf->sgetn((char*)(&item.second), sizeof(item.second));
-		item.first = graph->addNode(item.second);
-		node_map.insert(make_pair(nid, item));
+		buf->sgetn((char*)(&nst), sizeof(nst));
+		if (nid >= node_map.size())
+			node_map.resize(nid + 1, unmapped);
+		node_map[nid] = graph->addNode(nst);
 	}
 	node_id_t sid = 0, tid = 0;
 	edge_state_t est = 0;
@@ -51,17 +75,15 @@ Graph* largenet::io::BinReader::createFromStream(std::istream& strm)
 		buf->sgetn((char*)(&sid), sizeof(sid));
 		buf->sgetn((char*)(&tid), sizeof(tid));
 		buf->sgetn((char*)(&est), sizeof(est));
-		eid = graph->addEdge(node_map[sid].first, node_map[tid].first, true);
+		if (sid >= node_map.size() || tid >= node_map.size()
+				|| node_map[sid] == unmapped || node_map[tid] == unmapped)
+			throw runtime_error("Invalid edge in binary graph.");
+		eid = graph->addEdge(node_map[sid], node_map[tid], true);
 		graph->setEdgeState(eid, est);
 	}
+	created.release();
 	return graph;
 }
 
-Graph* largenet::io::BinReader::createFromStream(std::istream& strm,
-		Graph& graphToFill)
-{
-	throw("Not yet implemented.");
-}
-
 } /* namespace io */
 } /* namespace largenet */
@@ -37,6 +37,9 @@ public:
 	 * @return pointer to @p graphToFill
 	 */
 	Graph* createFromStream(std::istream& strm, Graph& graphToFill);
+
+private:
+	Graph* read(std::istream& strm, Graph* graphToFill);
 };
 
 } /* namespace io */
@@ -0,0 +1,97 @@
+/**
+ * @file BlockBinFormat.h
+ * @date 18.10.2026
+ */
+
+#ifndef BLOCKBINFORMAT_H_
+#define BLOCKBINFORMAT_H_
+
+#include <boost/cstdint.hpp>
+#include <boost/crc.hpp>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Layout of the block binary graph format written by BlockBinWriter and read
+ * by BlockBinReader.
+ *
+ * All numbers are stored in the byte order of the writing machine, which is
+ * recorded in the header; readers on machines of the other byte order swap
+ * them. The file starts with a fixed-size header
+ * @verbatim
+ magic "LNBG", u16 byte order mark 0x0102, u8 version, u8 ID width (4 or 8),
+ u8 directedness, u8 flags, u16 reserved, u32 block size,
+ u32 node states, u32 edge states, u32 reserved,
+ u64 nodes, u64 edges, u64 largest node ID, [u32 header CRC]
+ @endverbatim
+ * followed by the node blocks and then the edge blocks. Each block holds up
+ * to <em>block size</em> elements, stored as whole arrays:
+ * node IDs, then node states (u32) for node blocks;
+ * source IDs, target IDs, edge states (u32) and, for mixed directedness, one
+ * byte per edge that is nonzero for directed edges, for edge blocks. If the
+ * checksum flag is set, the header and every block are followed by their
+ * CRC-32.
+ */
+namespace blockbin
+{
+
+const char magic[4] = { 'L', 'N', 'B', 'G' };
+const boost::uint16_t byteOrderMark = 0x0102;
+const boost::uint8_t version = 1;
+
+/// edge directedness recorded in the header
+enum Directedness
+{
+	UNDIRECTED = 0, DIRECTED = 1, MIXED = 2
+};
+
+/// header flags
+enum Flags
+{
+	CHECKSUM = 1
+};
+
+/// size of the header without its checksum
+const std::size_t headerSize = 52;
+
+inline boost::uint32_t crc(const char* p, const std::size_t n)
+{
+	boost::crc_32_type c;
+	c.process_bytes(p, n);
+	return c.checksum();
+}
+
+/// Append the bytes of @p v to @p buf.
+template<class T>
+inline void put(std::vector<char>& buf, const T v)
+{
+	const char* p = reinterpret_cast<const char*> (&v);
+	buf.insert(buf.end(), p, p + sizeof(T));
+}
+
+/// Read a @p T at @p p, reversing its bytes if @p swap is set, and advance @p p.
+template<class T>
+inline T get(const char*& p, const bool swap)
+{
+	T v;
+	char* q = reinterpret_cast<char*> (&v);
+	std::memcpy(q, p, sizeof(T));
+	if (swap)
+		std::reverse(q, q + sizeof(T));
+	p += sizeof(T);
+	return v;
+}
+
+}
+
+}
+}
+
+#endif /* BLOCKBINFORMAT_H_ */
@@ -0,0 +1,195 @@
+/**
+ * @file BlockBinReader.cpp
+ * @date 18.10.2026
+ */
+
+#include "BlockBinReader.h"
+#include "BlockBinFormat.h"
+#include <largenet2/base/Graph.h>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+
+namespace
+{
+
+using namespace blockbin;
+
+const node_id_t unmapped = numeric_limits<node_id_t>::max();
+
+/// Read @p n bytes into @p block and verify their checksum.
+void readBlock(streambuf* buf, vector<char>& block, const size_t n,
+		const bool checksum, const bool swap)
+{
+	block.resize(n);
+	const streamsize want = static_cast<streamsize> (n);
+	if (n > 0 && buf->sgetn(&block[0], want) != want)
+		throw runtime_error("Block binary graph data are truncated.");
+	if (checksum)
+	{
+		char raw[sizeof(boost::uint32_t)];
+		if (buf->sgetn(raw, sizeof(raw)) != sizeof(raw))
+			throw runtime_error("Block binary graph data are truncated.");
+		const char* p = raw;
+		if (get<boost::uint32_t> (p, swap) != crc(n > 0 ? &block[0] : 0, n))
+			throw runtime_error("Block binary graph checksum mismatch.");
+	}
+}
+
+/// Decode @p n IDs of @p width bytes at @p p into @p ids.
+void getIDs(const char*& p, const size_t n, const unsigned int width,
+		const bool swap, vector<node_id_t>& ids)
+{
+	ids.resize(n);
+	if (width == sizeof(boost::uint32_t))
+		for (size_t i = 0; i < n; ++i)
+			ids[i] = get<boost::uint32_t> (p, swap);
+	else
+		for (size_t i = 0; i < n; ++i)
+		{
+			const boost::uint64_t v = get<boost::uint64_t> (p, swap);
+			if (v > numeric_limits<node_id_t>::max())
+				throw runtime_error("Node ID too large for this platform.");
+			ids[i] = static_cast<node_id_t> (v);
+		}
+}
+
+void getStates(const char*& p, const size_t n, const bool swap,
+		vector<boost::uint32_t>& states)
+{
+	states.resize(n);
+	if (n == 0)
+		return;
+	memcpy(&states[0], p, n * sizeof(boost::uint32_t));
+	p += n * sizeof(boost::uint32_t);
+	if (swap)
+		for (size_t i = 0; i < n; ++i)
+		{
+			char* q = reinterpret_cast<char*> (&states[i]);
+			reverse(q, q + sizeof(boost::uint32_t));
+		}
+}
+
+}
+
+Graph* BlockBinReader::createFromStream(istream& strm)
+{
+	return read(strm, 0);
+}
+
+Graph* BlockBinReader::createFromStream(istream& strm, Graph& graphToFill)
+{
+	return read(strm, &graphToFill);
+}
+
+Graph* BlockBinReader::read(istream& strm, Graph* graphToFill)
+{
+	streambuf* buf = strm.rdbuf();
+	vector<char> block(headerSize);
+	if (buf->sgetn(&block[0], headerSize) != static_cast<streamsize> (headerSize)
+			|| !equal(magic, magic + sizeof(magic), block.begin()))
+		throw runtime_error("Not a block binary graph file.");
+	const char* p = &block[0] + sizeof(magic);
+	const boost::uint16_t bom = get<boost::uint16_t> (p, false);
+	if (bom != byteOrderMark && bom != 0x0201)
+		throw runtime_error("Invalid byte order mark in block binary graph.");
+	const bool swap = bom != byteOrderMark;
+	if (get<boost::uint8_t> (p, swap) > version)
+		throw runtime_error("Unsupported block binary graph version.");
+	const unsigned int width = get<boost::uint8_t> (p, swap);
+	const unsigned int dir = get<boost::uint8_t> (p, swap);
+	const bool checksum = (get<boost::uint8_t> (p, swap) & CHECKSUM) != 0;
+	get<boost::uint16_t> (p, swap);
+	const size_t blockSize = get<boost::uint32_t> (p, swap);
+	const node_state_size_t nodeStates = get<boost::uint32_t> (p, swap);
+	const edge_state_size_t edgeStates = get<boost::uint32_t> (p, swap);
+	get<boost::uint32_t> (p, swap);
+	const boost::uint64_t N = get<boost::uint64_t> (p, swap);
+	const boost::uint64_t L = get<boost::uint64_t> (p, swap);
+	const boost::uint64_t maxID = get<boost::uint64_t> (p, swap);
+	if ((width != 4 && width != 8) || dir > MIXED || blockSize == 0
+			|| (N > 0 && maxID < N - 1) || maxID >= numeric_limits<
+			size_t>::max())
+		throw runtime_error("Invalid block binary graph header.");
+	if (checksum)
+	{
+		char raw[sizeof(boost::uint32_t)];
+		if (buf->sgetn(raw, sizeof(raw)) != sizeof(raw))
+			throw runtime_error("Block binary graph data are truncated.");
+		const char* q = raw;
+		if (get<boost::uint32_t> (q, swap) != crc(&block[0], headerSize))
+			throw runtime_error("Block binary graph checksum mismatch.");
+	}
+
+	auto_ptr<Graph> created;
+	Graph* g = graphToFill;
+	if (g == 0)
+	{
+		created.reset(new Graph(nodeStates, edgeStates));
+		g = created.get();
+	}
+	else if (nodeStates > g->numberOfNodeStates() || edgeStates
+			> g->numberOfEdgeStates())
+		throw runtime_error("Block binary graph has more states than the graph.");
+	g->clear();
+
+	vector<node_id_t> remap(N > 0 ? maxID + 1 : 0, unmapped);
+	vector<node_id_t> ids, targets;
+	vector<boost::uint32_t> states;
+	for (boost::uint64_t done = 0; done < N;)
+	{
+		const size_t n = static_cast<size_t> (min<boost::uint64_t> (blockSize,
+				N - done));
+		readBlock(buf, block, n * (width + sizeof(boost::uint32_t)), checksum,
+				swap);
+		p = &block[0];
+		getIDs(p, n, width, swap, ids);
+		getStates(p, n, swap, states);
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (ids[i] >= remap.size() || remap[ids[i]] != unmapped
+					|| states[i] >= nodeStates)
+				throw runtime_error("Invalid node in block binary graph.");
+			remap[ids[i]] = g->addNode(states[i]);
+		}
+		done += n;
+	}
+
+	for (boost::uint64_t done = 0; done < L;)
+	{
+		const size_t n = static_cast<size_t> (min<boost::uint64_t> (blockSize,
+				L - done));
+		readBlock(buf, block, n * (2 * width + sizeof(boost::uint32_t)
+				+ (dir == MIXED ? 1 : 0)), checksum, swap);
+		p = &block[0];
+		getIDs(p, n, width, swap, ids);
+		getIDs(p, n, width, swap, targets);
+		getStates(p, n, swap, states);
+		for (size_t i = 0; i < n; ++i)
+		{
+			if (ids[i] >= remap.size() || targets[i] >= remap.size()
+					|| remap[ids[i]] == unmapped || remap[targets[i]]
+					== unmapped || states[i] >= edgeStates)
+				throw runtime_error("Invalid edge in block binary graph.");
+			const bool directed = dir == MIXED ? p[i] != 0 : dir == DIRECTED;
+			const edge_id_t e = g->addEdge(remap[ids[i]], remap[targets[i]],
+					directed);
+			if (states[i] != 0)
+				g->setEdgeState(e, states[i]);
+		}
+		done += n;
+	}
+	created.release();
+	return g;
+}
+
+} /* namespace io */
+} /* namespace largenet */
@@ -0,0 +1,52 @@
+/**
+ * @file BlockBinReader.h
+ * @date 18.10.2026
+ */
+
+#ifndef BLOCKBINREADER_H_
+#define BLOCKBINREADER_H_
+
+#include <largenet2/io/GraphReader.h>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Read graphs in the block binary format written by BlockBinWriter.
+ *
+ * Each block is read with a single stream read and its checksum, if present,
+ * is verified. Node IDs in the file are mapped to the IDs of the new nodes
+ * through a vector indexed by the file ID. Files written on machines of the
+ * other byte order are converted. Malformed, truncated or corrupted data
+ * cause std::runtime_error.
+ */
+class BlockBinReader: public GraphReader
+{
+public:
+	BlockBinReader() {}
+	virtual ~BlockBinReader() {}
+	/**
+	 * Create a new Graph object from stream
+	 * @param strm Stream to read graph data from
+	 * @return pointer to new graph object
+	 */
+	Graph* createFromStream(std::istream& strm);
+	/**
+	 * Create a graph from stream data, using an existing Graph object
+	 * @param strm Stream to read data from
+	 * @param[out] graphToFill Graph object to hold the new graph, will be
+	 * cleared before filling and must have at least as many node and edge
+	 * states as the stored graph
+	 * @return pointer to @p graphToFill
+	 */
+	Graph* createFromStream(std::istream& strm, Graph& graphToFill);
+
+private:
+	Graph* read(std::istream& strm, Graph* graphToFill);
+};
+
+} /* namespace io */
+} /* namespace largenet */
+#endif /* BLOCKBINREADER_H_ */
@@ -0,0 +1,166 @@
+/**
+ * @file BlockBinWriter.cpp
+ * @date 18.10.2026
+ */
+
+#include "BlockBinWriter.h"
+#include "BlockBinFormat.h"
+#include <largenet2/base/Graph.h>
+#include <boost/foreach.hpp>
+#include <vector>
+#include <stdexcept>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+
+namespace
+{
+
+using namespace blockbin;
+
+void writeBlock(streambuf* buf, const vector<char>& block, const bool checksum)
+{
+	const streamsize n = static_cast<streamsize> (block.size());
+	bool ok = block.empty() || buf->sputn(&block[0], n) == n;
+	if (ok && checksum)
+	{
+		const boost::uint32_t c = crc(block.empty() ? 0 : &block[0],
+				block.size());
+		ok = buf->sputn(reinterpret_cast<const char*> (&c), sizeof(c))
+				== sizeof(c);
+	}
+	if (!ok)
+		throw runtime_error("Cannot write block binary graph data.");
+}
+
+/// Append @p ids to @p block, @p width bytes each.
+void putIDs(vector<char>& block, const vector<node_id_t>& ids,
+		const unsigned int width)
+{
+	const size_t start = block.size();
+	block.resize(start + ids.size() * width);
+	char* p = &block[start];
+	if (width == sizeof(boost::uint32_t))
+	{
+		for (size_t i = 0; i < ids.size(); ++i, p += width)
+		{
+			const boost::uint32_t v = static_cast<boost::uint32_t> (ids[i]);
+			memcpy(p, &v, width);
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < ids.size(); ++i, p += width)
+		{
+			const boost::uint64_t v = ids[i];
+			memcpy(p, &v, width);
+		}
+	}
+}
+
+void putStates(vector<char>& block, const vector<boost::uint32_t>& states)
+{
+	if (states.empty())
+		return;
+	const char* p = reinterpret_cast<const char*> (&states[0]);
+	block.insert(block.end(), p, p + states.size() * sizeof(states[0]));
+}
+
+}
+
+BlockBinWriter::BlockBinWriter(const bool checksum,
+		const unsigned int blockSize) :
+	checksum_(checksum), blockSize_(blockSize)
+{
+	if (blockSize_ == 0)
+		throw invalid_argument("Block size must be positive.");
+}
+
+void BlockBinWriter::write(const Graph& g, ostream& strm)
+{
+	streambuf* buf = strm.rdbuf();
+	bool anyDirected = false, anyUndirected = false;
+	BOOST_FOREACH(const Edge& e, g.edges())
+	{
+		if (e.isDirected())
+			anyDirected = true;
+		else
+			anyUndirected = true;
+		if (anyDirected && anyUndirected)
+			break;
+	}
+	const Directedness dir = anyDirected ? (anyUndirected ? MIXED : DIRECTED)
+			: UNDIRECTED;
+	const boost::uint64_t maxID = g.numberOfNodes() > 0 ? g.maxNodeID() : 0;
+	const unsigned int width = maxID > 0xffffffffUL ? 8 : 4;
+
+	vector<char> block;
+	block.insert(block.end(), magic, magic + sizeof(magic));
+	put(block, byteOrderMark);
+	put(block, version);
+	put(block, static_cast<boost::uint8_t> (width));
+	put(block, static_cast<boost::uint8_t> (dir));
+	put(block, static_cast<boost::uint8_t> (checksum_ ? CHECKSUM : 0));
+	put(block, boost::uint16_t(0));
+	put(block, static_cast<boost::uint32_t> (blockSize_));
+	put(block, static_cast<boost::uint32_t> (g.numberOfNodeStates()));
+	put(block, static_cast<boost::uint32_t> (g.numberOfEdgeStates()));
+	put(block, boost::uint32_t(0));
+	put(block, static_cast<boost::uint64_t> (g.numberOfNodes()));
+	put(block, static_cast<boost::uint64_t> (g.numberOfEdges()));
+	put(block, maxID);
+	writeBlock(buf, block, checksum_);
+
+	vector<node_id_t> ids, targets;
+	vector<boost::uint32_t> states;
+	vector<char> directed;
+	ids.reserve(blockSize_);
+	states.reserve(blockSize_);
+
+	Graph::ConstNodeIteratorRange nodes = g.nodes();
+	for (Graph::ConstNodeIterator n = nodes.first; n != nodes.second;)
+	{
+		ids.clear();
+		states.clear();
+		for (; n != nodes.second && ids.size() < blockSize_; ++n)
+		{
+			ids.push_back(n.id());
+			states.push_back(g.nodeState(n.id()));
+		}
+		block.clear();
+		putIDs(block, ids, width);
+		putStates(block, states);
+		writeBlock(buf, block, checksum_);
+	}
+
+	targets.reserve(blockSize_);
+	Graph::ConstEdgeIteratorRange edges = g.edges();
+	for (Graph::ConstEdgeIterator e = edges.first; e != edges.second;)
+	{
+		ids.clear();
+		targets.clear();
+		states.clear();
+		directed.clear();
+		for (; e != edges.second && ids.size() < blockSize_; ++e)
+		{
+			ids.push_back(e->source()->id());
+			targets.push_back(e->target()->id());
+			states.push_back(g.edgeState(e.id()));
+			directed.push_back(e->isDirected() ? 1 : 0);
+		}
+		block.clear();
+		putIDs(block, ids, width);
+		putIDs(block, targets, width);
+		putStates(block, states);
+		if (dir == MIXED)
+			block.insert(block.end(), directed.begin(), directed.end());
+		writeBlock(buf, block, checksum_);
+	}
+}
+
+} /* namespace io */
+} /* namespace largenet */
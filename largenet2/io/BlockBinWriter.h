@@ -0,0 +1,47 @@
+/**
+ * @file BlockBinWriter.h
+ * @date 18.10.2026
+ */
+
+#ifndef BLOCKBINWRITER_H_
+#define BLOCKBINWRITER_H_
+
+#include <largenet2/io/GraphWriter.h>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Write graphs in the versioned block binary format described in
+ * BlockBinFormat.h.
+ *
+ * Nodes and edges are written in blocks of whole arrays, one stream write
+ * per block, so that large graphs are written at disk speed. Node IDs take 4
+ * bytes if the largest ID allows it, otherwise 8.
+ */
+class BlockBinWriter: public GraphWriter
+{
+public:
+	/**
+	 * Constructor
+	 * @param checksum append a CRC-32 to the header and every block
+	 * @param blockSize number of nodes or edges per block
+	 */
+	explicit BlockBinWriter(bool checksum = true, unsigned int blockSize =
+			1 << 16);
+	virtual ~BlockBinWriter() {}
+	/**
+	 * @copydoc GraphWriter::write()
+	 */
+	void write(const Graph& g, std::ostream& strm);
+
+private:
+	bool checksum_;
+	unsigned int blockSize_;
+};
+
+} /* namespace io */
+} /* namespace largenet */
+#endif /* BLOCKBINWRITER_H_ */
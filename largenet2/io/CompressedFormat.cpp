@@ -0,0 +1,164 @@
+/**
+ * @file CompressedFormat.cpp
+ * @date 18.10.2026
+ */
+
+#include "CompressedFormat.h"
+#include "varint.h"
+#include <stdexcept>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+namespace compressed
+{
+
+namespace
+{
+
+void malformed()
+{
+	throw runtime_error("Malformed compressed graph block.");
+}
+
+/// Append (value, run length) pairs of @p n values, read through @p value.
+template<class T, class F>
+void putRuns(string& buf, const T* items, const size_t n, F value)
+{
+	size_t i = 0;
+	while (i < n)
+	{
+		const boost::uint64_t v = value(items[i]);
+		size_t j = i + 1;
+		while (j < n && value(items[j]) == v)
+			++j;
+		putVarint(buf, v);
+		putVarint(buf, j - i);
+		i = j;
+	}
+}
+
+boost::uint64_t nodeState(const NodeRecord& n)
+{
+	return n.state;
+}
+
+boost::uint64_t edgeCode(const EdgeRecord& e)
+{
+	return 2 * static_cast<boost::uint64_t> (e.state) + (e.directed ? 1 : 0);
+}
+
+/// split the payload into ID stream [@p p, returned end) and the rest
+const char* idStream(const char*& p, const char* end)
+{
+	const boost::uint64_t bytes = getVarint(p, end);
+	if (bytes > static_cast<boost::uint64_t> (end - p))
+		malformed();
+	const char* ids = p;
+	p += bytes;
+	return ids;
+}
+
+}
+
+void encodeNodes(const NodeRecord* nodes, const size_t n, string& buf)
+{
+	string ids;
+	for (size_t i = 0; i < n; ++i)
+		putVarint(ids, i == 0 ? nodes[i].id : nodes[i].id - nodes[i - 1].id - 1);
+	putVarint(buf, ids.size());
+	buf += ids;
+	putRuns(buf, nodes, n, nodeState);
+}
+
+void encodeEdges(const EdgeRecord* edges, const size_t n, string& buf)
+{
+	string ids;
+	boost::int64_t source = 0, target = 0;
+	for (size_t i = 0; i < n; ++i)
+	{
+		const boost::int64_t s = edges[i].source, t = edges[i].target;
+		putVarint(ids, zigzag(s - source));
+		putVarint(ids, zigzag(i > 0 && s == source ? t - target : t - s));
+		source = s;
+		target = t;
+	}
+	putVarint(buf, ids.size());
+	buf += ids;
+	putRuns(buf, edges, n, edgeCode);
+}
+
+void decodeNodes(const char* p, const char* end, const size_t n,
+		vector<NodeRecord>& nodes)
+{
+	const char* ids = idStream(p, end);
+	const char* idsEnd = p;
+	if (n > static_cast<size_t> (idsEnd - ids))
+		malformed();
+	const size_t first = nodes.size();
+	nodes.resize(first + n);
+	NodeRecord* out = n > 0 ? &nodes[first] : 0;
+	boost::uint64_t id = 0;
+	for (size_t i = 0; i < n; ++i)
+	{
+		const boost::uint64_t v = getVarint(ids, idsEnd);
+		id = i == 0 ? v : id + v + 1;
+		out[i].id = id;
+	}
+	for (size_t i = 0; i < n;)
+	{
+		const boost::uint64_t state = getVarint(p, end);
+		const boost::uint64_t run = getVarint(p, end);
+		if (run == 0 || run > n - i)
+			malformed();
+		for (const size_t last = i + run; i < last; ++i)
+			out[i].state = state;
+	}
+	if (ids != idsEnd || p != end)
+		malformed();
+}
+
+void decodeEdges(const char* p, const char* end, const size_t n,
+		vector<EdgeRecord>& edges)
+{
+	const char* ids = idStream(p, end);
+	const char* idsEnd = p;
+	if (n > static_cast<size_t> (idsEnd - ids) / 2)
+		malformed();
+	const size_t first = edges.size();
+	edges.resize(first + n);
+	EdgeRecord* out = n > 0 ? &edges[first] : 0;
+	boost::int64_t source = 0, target = 0;
+	for (size_t i = 0; i < n; ++i)
+	{
+		const boost::int64_t ds = unzigzag(getVarint(ids, idsEnd));
+		const boost::int64_t dt = unzigzag(getVarint(ids, idsEnd));
+		target = (i > 0 && ds == 0 ? target : source + ds) + dt;
+		source += ds;
+		if (source < 0 || target < 0)
+			malformed();
+		out[i].source = source;
+		out[i].target = target;
+	}
+	for (size_t i = 0; i < n;)
+	{
+		const boost::uint64_t code = getVarint(p, end);
+		const boost::uint64_t run = getVarint(p, end);
+		if (run == 0 || run > n - i)
+			malformed();
+		for (const size_t last = i + run; i < last; ++i)
+		{
+			out[i].state = static_cast<edge_state_t> (code / 2);
+			out[i].directed = (code & 1) != 0;
+		}
+	}
+	if (ids != idsEnd || p != end)
+		malformed();
+}
+
+}
+}
+}
@@ -0,0 +1,98 @@
+/**
+ * @file CompressedFormat.h
+ * @date 18.10.2026
+ */
+
+#ifndef COMPRESSEDFORMAT_H_
+#define COMPRESSEDFORMAT_H_
+
+#include <largenet2/base/types.h>
+#include <boost/cstdint.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Compressed graph format written by CompressedStreamWriter and
+ * CompressedWriter, and read by CompressedStreamReader and
+ * CompressedReader.
+ *
+ * All integers except the footer are variable-length (see varint.h), so the
+ * format does not depend on byte order. The file consists of
+ * @verbatim
+ "LNCZ", u8 version, node states, edge states
+ blocks: u8 type, element count, payload size, payload
+ index block: per block, its offset minus the previous one
+ footer: 8 byte little-endian offset of the index block, "LNCX"
+ @endverbatim
+ * Node blocks come before edge blocks. Each block can be decoded on its own.
+ *
+ * A node block stores the size of its ID stream, the ID stream, in which the
+ * first ID is stored as is and every following one as its gap to the
+ * previous ID minus one, and the node states as (state, run length) pairs.
+ *
+ * An edge block stores the size of its ID stream, the ID stream and the
+ * edge codes (2 * state + directed) as (code, run length) pairs. In the ID
+ * stream each edge is the zigzag-coded difference of its source to the
+ * previous source, then the zigzag-coded difference of its target to the
+ * previous target if the source is unchanged, or to its own source
+ * otherwise. Edges sorted by source and target thus take about two bytes
+ * each.
+ */
+namespace compressed
+{
+
+const char magic[4] = { 'L', 'N', 'C', 'Z' };
+const char indexMagic[4] = { 'L', 'N', 'C', 'X' };
+const boost::uint8_t version = 1;
+/// size of the footer following the index block
+const std::size_t footerSize = 12;
+
+enum BlockType
+{
+	NODE_BLOCK = 1, EDGE_BLOCK = 2, INDEX_BLOCK = 3
+};
+
+struct NodeRecord
+{
+	node_id_t id;
+	node_state_t state;
+};
+
+struct EdgeRecord
+{
+	node_id_t source, target;
+	edge_state_t state;
+	bool directed;
+};
+
+/// Encode @p n nodes with increasing IDs as block payload into @p buf.
+void encodeNodes(const NodeRecord* nodes, std::size_t n, std::string& buf);
+/// Encode @p n edges as block payload into @p buf.
+void encodeEdges(const EdgeRecord* edges, std::size_t n, std::string& buf);
+/**
+ * Decode the payload [@p p, @p end) of a node block with @p n nodes,
+ * appending them to @p nodes.
+ * @throw std::runtime_error if the payload is malformed
+ */
+void decodeNodes(const char* p, const char* end, std::size_t n,
+		std::vector<NodeRecord>& nodes);
+/**
+ * Decode the payload [@p p, @p end) of an edge block with @p n edges,
+ * appending them to @p edges.
+ * @throw std::runtime_error if the payload is malformed
+ */
+void decodeEdges(const char* p, const char* end, std::size_t n,
+		std::vector<EdgeRecord>& edges);
+
+}
+
+}
+}
+
+#endif /* COMPRESSEDFORMAT_H_ */
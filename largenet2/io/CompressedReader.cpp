@@ -0,0 +1,239 @@
+/**
+ * @file CompressedReader.cpp
+ * @date 18.10.2026
+ */
+
+#include "CompressedReader.h"
+#include "CompressedFormat.h"
+#include "varint.h"
+#include <largenet2/base/Graph.h>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+#include <vector>
+#include <memory>
+#include <limits>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+
+using namespace compressed;
+
+namespace
+{
+
+struct Block
+{
+	int type;
+	boost::uint64_t count;
+	const char* begin;
+	const char* end;
+	vector<NodeRecord> nodes;
+	vector<EdgeRecord> edges;
+	string error;
+};
+
+/// Parse the block frame at @p p, advancing @p p past its payload.
+void frame(const char*& p, const char* end, Block& b)
+{
+	if (p == end)
+		throw runtime_error("Compressed graph data are truncated.");
+	b.type = static_cast<unsigned char> (*p++);
+	b.count = getVarint(p, end);
+	const boost::uint64_t size = getVarint(p, end);
+	if (size > static_cast<boost::uint64_t> (end - p))
+		throw runtime_error("Compressed graph data are truncated.");
+	b.begin = p;
+	b.end = p + size;
+	p = b.end;
+}
+
+/// decode blocks @p first, @p first + @p stride, ...
+void decode(vector<Block>& blocks, const size_t first, const size_t stride)
+{
+	for (size_t i = first; i < blocks.size(); i += stride)
+	{
+		Block& b = blocks[i];
+		try
+		{
+			if (b.type == NODE_BLOCK)
+				decodeNodes(b.begin, b.end, b.count, b.nodes);
+			else
+				decodeEdges(b.begin, b.end, b.count, b.edges);
+		} catch (std::exception& e)
+		{
+			b.error = e.what();
+		}
+	}
+}
+
+}
+
+CompressedReader::CompressedReader(const unsigned int threads) :
+	threads_(threads)
+{
+	if (threads_ == 0)
+		threads_ = boost::thread::hardware_concurrency();
+	if (threads_ == 0)
+		threads_ = 1;
+}
+
+Graph* CompressedReader::createFromStream(istream& strm)
+{
+	return read(strm, 0);
+}
+
+Graph* CompressedReader::createFromStream(istream& strm, Graph& graphToFill)
+{
+	return read(strm, &graphToFill);
+}
+
+Graph* CompressedReader::read(istream& strm, Graph* graphToFill)
+{
+	const string data((istreambuf_iterator<char> (strm)), istreambuf_iterator<
+			char> ());
+	const char* p = data.data();
+	const char* end = p + data.size();
+	if (data.size() < sizeof(magic) + 1 || !equal(magic, magic
+			+ sizeof(magic), p))
+		throw runtime_error("Not a compressed graph file.");
+	p += sizeof(magic);
+	if (static_cast<unsigned char> (*p++) > version)
+		throw runtime_error("Unsupported compressed graph version.");
+	const node_state_size_t nodeStates = getVarint(p, end);
+	const edge_state_size_t edgeStates = getVarint(p, end);
+	const char* const first = p;
+
+	// locate the blocks through the index if there is one, else scan
+	vector<Block> blocks;
+	bool indexed = false;
+	if (static_cast<size_t> (end - first) >= footerSize && equal(indexMagic,
+			indexMagic + sizeof(indexMagic), end - sizeof(indexMagic)))
+	{
+		boost::uint64_t indexOffset = 0;
+		for (unsigned int i = 0; i < 8; ++i)
+			indexOffset |= static_cast<boost::uint64_t> (static_cast<
+					unsigned char> (*(end - footerSize + i))) << (8 * i);
+		if (indexOffset < data.size() - footerSize)
+		{
+			const char* q = data.data() + indexOffset;
+			Block index;
+			frame(q, end - footerSize, index);
+			if (index.type == INDEX_BLOCK && index.count
+					<= static_cast<boost::uint64_t> (index.end - index.begin))
+			{
+				blocks.resize(index.count);
+				boost::uint64_t offset = 0;
+				q = index.begin;
+				for (size_t i = 0; i < blocks.size(); ++i)
+				{
+					offset += getVarint(q, index.end);
+					if (offset >= indexOffset)
+						throw runtime_error("Invalid compressed graph index.");
+					const char* b = data.data() + offset;
+					frame(b, data.data() + indexOffset, blocks[i]);
+				}
+				indexed = true;
+			}
+		}
+	}
+	if (!indexed)
+	{
+		blocks.clear();
+		while (p != end)
+		{
+			Block b;
+			frame(p, end, b);
+			if (b.type == INDEX_BLOCK)
+				break;
+			blocks.push_back(b);
+		}
+	}
+	for (vector<Block>::const_iterator b = blocks.begin(); b != blocks.end(); ++b)
+		if (b->type != NODE_BLOCK && b->type != EDGE_BLOCK)
+			throw runtime_error("Invalid block in compressed graph data.");
+
+	const size_t n = min<size_t> (threads_, blocks.size());
+	if (n <= 1)
+		decode(blocks, 0, 1);
+	else
+	{
+		boost::thread_group pool;
+		for (size_t i = 0; i < n; ++i)
+			pool.create_thread(boost::bind(decode, boost::ref(blocks), i, n));
+		pool.join_all();
+	}
+
+	node_id_t maxNodeID = 0;
+	for (vector<Block>::const_iterator b = blocks.begin(); b != blocks.end(); ++b)
+	{
+		if (!b->error.empty())
+			throw runtime_error(b->error);
+		for (vector<NodeRecord>::const_iterator r = b->nodes.begin(); r
+				!= b->nodes.end(); ++r)
+		{
+			if (r->state >= nodeStates)
+				throw runtime_error("Invalid node state in compressed graph.");
+			maxNodeID = max(maxNodeID, r->id);
+		}
+	}
+
+	auto_ptr<Graph> created;
+	Graph* g = graphToFill;
+	if (g == 0)
+	{
+		created.reset(new Graph(nodeStates, edgeStates));
+		g = created.get();
+	}
+	else if (nodeStates > g->numberOfNodeStates() || edgeStates
+			> g->numberOfEdgeStates())
+		throw runtime_error("Compressed graph has more states than the graph.");
+	g->clear();
+
+	const node_id_t unmapped = numeric_limits<node_id_t>::max();
+	vector<node_id_t> remap;
+	for (vector<Block>::iterator b = blocks.begin(); b != blocks.end(); ++b)
+	{
+		if (b->type != NODE_BLOCK)
+			continue;
+		if (remap.empty())
+			remap.resize(maxNodeID + 1, unmapped);
+		for (vector<NodeRecord>::const_iterator r = b->nodes.begin(); r
+				!= b->nodes.end(); ++r)
+		{
+			if (remap[r->id] != unmapped)
+				throw runtime_error("Duplicate node in compressed graph.");
+			remap[r->id] = g->addNode(r->state);
+		}
+		vector<NodeRecord>().swap(b->nodes);
+	}
+	for (vector<Block>::iterator b = blocks.begin(); b != blocks.end(); ++b)
+	{
+		for (vector<EdgeRecord>::const_iterator r = b->edges.begin(); r
+				!= b->edges.end(); ++r)
+		{
+			if (r->source >= remap.size() || r->target >= remap.size()
+					|| remap[r->source] == unmapped || remap[r->target]
+					== unmapped || r->state >= edgeStates)
+				throw runtime_error("Invalid edge in compressed graph.");
+			const edge_id_t e = g->addEdge(remap[r->source],
+					remap[r->target], r->directed);
+			if (r->state != 0)
+				g->setEdgeState(e, r->state);
+		}
+		// release memory early
+		vector<EdgeRecord>().swap(b->edges);
+	}
+	created.release();
+	return g;
+}
+
+}
+}
@@ -0,0 +1,60 @@
+/**
+ * @file CompressedReader.h
+ * @date 18.10.2026
+ */
+
+#ifndef COMPRESSEDREADER_H_
+#define COMPRESSEDREADER_H_
+
+#include <largenet2/io/GraphReader.h>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Read graphs in the compressed format described in CompressedFormat.h.
+ *
+ * The whole stream is read into memory, the blocks are located through the
+ * block index (or by scanning, if the index is missing) and decoded in
+ * parallel, and the graph is then built in one pass. Node IDs in the file
+ * are mapped to the IDs of the new nodes through a vector. For reading
+ * node by node, use CompressedStreamReader. Malformed or truncated data
+ * cause std::runtime_error.
+ */
+class CompressedReader: public GraphReader
+{
+public:
+	/**
+	 * Constructor
+	 * @param threads number of decoder threads, 0 for one per core
+	 */
+	explicit CompressedReader(unsigned int threads = 0);
+	virtual ~CompressedReader() {}
+	/**
+	 * Create a new Graph object from stream
+	 * @param strm Stream to read graph data from
+	 * @return pointer to new graph object
+	 */
+	Graph* createFromStream(std::istream& strm);
+	/**
+	 * Create a graph from stream data, using an existing Graph object
+	 * @param strm Stream to read data from
+	 * @param[out] graphToFill Graph object to hold the new graph, will be
+	 * cleared before filling and must have at least as many node and edge
+	 * states as the stored graph
+	 * @return pointer to @p graphToFill
+	 */
+	Graph* createFromStream(std::istream& strm, Graph& graphToFill);
+
+private:
+	Graph* read(std::istream& strm, Graph* graphToFill);
+
+	unsigned int threads_;
+};
+
+}
+}
+
+#endif /* COMPRESSEDREADER_H_ */
@@ -0,0 +1,119 @@
+/**
+ * @file CompressedStreamReader.cpp
+ * @date 18.10.2026
+ */
+
+#include "CompressedStreamReader.h"
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+
+using namespace compressed;
+
+namespace
+{
+
+void truncated()
+{
+	throw runtime_error("Compressed graph data are truncated.");
+}
+
+boost::uint64_t readVarint(istream& in)
+{
+	boost::uint64_t v = 0;
+	for (unsigned int shift = 0; shift < 64; shift += 7)
+	{
+		const int c = in.get();
+		if (c == char_traits<char>::eof())
+			truncated();
+		v |= static_cast<boost::uint64_t> (c & 0x7f) << shift;
+		if ((c & 0x80) == 0)
+			return v;
+	}
+	throw runtime_error("Invalid varint in compressed graph data.");
+}
+
+}
+
+CompressedStreamReader::CompressedStreamReader(istream& in) :
+	in_(in), nodeStates_(0), edgeStates_(0), type_(0), end_(false), next_(0)
+{
+	char m[sizeof(magic)];
+	if (!in_.read(m, sizeof(m)) || !equal(m, m + sizeof(m), magic))
+		throw runtime_error("Not a compressed graph file.");
+	const int v = in_.get();
+	if (v == char_traits<char>::eof())
+		truncated();
+	if (v > version)
+		throw runtime_error("Unsupported compressed graph version.");
+	nodeStates_ = readVarint(in_);
+	edgeStates_ = readVarint(in_);
+}
+
+bool CompressedStreamReader::nextNode(NodeRecord& n)
+{
+	while (type_ != EDGE_BLOCK && !end_)
+	{
+		if (type_ == NODE_BLOCK && next_ < nodes_.size())
+		{
+			n = nodes_[next_++];
+			return true;
+		}
+		nextBlock();
+	}
+	return false;
+}
+
+bool CompressedStreamReader::nextEdge(EdgeRecord& e)
+{
+	while (!end_)
+	{
+		if (type_ == EDGE_BLOCK && next_ < edges_.size())
+		{
+			e = edges_[next_++];
+			return true;
+		}
+		nextBlock();
+	}
+	return false;
+}
+
+void CompressedStreamReader::nextBlock()
+{
+	const int type = in_.get();
+	if (type == char_traits<char>::eof())
+		truncated();
+	if (type == INDEX_BLOCK)
+	{
+		end_ = true;
+		return;
+	}
+	if (type != NODE_BLOCK && type != EDGE_BLOCK)
+		throw runtime_error("Invalid block in compressed graph data.");
+	if (type == NODE_BLOCK && type_ == EDGE_BLOCK)
+		throw runtime_error("Compressed graph has nodes after edges.");
+	const boost::uint64_t count = readVarint(in_);
+	const boost::uint64_t size = readVarint(in_);
+	payload_.resize(size);
+	if (size > 0 && !in_.read(&payload_[0], size))
+		truncated();
+	const char* p = payload_.data();
+	nodes_.clear();
+	edges_.clear();
+	if (type == NODE_BLOCK)
+		decodeNodes(p, p + size, count, nodes_);
+	else
+		decodeEdges(p, p + size, count, edges_);
+	type_ = type;
+	next_ = 0;
+}
+
+}
+}
@@ -0,0 +1,76 @@
+/**
+ * @file CompressedStreamReader.h
+ * @date 18.10.2026
+ */
+
+#ifndef COMPRESSEDSTREAMREADER_H_
+#define COMPRESSEDSTREAMREADER_H_
+
+#include <largenet2/io/CompressedFormat.h>
+#include <boost/noncopyable.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Read nodes and edges one by one from data in the compressed format
+ * described in CompressedFormat.h, decoding one block at a time.
+ *
+ * The stream is read sequentially and need not be seekable; the block index
+ * at its end is not used. Malformed or truncated data cause
+ * std::runtime_error.
+ */
+class CompressedStreamReader: private boost::noncopyable
+{
+public:
+	typedef compressed::NodeRecord NodeRecord;
+	typedef compressed::EdgeRecord EdgeRecord;
+
+	/**
+	 * Constructor, reads the file header.
+	 * @param in stream to read from
+	 */
+	explicit CompressedStreamReader(std::istream& in);
+
+	node_state_size_t numberOfNodeStates() const
+	{
+		return nodeStates_;
+	}
+	edge_state_size_t numberOfEdgeStates() const
+	{
+		return edgeStates_;
+	}
+	/**
+	 * Read the next node.
+	 * @return false if all nodes have been read
+	 */
+	bool nextNode(NodeRecord& n);
+	/**
+	 * Read the next edge, skipping any nodes not read yet.
+	 * @return false if all edges have been read
+	 */
+	bool nextEdge(EdgeRecord& e);
+
+private:
+	void nextBlock();
+
+	std::istream& in_;
+	node_state_size_t nodeStates_;
+	edge_state_size_t edgeStates_;
+	int type_;
+	bool end_;
+	std::size_t next_;
+	std::string payload_;
+	std::vector<NodeRecord> nodes_;
+	std::vector<EdgeRecord> edges_;
+};
+
+}
+}
+
+#endif /* COMPRESSEDSTREAMREADER_H_ */
@@ -0,0 +1,144 @@
+/**
+ * @file CompressedStreamWriter.cpp
+ * @date 18.10.2026
+ */
+
+#include "CompressedStreamWriter.h"
+#include "varint.h"
+#include <stdexcept>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+
+using namespace compressed;
+
+CompressedStreamWriter::CompressedStreamWriter(ostream& out,
+		const node_state_size_t nodeStates, const edge_state_size_t edgeStates,
+		const unsigned int blockSize) :
+	out_(out), blockSize_(blockSize), lastNode_(0), pos_(0), anyNode_(false),
+			anyEdge_(false), finished_(false)
+{
+	if (blockSize_ == 0)
+		throw invalid_argument("Block size must be positive.");
+	nodes_.reserve(blockSize_);
+	string header(magic, magic + sizeof(magic));
+	header.push_back(static_cast<char> (version));
+	putVarint(header, nodeStates);
+	putVarint(header, edgeStates);
+	write(header);
+}
+
+CompressedStreamWriter::~CompressedStreamWriter()
+{
+	try
+	{
+		finish();
+	} catch (...)
+	{
+	}
+}
+
+void CompressedStreamWriter::addNode(const node_id_t id,
+		const node_state_t state)
+{
+	if (anyEdge_ || finished_)
+		throw logic_error("Nodes must be added before edges.");
+	if (anyNode_ && id <= (nodes_.empty() ? lastNode_ : nodes_.back().id))
+		throw invalid_argument("Node IDs must be increasing.");
+	NodeRecord n = { id, state };
+	nodes_.push_back(n);
+	anyNode_ = true;
+	if (nodes_.size() == blockSize_)
+		flushNodes();
+}
+
+void CompressedStreamWriter::addEdge(const node_id_t source,
+		const node_id_t target, const edge_state_t state, const bool directed)
+{
+	if (finished_)
+		throw logic_error("Cannot add edges to a finished writer.");
+	if (!anyEdge_)
+	{
+		flushNodes();
+		edges_.reserve(blockSize_);
+		anyEdge_ = true;
+	}
+	EdgeRecord e = { source, target, state, directed };
+	edges_.push_back(e);
+	if (edges_.size() == blockSize_)
+		flushEdges();
+}
+
+void CompressedStreamWriter::flushNodes()
+{
+	if (nodes_.empty())
+		return;
+	payload_.clear();
+	encodeNodes(&nodes_[0], nodes_.size(), payload_);
+	writeBlock(NODE_BLOCK, nodes_.size());
+	lastNode_ = nodes_.back().id;
+	nodes_.clear();
+}
+
+void CompressedStreamWriter::flushEdges()
+{
+	if (edges_.empty())
+		return;
+	payload_.clear();
+	encodeEdges(&edges_[0], edges_.size(), payload_);
+	writeBlock(EDGE_BLOCK, edges_.size());
+	edges_.clear();
+}
+
+void CompressedStreamWriter::writeBlock(const BlockType type,
+		const size_t count)
+{
+	if (type != INDEX_BLOCK)
+		offsets_.push_back(pos_);
+	frame_.clear();
+	frame_.push_back(static_cast<char> (type));
+	putVarint(frame_, count);
+	putVarint(frame_, payload_.size());
+	write(frame_);
+	write(payload_);
+}
+
+void CompressedStreamWriter::write(const string& data)
+{
+	if (!out_.write(data.data(), data.size()))
+		throw runtime_error("Cannot write compressed graph data.");
+	pos_ += data.size();
+}
+
+void CompressedStreamWriter::finish()
+{
+	if (finished_)
+		return;
+	finished_ = true;
+	flushNodes();
+	flushEdges();
+
+	payload_.clear();
+	boost::uint64_t prev = 0;
+	for (vector<boost::uint64_t>::const_iterator o = offsets_.begin(); o
+			!= offsets_.end(); ++o)
+	{
+		putVarint(payload_, *o - prev);
+		prev = *o;
+	}
+	const boost::uint64_t indexOffset = pos_;
+	writeBlock(INDEX_BLOCK, offsets_.size());
+	string footer;
+	for (unsigned int i = 0; i < 8; ++i)
+		footer.push_back(static_cast<char> ((indexOffset >> (8 * i)) & 0xff));
+	footer.append(indexMagic, sizeof(indexMagic));
+	write(footer);
+	out_.flush();
+}
+
+}
+}
@@ -0,0 +1,88 @@
+/**
+ * @file CompressedStreamWriter.h
+ * @date 18.10.2026
+ */
+
+#ifndef COMPRESSEDSTREAMWRITER_H_
+#define COMPRESSEDSTREAMWRITER_H_
+
+#include <largenet2/io/CompressedFormat.h>
+#include <boost/noncopyable.hpp>
+#include <boost/cstdint.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Write nodes and edges one by one in the compressed format described in
+ * CompressedFormat.h, without holding more than one block in memory.
+ *
+ * All nodes must be added before the first edge, in order of increasing
+ * IDs. Edges may come in any order, but compress best when sorted by source
+ * and target. finish() writes the block index; it is called by the
+ * destructor if necessary, ignoring errors.
+ */
+class CompressedStreamWriter: private boost::noncopyable
+{
+public:
+	typedef compressed::NodeRecord NodeRecord;
+	typedef compressed::EdgeRecord EdgeRecord;
+
+	/**
+	 * Constructor, writes the file header.
+	 * @param out stream to write to
+	 * @param nodeStates number of node states
+	 * @param edgeStates number of edge states
+	 * @param blockSize number of nodes or edges per block
+	 */
+	CompressedStreamWriter(std::ostream& out, node_state_size_t nodeStates,
+			edge_state_size_t edgeStates, unsigned int blockSize = 1 << 16);
+	~CompressedStreamWriter();
+
+	/**
+	 * Add a node.
+	 * @throw std::logic_error if edges have been added already
+	 * @throw std::invalid_argument if @p id is not larger than the previous one
+	 */
+	void addNode(node_id_t id, node_state_t state);
+	/**
+	 * Add an edge.
+	 * @throw std::logic_error if the writer has been finished
+	 */
+	void addEdge(node_id_t source, node_id_t target, edge_state_t state,
+			bool directed);
+	/// Write pending data, the block index and the footer.
+	void finish();
+
+	/// number of blocks written so far
+	std::size_t blocks() const
+	{
+		return offsets_.size();
+	}
+
+private:
+	void flushNodes();
+	void flushEdges();
+	void writeBlock(compressed::BlockType type, std::size_t count);
+	void write(const std::string& data);
+
+	std::ostream& out_;
+	unsigned int blockSize_;
+	std::vector<NodeRecord> nodes_;
+	std::vector<EdgeRecord> edges_;
+	std::vector<boost::uint64_t> offsets_;
+	std::string payload_, frame_;
+	node_id_t lastNode_;
+	boost::uint64_t pos_;
+	bool anyNode_, anyEdge_, finished_;
+};
+
+}
+}
+
+#endif /* COMPRESSEDSTREAMWRITER_H_ */
@@ -0,0 +1,84 @@
+/**
+ * @file CompressedWriter.cpp
+ * @date 18.10.2026
+ */
+
+#include "CompressedWriter.h"
+#include "CompressedStreamWriter.h"
+#include <largenet2/base/Graph.h>
+#include <boost/foreach.hpp>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+
+namespace
+{
+
+struct TargetLess
+{
+	bool operator()(const compressed::EdgeRecord& a,
+			const compressed::EdgeRecord& b) const
+	{
+		return a.target < b.target || (a.target == b.target && a.directed
+				< b.directed);
+	}
+};
+
+}
+
+CompressedWriter::CompressedWriter(const unsigned int blockSize) :
+	blockSize_(blockSize)
+{
+	if (blockSize_ == 0)
+		throw invalid_argument("Block size must be positive.");
+}
+
+void CompressedWriter::write(const Graph& g, ostream& strm)
+{
+	vector<node_id_t> ids;
+	ids.reserve(g.numberOfNodes());
+	Graph::ConstNodeIteratorRange nodes = g.nodes();
+	for (Graph::ConstNodeIterator n = nodes.first; n != nodes.second; ++n)
+		ids.push_back(n.id());
+	sort(ids.begin(), ids.end());
+
+	CompressedStreamWriter out(strm, g.numberOfNodeStates(),
+			g.numberOfEdgeStates(), blockSize_);
+	BOOST_FOREACH(const node_id_t id, ids)
+		out.addNode(id, g.nodeState(id));
+
+	vector<compressed::EdgeRecord> edges;
+	BOOST_FOREACH(const node_id_t id, ids)
+	{
+		const Node& n = *g.node(id);
+		edges.clear();
+		BOOST_FOREACH(const Edge* e, n.outEdges())
+		{
+			compressed::EdgeRecord r = { id, e->target()->id(), g.edgeState(
+					e->id()), true };
+			edges.push_back(r);
+		}
+		BOOST_FOREACH(const Edge* e, n.undirectedEdges())
+		{
+			if (e->source() != &n)
+				continue;
+			compressed::EdgeRecord r = { id, e->target()->id(), g.edgeState(
+					e->id()), false };
+			edges.push_back(r);
+		}
+		sort(edges.begin(), edges.end(), TargetLess());
+		BOOST_FOREACH(const compressed::EdgeRecord& r, edges)
+			out.addEdge(r.source, r.target, r.state, r.directed);
+	}
+	out.finish();
+}
+
+}
+}
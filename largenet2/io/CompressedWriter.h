@@ -0,0 +1,44 @@
+/**
+ * @file CompressedWriter.h
+ * @date 18.10.2026
+ */
+
+#ifndef COMPRESSEDWRITER_H_
+#define COMPRESSEDWRITER_H_
+
+#include <largenet2/io/GraphWriter.h>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Write graphs in the compressed format described in CompressedFormat.h.
+ *
+ * Nodes are written in order of their IDs, edges sorted by source and
+ * target, so that the ID gaps are small. Each edge is written once, from
+ * its source node.
+ */
+class CompressedWriter: public GraphWriter
+{
+public:
+	/**
+	 * Constructor
+	 * @param blockSize number of nodes or edges per block
+	 */
+	explicit CompressedWriter(unsigned int blockSize = 1 << 16);
+	virtual ~CompressedWriter() {}
+	/**
+	 * @copydoc GraphWriter::write()
+	 */
+	void write(const Graph& g, std::ostream& strm);
+
+private:
+	unsigned int blockSize_;
+};
+
+}
+}
+
+#endif /* COMPRESSEDWRITER_H_ */
@@ -0,0 +1,257 @@
+/**
+ * @file MappedEdgeListReader.cpp
+ * @date 18.10.2026
+ */
+
+#include "MappedEdgeListReader.h"
+#include <largenet2/base/Graph.h>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+using namespace std;
+
+namespace largenet
+{
+
+namespace io
+{
+
+namespace
+{
+
+/// edges and state assignments parsed from one chunk
+struct Chunk
+{
+	Chunk() :
+		begin(0), end(0), maxNodeID(0), maxState(0), empty(true)
+	{
+	}
+	const char* begin;
+	const char* end;
+	vector<node_id_t> ends; ///< source and target of each edge
+	vector<node_id_t> assigned; ///< nodes with states, in file order
+	vector<node_state_t> states; ///< their states
+	node_id_t maxNodeID;
+	node_state_t maxState;
+	bool empty; ///< no edges
+	string error;
+};
+
+inline bool blank(const char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+/**
+ * Parse an unsigned integer at @p p, skipping leading blanks.
+ * @return false if there is none before the end of the line
+ */
+inline bool scan(const char*& p, const char* end, unsigned long& x)
+{
+	while (p != end && blank(*p))
+		++p;
+	if (p == end || *p < '0' || *p > '9')
+		return false;
+	x = 0;
+	do
+	{
+		x = 10 * x + (*p - '0');
+		++p;
+	} while (p != end && *p >= '0' && *p <= '9');
+	return true;
+}
+
+void parse(Chunk& c, const string& commentChars)
+{
+	try
+	{
+		const char* p = c.begin;
+		while (p != c.end)
+		{
+			const char* eol = static_cast<const char*> (memchr(p, '\n', c.end
+					- p));
+			if (eol == 0)
+				eol = c.end;
+			const char* q = p;
+			while (q != eol && blank(*q))
+				++q;
+			if (q != eol && commentChars.find(*q) == string::npos)
+			{
+				unsigned long s, t, ss, ts;
+				if (!scan(q, eol, s) || !scan(q, eol, t))
+				{
+					ostringstream msg;
+					msg << "Cannot parse edge list line: "
+							<< string(p, eol - p);
+					throw runtime_error(msg.str());
+				}
+				c.ends.push_back(s);
+				c.ends.push_back(t);
+				c.maxNodeID = max(c.maxNodeID, max<node_id_t> (s, t));
+				c.empty = false;
+				if (scan(q, eol, ss))
+				{
+					if (!scan(q, eol, ts))
+						throw runtime_error(
+								"Edge list line has only one node state.");
+					c.assigned.push_back(s);
+					c.states.push_back(ss);
+					c.assigned.push_back(t);
+					c.states.push_back(ts);
+					c.maxState = max(c.maxState, max<node_state_t> (ss, ts));
+				}
+			}
+			p = eol == c.end ? eol : eol + 1;
+		}
+	} catch (std::exception& e)
+	{
+		c.error = e.what();
+	}
+}
+
+}
+
+MappedEdgeListReader::MappedEdgeListReader(const unsigned int threads) :
+	threads_(threads), directed_(true), commentChars_("#%")
+{
+	if (threads_ == 0)
+		threads_ = boost::thread::hardware_concurrency();
+	if (threads_ == 0)
+		threads_ = 1;
+}
+
+Graph* MappedEdgeListReader::createFromBuffer(const char* begin,
+		const char* end, Graph* graphToFill)
+{
+	// split at line boundaries; small inputs are not worth the threads
+	const std::size_t minChunk = 1 << 20;
+	const std::size_t size = end - begin;
+	const std::size_t n = max<std::size_t> (1, min<std::size_t> (threads_,
+			size / minChunk));
+	vector<Chunk> chunks(n);
+	const char* p = begin;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		chunks[i].begin = p;
+		const char* q = i + 1 == n ? end : begin + size * (i + 1) / n;
+		if (q < p)
+			q = p;
+		const char* eol = q == end ? 0 : static_cast<const char*> (memchr(q,
+				'\n', end - q));
+		p = eol == 0 ? end : eol + 1;
+		chunks[i].end = p;
+	}
+	if (n == 1)
+		parse(chunks[0], commentChars_);
+	else
+	{
+		boost::thread_group pool;
+		for (std::size_t i = 0; i < n; ++i)
+			pool.create_thread(boost::bind(parse, boost::ref(chunks[i]),
+					boost::cref(commentChars_)));
+		pool.join_all();
+	}
+
+	node_id_t maxNodeID = 0;
+	node_state_t maxState = 0;
+	bool empty = true;
+	for (vector<Chunk>::const_iterator c = chunks.begin(); c != chunks.end(); ++c)
+	{
+		if (!c->error.empty())
+			throw runtime_error(c->error);
+		if (!c->empty)
+		{
+			maxNodeID = max(maxNodeID, c->maxNodeID);
+			empty = false;
+		}
+		maxState = max(maxState, c->maxState);
+	}
+
+	auto_ptr<Graph> created;
+	Graph* g = graphToFill;
+	if (g == 0)
+	{
+		created.reset(new Graph(maxState + 1, 1));
+		g = created.get();
+	}
+	else if (maxState >= g->numberOfNodeStates())
+		throw runtime_error("Edge list has more node states than the graph.");
+	g->clear();
+	if (empty)
+		return created.get() ? created.release() : g;
+
+	// later lines override earlier ones
+	vector<node_state_t> states(maxNodeID + 1, 0);
+	for (vector<Chunk>::const_iterator c = chunks.begin(); c != chunks.end(); ++c)
+		for (std::size_t i = 0; i < c->assigned.size(); ++i)
+			states[c->assigned[i]] = c->states[i];
+	for (node_id_t i = 0; i <= maxNodeID; ++i)
+		g->addNode(states[i]);
+	for (vector<Chunk>::iterator c = chunks.begin(); c != chunks.end(); ++c)
+	{
+		for (std::size_t i = 0; i < c->ends.size(); i += 2)
+			g->addEdge(c->ends[i], c->ends[i + 1], directed_);
+		// release memory early
+		vector<node_id_t>().swap(c->ends);
+	}
+	created.release();
+	return g;
+}
+
+Graph* MappedEdgeListReader::createFromFile(const string& filename,
+		Graph& graphToFill)
+{
+	return mapFile(filename, &graphToFill);
+}
+
+Graph* MappedEdgeListReader::createFromFile(const string& filename)
+{
+	return mapFile(filename, 0);
+}
+
+Graph* MappedEdgeListReader::mapFile(const string& filename,
+		Graph* graphToFill)
+{
+	using namespace boost::interprocess;
+	ifstream probe(filename.c_str(), ios::binary | ios::ate);
+	if (!probe)
+		throw runtime_error("Cannot open " + filename);
+	if (probe.tellg() == streampos(0))
+		return createFromBuffer(0, 0, graphToFill);
+	probe.close();
+	file_mapping file(filename.c_str(), read_only);
+	mapped_region region(file, read_only);
+	region.advise(mapped_region::advice_sequential);
+	const char* begin = static_cast<const char*> (region.get_address());
+	return createFromBuffer(begin, begin + region.get_size(), graphToFill);
+}
+
+Graph* MappedEdgeListReader::createFromStream(istream& strm, Graph& graphToFill)
+{
+	const string data((istreambuf_iterator<char> (strm)),
+			istreambuf_iterator<char> ());
+	return createFromBuffer(data.data(), data.data() + data.size(),
+			&graphToFill);
+}
+
+Graph* MappedEdgeListReader::createFromStream(istream& strm)
+{
+	const string data((istreambuf_iterator<char> (strm)),
+			istreambuf_iterator<char> ());
+	return createFromBuffer(data.data(), data.data() + data.size(), 0);
+}
+
+}
+
+}
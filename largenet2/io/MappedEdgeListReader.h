@@ -0,0 +1,108 @@
+/**
+ * @file MappedEdgeListReader.h
+ * @date 18.10.2026
+ */
+
+#ifndef MAPPEDEDGELISTREADER_H_
+#define MAPPEDEDGELISTREADER_H_
+
+#include <largenet2/io/GraphReader.h>
+#include <string>
+#include <cstddef>
+
+namespace largenet
+{
+
+namespace io
+{
+
+/**
+ * Fast reader for large edge lists.
+ *
+ * The input has the format of EdgeListReader, one edge per line as
+ * @verbatim source target [source_state target_state] @endverbatim
+ * where the state columns are optional, and lines starting with one of
+ * commentChars() as well as blank lines are skipped. Node IDs in the file
+ * become node IDs in the graph, and all nodes from 0 up to the largest ID
+ * are created. A node takes the state given on the last line that mentions
+ * it with states, or state 0.
+ *
+ * createFromFile() memory-maps the file; createFromStream() reads the whole
+ * stream into memory first. The data are split into chunks at line
+ * boundaries, which are parsed in parallel by a hand-written integer
+ * scanner. The graph is then built in one pass, adding each node with its
+ * final state. Malformed lines cause std::runtime_error.
+ */
+class MappedEdgeListReader: public GraphReader
+{
+public:
+	/**
+	 * Constructor
+	 * @param threads number of parser threads, 0 for one per core
+	 */
+	explicit MappedEdgeListReader(unsigned int threads = 0);
+	virtual ~MappedEdgeListReader() {}
+
+	/// Create directed (the default) or undirected edges.
+	void setDirected(bool directed)
+	{
+		directed_ = directed;
+	}
+	bool directed() const
+	{
+		return directed_;
+	}
+	/// Characters that start a comment line, "#%" by default.
+	void setCommentChars(const std::string& chars)
+	{
+		commentChars_ = chars;
+	}
+	const std::string& commentChars() const
+	{
+		return commentChars_;
+	}
+
+	/**
+	 * Create a new graph from the file @p filename, with as many node states
+	 * as needed.
+	 */
+	Graph* createFromFile(const std::string& filename);
+	/**
+	 * Create a graph from the file @p filename in @p graphToFill, which is
+	 * cleared before filling and must have enough node states.
+	 * @return pointer to @p graphToFill
+	 */
+	Graph* createFromFile(const std::string& filename, Graph& graphToFill);
+	/**
+	 * @copybrief GraphReader::createFromStream(std::istream&)
+	 * @param strm Stream providing edge list data
+	 */
+	Graph* createFromStream(std::istream& strm);
+	/**
+	 * @copybrief GraphReader::createFromStream(std::istream&,Graph&)
+	 * @param strm Stream providing edge list data
+	 * @param[out] graphToFill Graph object to hold the new graph, will be cleared before filling
+	 * @return pointer to @p graphToFill
+	 */
+	Graph* createFromStream(std::istream& strm, Graph& graphToFill);
+	/**
+	 * Create a graph from the edge list in memory at [@p begin, @p end).
+	 * @param graphToFill graph to hold the new graph, or 0 for a new graph
+	 * @return pointer to the graph
+	 */
+	Graph* createFromBuffer(const char* begin, const char* end,
+			Graph* graphToFill);
+
+private:
+	Graph* mapFile(const std::string& filename, Graph* graphToFill);
+
+	unsigned int threads_;
+	bool directed_;
+	std::string commentChars_;
+};
+
+}
+
+}
+
+#endif /* MAPPEDEDGELISTREADER_H_ */
@@ -0,0 +1,119 @@
+/**
+ * @file MappedGraph.cpp
+ * @date 18.10.2026
+ */
+
+#include "MappedGraph.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+
+struct MappedGraph::Mapping
+{
+	Mapping(const string& filename) :
+		file(filename.c_str(), boost::interprocess::read_only), region(file,
+				boost::interprocess::read_only)
+	{
+	}
+	boost::interprocess::file_mapping file;
+	boost::interprocess::mapped_region region;
+};
+
+MappedGraph::MappedGraph(const string& filename)
+{
+	try
+	{
+		mapping_.reset(new Mapping(filename));
+	} catch (boost::interprocess::interprocess_exception& e)
+	{
+		throw runtime_error("Cannot map " + filename + ": " + e.what());
+	}
+	init(static_cast<const char*> (mapping_->region.get_address()),
+			mapping_->region.get_size());
+}
+
+MappedGraph::MappedGraph(const char* data, const std::size_t size)
+{
+	init(data, size);
+}
+
+MappedGraph::~MappedGraph()
+{
+}
+
+void MappedGraph::init(const char* data, const std::size_t size)
+{
+	using namespace mapped;
+	if (size < sizeof(Header) || memcmp(data, magic, sizeof(magic)) != 0)
+		throw runtime_error("Not a mapped graph file.");
+	if (reinterpret_cast<std::size_t> (data) % 8 != 0)
+		throw runtime_error("Mapped graph data are not aligned.");
+	header_ = reinterpret_cast<const Header*> (data);
+	if (header_->byteOrderMark != byteOrderMark)
+		throw runtime_error(
+				"Mapped graph file was written with a different byte order.");
+	if (header_->version > version)
+		throw runtime_error("Unsupported mapped graph file version.");
+	const Layout l = layout(*header_);
+	if (l.size > size)
+		throw runtime_error("Mapped graph file is truncated.");
+	nodeStates_ = reinterpret_cast<const boost::uint32_t*> (data
+			+ l.nodeStates);
+	outSplit_ = reinterpret_cast<const boost::uint32_t*> (data + l.outSplit);
+	inSplit_ = reinterpret_cast<const boost::uint32_t*> (data + l.inSplit);
+	nodeCounts_ = reinterpret_cast<const boost::uint64_t*> (data
+			+ l.nodeCounts);
+	edgeCounts_ = reinterpret_cast<const boost::uint64_t*> (data
+			+ l.edgeCounts);
+	outOffsets_ = reinterpret_cast<const boost::uint64_t*> (data
+			+ l.outOffsets);
+	inOffsets_ = reinterpret_cast<const boost::uint64_t*> (data + l.inOffsets);
+	outAdj_ = reinterpret_cast<const boost::uint32_t*> (data + l.outAdj);
+	outEdgeStates_ = reinterpret_cast<const boost::uint32_t*> (data
+			+ l.outEdgeStates);
+	inAdj_ = reinterpret_cast<const boost::uint32_t*> (data + l.inAdj);
+	if (outOffsets_[header_->nodes] != header_->outEntries
+			|| inOffsets_[header_->nodes] != header_->inEntries)
+		throw runtime_error("Invalid mapped graph file.");
+}
+
+degree_t MappedGraph::mutualDegree(const node_id_t n) const
+{
+	NeighborIteratorRange out = outNeighbors(n), in = inNeighbors(n);
+	degree_t m = 0;
+	while (out.first != out.second && in.first != in.second)
+	{
+		if (*out.first < *in.first)
+			++out.first;
+		else if (*in.first < *out.first)
+			++in.first;
+		else
+		{
+			++m;
+			++out.first;
+			++in.first;
+		}
+	}
+	return m;
+}
+
+bool MappedGraph::adjacent(const node_id_t source, const node_id_t target) const
+{
+	const NeighborIteratorRange out = outNeighbors(source);
+	if (binary_search(out.first, out.second, target))
+		return true;
+	const NeighborIteratorRange un = undirectedNeighbors(source);
+	return binary_search(un.first, un.second, target);
+}
+
+}
+}
@@ -0,0 +1,173 @@
+/**
+ * @file MappedGraph.h
+ * @date 18.10.2026
+ */
+
+#ifndef MAPPEDGRAPH_H_
+#define MAPPEDGRAPH_H_
+
+#include <largenet2/base/types.h>
+#include <largenet2/io/MappedGraphFormat.h>
+#include <boost/iterator/counting_iterator.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/cstdint.hpp>
+#include <string>
+#include <utility>
+#include <cstddef>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Read-only view of a graph file written by MappedGraphWriter.
+ *
+ * The file is memory-mapped and queried in place, without building a Graph,
+ * so that opening even very large networks is immediate and the pages are
+ * shared between processes using the same file. Nodes are numbered 0 to
+ * numberOfNodes() - 1 (see MappedGraphWriter). Node and degree queries mirror
+ * those of Graph and Node; neighbors are returned as ranges of 32 bit node
+ * IDs pointing into the file, sorted by ID.
+ *
+ * Queries do not check their node arguments, which must be smaller than
+ * numberOfNodes().
+ */
+class MappedGraph: private boost::noncopyable
+{
+public:
+	typedef boost::counting_iterator<node_id_t> NodeIterator;
+	typedef std::pair<NodeIterator, NodeIterator> NodeIteratorRange;
+	typedef const boost::uint32_t* NeighborIterator;
+	typedef std::pair<NeighborIterator, NeighborIterator> NeighborIteratorRange;
+
+	/**
+	 * Map the file @p filename.
+	 * @throw std::runtime_error if the file cannot be mapped or is not a
+	 * valid graph file for this machine
+	 */
+	explicit MappedGraph(const std::string& filename);
+	/**
+	 * View a graph file already in memory at @p data, which must be aligned
+	 * to eight bytes and must outlive this object.
+	 * @throw std::runtime_error if the data are not a valid graph file
+	 */
+	MappedGraph(const char* data, std::size_t size);
+	~MappedGraph();
+
+	node_size_t numberOfNodes() const
+	{
+		return header_->nodes;
+	}
+	node_size_t numberOfNodes(node_state_t s) const
+	{
+		return s < header_->nodeStates ? nodeCounts_[s] : 0;
+	}
+	edge_size_t numberOfEdges() const
+	{
+		return header_->edges;
+	}
+	edge_size_t numberOfEdges(edge_state_t s) const
+	{
+		return s < header_->edgeStates ? edgeCounts_[s] : 0;
+	}
+	node_state_size_t numberOfNodeStates() const
+	{
+		return header_->nodeStates;
+	}
+	edge_state_size_t numberOfEdgeStates() const
+	{
+		return header_->edgeStates;
+	}
+	NodeIteratorRange nodes() const
+	{
+		return std::make_pair(NodeIterator(0), NodeIterator(numberOfNodes()));
+	}
+	node_state_t nodeState(node_id_t n) const
+	{
+		return nodeStates_[n];
+	}
+
+	degree_t outDegree(node_id_t n) const
+	{
+		return outSplit_[n];
+	}
+	degree_t inDegree(node_id_t n) const
+	{
+		return inSplit_[n];
+	}
+	degree_t undirectedDegree(node_id_t n) const
+	{
+		return outOffsets_[n + 1] - outOffsets_[n] - outSplit_[n];
+	}
+	/// number of neighbors connected to @p n by directed edges in both directions
+	degree_t mutualDegree(node_id_t n) const;
+	degree_t degree(node_id_t n) const
+	{
+		return inDegree(n) + outDegree(n) + undirectedDegree(n);
+	}
+
+	/// targets of the directed out-edges of @p n
+	NeighborIteratorRange outNeighbors(node_id_t n) const
+	{
+		const NeighborIterator b = outAdj_ + outOffsets_[n];
+		return std::make_pair(b, b + outSplit_[n]);
+	}
+	/// sources of the directed in-edges of @p n
+	NeighborIteratorRange inNeighbors(node_id_t n) const
+	{
+		const NeighborIterator b = inAdj_ + inOffsets_[n];
+		return std::make_pair(b, b + inSplit_[n]);
+	}
+	/// neighbors of @p n along undirected edges
+	NeighborIteratorRange undirectedNeighbors(node_id_t n) const
+	{
+		return std::make_pair(outAdj_ + outOffsets_[n] + outSplit_[n], outAdj_
+				+ outOffsets_[n + 1]);
+	}
+	/// all nodes reachable from @p n in one step: out-neighbors, then undirected neighbors
+	NeighborIteratorRange successors(node_id_t n) const
+	{
+		return std::make_pair(outAdj_ + outOffsets_[n], outAdj_
+				+ outOffsets_[n + 1]);
+	}
+	/// all nodes reaching @p n in one step: in-neighbors, then undirected neighbors
+	NeighborIteratorRange predecessors(node_id_t n) const
+	{
+		return std::make_pair(inAdj_ + inOffsets_[n], inAdj_
+				+ inOffsets_[n + 1]);
+	}
+	/// edge states, in the order of successors(@p n)
+	const boost::uint32_t* successorEdgeStates(node_id_t n) const
+	{
+		return outEdgeStates_ + outOffsets_[n];
+	}
+	/**
+	 * Check whether there is a directed edge from @p source to @p target or
+	 * an undirected edge between them.
+	 */
+	bool adjacent(node_id_t source, node_id_t target) const;
+
+private:
+	void init(const char* data, std::size_t size);
+
+	struct Mapping;
+	boost::scoped_ptr<Mapping> mapping_;
+	const mapped::Header* header_;
+	const boost::uint32_t* nodeStates_;
+	const boost::uint32_t* outSplit_;
+	const boost::uint32_t* inSplit_;
+	const boost::uint64_t* nodeCounts_;
+	const boost::uint64_t* edgeCounts_;
+	const boost::uint64_t* outOffsets_;
+	const boost::uint64_t* inOffsets_;
+	const boost::uint32_t* outAdj_;
+	const boost::uint32_t* outEdgeStates_;
+	const boost::uint32_t* inAdj_;
+};
+
+}
+}
+
+#endif /* MAPPEDGRAPH_H_ */
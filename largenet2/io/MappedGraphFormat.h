@@ -0,0 +1,97 @@
+/**
+ * @file MappedGraphFormat.h
+ * @date 18.10.2026
+ */
+
+#ifndef MAPPEDGRAPHFORMAT_H_
+#define MAPPEDGRAPHFORMAT_H_
+
+#include <boost/cstdint.hpp>
+#include <cstddef>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Layout of the compressed sparse row (CSR) graph files written by
+ * MappedGraphWriter and mapped by MappedGraph.
+ *
+ * The file is meant to be used in place, so all numbers are stored in the
+ * byte order of the writing machine and every section starts at a multiple
+ * of eight bytes. After the Header follow, for @c N nodes,
+ * @verbatim
+ u32 nodeStates[N]    state of each node
+ u32 outSplit[N]      directed out-degree of each node
+ u32 inSplit[N]       directed in-degree of each node
+ u64 nodeCounts[S]    number of nodes in each node state
+ u64 edgeCounts[T]    number of edges in each edge state
+ u64 outOffsets[N+1]  start of each node's range in outAdj
+ u64 inOffsets[N+1]   start of each node's range in inAdj
+ u32 outAdj[]         per node: sorted directed out-neighbors, then sorted
+                      undirected neighbors
+ u32 outEdgeStates[]  edge state for each entry of outAdj
+ u32 inAdj[]          per node: sorted directed in-neighbors, then sorted
+                      undirected neighbors
+ @endverbatim
+ */
+namespace mapped
+{
+
+const char magic[4] = { 'L', 'N', 'C', 'S' };
+const boost::uint16_t byteOrderMark = 0x0102;
+const boost::uint8_t version = 1;
+
+/// file header, mapped directly
+struct Header
+{
+	char magic[4];
+	boost::uint16_t byteOrderMark;
+	boost::uint8_t version;
+	boost::uint8_t reserved;
+	boost::uint32_t nodeStates;
+	boost::uint32_t edgeStates;
+	boost::uint64_t nodes;
+	boost::uint64_t edges;
+	boost::uint64_t outEntries;
+	boost::uint64_t inEntries;
+	boost::uint64_t reserved2[2];
+};
+
+/// byte offsets of the sections following the header
+struct Layout
+{
+	std::size_t nodeStates, outSplit, inSplit, nodeCounts, edgeCounts,
+			outOffsets, inOffsets, outAdj, outEdgeStates, inAdj, size;
+};
+
+inline std::size_t align(const std::size_t n)
+{
+	return (n + 7) & ~std::size_t(7);
+}
+
+inline Layout layout(const Header& h)
+{
+	const std::size_t N = h.nodes;
+	Layout l;
+	l.nodeStates = sizeof(Header);
+	l.outSplit = align(l.nodeStates + 4 * N);
+	l.inSplit = align(l.outSplit + 4 * N);
+	l.nodeCounts = align(l.inSplit + 4 * N);
+	l.edgeCounts = l.nodeCounts + 8 * std::size_t(h.nodeStates);
+	l.outOffsets = l.edgeCounts + 8 * std::size_t(h.edgeStates);
+	l.inOffsets = l.outOffsets + 8 * (N + 1);
+	l.outAdj = l.inOffsets + 8 * (N + 1);
+	l.outEdgeStates = align(l.outAdj + 4 * std::size_t(h.outEntries));
+	l.inAdj = align(l.outEdgeStates + 4 * std::size_t(h.outEntries));
+	l.size = align(l.inAdj + 4 * std::size_t(h.inEntries));
+	return l;
+}
+
+}
+
+}
+}
+
+#endif /* MAPPEDGRAPHFORMAT_H_ */
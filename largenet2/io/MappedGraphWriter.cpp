@@ -0,0 +1,200 @@
+/**
+ * @file MappedGraphWriter.cpp
+ * @date 18.10.2026
+ */
+
+#include "MappedGraphWriter.h"
+#include "MappedGraphFormat.h"
+#include <largenet2/base/Graph.h>
+#include <boost/foreach.hpp>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+#include <cstring>
+
+using namespace std;
+
+namespace largenet
+{
+namespace io
+{
+
+namespace
+{
+
+using namespace mapped;
+
+typedef pair<boost::uint32_t, boost::uint32_t> Entry; ///< neighbor and edge state
+
+/// stream writer collecting small writes into large ones
+class Sink
+{
+public:
+	explicit Sink(ostream& strm) :
+		buf_(strm.rdbuf()), pos_(0)
+	{
+		data_.reserve(capacity);
+	}
+	~Sink()
+	{
+		try
+		{
+			flush();
+		} catch (...)
+		{
+		}
+	}
+	void put(const void* p, const size_t n)
+	{
+		const char* c = static_cast<const char*> (p);
+		data_.insert(data_.end(), c, c + n);
+		pos_ += n;
+		if (data_.size() >= capacity)
+			flush();
+	}
+	template<class T>
+	void put(const T v)
+	{
+		put(&v, sizeof(T));
+	}
+	/// pad with zeros up to byte @p offset
+	void seek(const size_t offset)
+	{
+		while (pos_ < offset)
+			put(char(0));
+	}
+	void flush()
+	{
+		const streamsize n = static_cast<streamsize> (data_.size());
+		if (n > 0 && buf_->sputn(&data_[0], n) != n)
+			throw runtime_error("Cannot write mapped graph file.");
+		data_.clear();
+	}
+
+private:
+	static const size_t capacity = 1 << 20;
+	streambuf* buf_;
+	vector<char> data_;
+	size_t pos_;
+};
+
+void sortedOut(const Graph& g, const Node& n,
+		const vector<boost::uint32_t>& remap, vector<Entry>& entries)
+{
+	entries.clear();
+	BOOST_FOREACH(const Edge* e, n.outEdges())
+		entries.push_back(Entry(remap[e->target()->id()], g.edgeState(e->id())));
+	sort(entries.begin(), entries.end());
+	const size_t directed = entries.size();
+	BOOST_FOREACH(const Edge* e, n.undirectedEdges())
+		entries.push_back(Entry(remap[e->opposite(n)->id()], g.edgeState(
+				e->id())));
+	sort(entries.begin() + directed, entries.end());
+}
+
+void sortedIn(const Node& n, const vector<boost::uint32_t>& remap,
+		vector<boost::uint32_t>& ids)
+{
+	ids.clear();
+	BOOST_FOREACH(const Edge* e, n.inEdges())
+		ids.push_back(remap[e->source()->id()]);
+	sort(ids.begin(), ids.end());
+	const size_t directed = ids.size();
+	BOOST_FOREACH(const Edge* e, n.undirectedEdges())
+		ids.push_back(remap[e->opposite(n)->id()]);
+	sort(ids.begin() + directed, ids.end());
+}
+
+}
+
+void MappedGraphWriter::write(const Graph& g, ostream& strm)
+{
+	if (g.numberOfNodes() > 0xffffffffUL)
+		throw runtime_error("Graph has too many nodes for a mapped graph file.");
+	vector<node_id_t> ids;
+	ids.reserve(g.numberOfNodes());
+	Graph::ConstNodeIteratorRange nodes = g.nodes();
+	for (Graph::ConstNodeIterator n = nodes.first; n != nodes.second; ++n)
+		ids.push_back(n.id());
+	sort(ids.begin(), ids.end());
+	vector<boost::uint32_t> remap(ids.empty() ? 0 : ids.back() + 1);
+	for (size_t i = 0; i < ids.size(); ++i)
+		remap[ids[i]] = static_cast<boost::uint32_t> (i);
+
+	Header h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, magic, sizeof(magic));
+	h.byteOrderMark = byteOrderMark;
+	h.version = version;
+	h.nodeStates = g.numberOfNodeStates();
+	h.edgeStates = g.numberOfEdgeStates();
+	h.nodes = ids.size();
+	h.edges = g.numberOfEdges();
+	BOOST_FOREACH(const node_id_t id, ids)
+	{
+		const Node& n = *g.node(id);
+		h.outEntries += n.outDegree() + n.undirectedDegree();
+		h.inEntries += n.inDegree() + n.undirectedDegree();
+	}
+	const Layout l = layout(h);
+
+	Sink out(strm);
+	out.put(&h, sizeof(h));
+	BOOST_FOREACH(const node_id_t id, ids)
+		out.put(static_cast<boost::uint32_t> (g.nodeState(id)));
+	out.seek(l.outSplit);
+	BOOST_FOREACH(const node_id_t id, ids)
+		out.put(static_cast<boost::uint32_t> (g.node(id)->outDegree()));
+	out.seek(l.inSplit);
+	BOOST_FOREACH(const node_id_t id, ids)
+		out.put(static_cast<boost::uint32_t> (g.node(id)->inDegree()));
+	out.seek(l.nodeCounts);
+	for (node_state_t s = 0; s < h.nodeStates; ++s)
+		out.put(static_cast<boost::uint64_t> (g.numberOfNodes(s)));
+	for (edge_state_t s = 0; s < h.edgeStates; ++s)
+		out.put(static_cast<boost::uint64_t> (g.numberOfEdges(s)));
+	boost::uint64_t offset = 0;
+	out.put(offset);
+	BOOST_FOREACH(const node_id_t id, ids)
+	{
+		offset += g.node(id)->outDegree() + g.node(id)->undirectedDegree();
+		out.put(offset);
+	}
+	offset = 0;
+	out.put(offset);
+	BOOST_FOREACH(const node_id_t id, ids)
+	{
+		offset += g.node(id)->inDegree() + g.node(id)->undirectedDegree();
+		out.put(offset);
+	}
+
+	// neighbors and their edge states in separate passes, sorting each list twice
+	vector<Entry> entries;
+	BOOST_FOREACH(const node_id_t id, ids)
+	{
+		sortedOut(g, *g.node(id), remap, entries);
+		BOOST_FOREACH(const Entry& e, entries)
+			out.put(e.first);
+	}
+	out.seek(l.outEdgeStates);
+	BOOST_FOREACH(const node_id_t id, ids)
+	{
+		sortedOut(g, *g.node(id), remap, entries);
+		BOOST_FOREACH(const Entry& e, entries)
+			out.put(e.second);
+	}
+	out.seek(l.inAdj);
+	vector<boost::uint32_t> in;
+	BOOST_FOREACH(const node_id_t id, ids)
+	{
+		sortedIn(*g.node(id), remap, in);
+		if (!in.empty())
+			out.put(&in[0], in.size() * sizeof(in[0]));
+	}
+	out.seek(l.size);
+	out.flush();
+}
+
+}
+}
@@ -0,0 +1,39 @@
+/**
+ * @file MappedGraphWriter.h
+ * @date 18.10.2026
+ */
+
+#ifndef MAPPEDGRAPHWRITER_H_
+#define MAPPEDGRAPHWRITER_H_
+
+#include <largenet2/io/GraphWriter.h>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Write graphs as compressed sparse row files for MappedGraph, see
+ * MappedGraphFormat.h.
+ *
+ * Nodes are numbered in the order of their IDs, so that a graph without
+ * removed nodes keeps its node IDs. The file is written in two passes over
+ * the nodes, holding only per-node arrays and one adjacency list in memory.
+ * Graphs with 2^32 or more nodes cause std::runtime_error.
+ */
+class MappedGraphWriter: public GraphWriter
+{
+public:
+	MappedGraphWriter() {}
+	virtual ~MappedGraphWriter() {}
+	/**
+	 * @copydoc GraphWriter::write()
+	 */
+	void write(const Graph& g, std::ostream& strm);
+};
+
+}
+}
+
+#endif /* MAPPEDGRAPHWRITER_H_ */
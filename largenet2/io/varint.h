@@ -0,0 +1,68 @@
+/**
+ * @file varint.h
+ * @date 18.10.2026
+ */
+
+#ifndef VARINT_H_
+#define VARINT_H_
+
+#include <boost/cstdint.hpp>
+#include <string>
+#include <stdexcept>
+
+namespace largenet
+{
+namespace io
+{
+
+/**
+ * Append @p v to @p buf as a variable-length integer: seven bits per byte,
+ * least significant group first, with the high bit set on all but the last
+ * byte.
+ */
+inline void putVarint(std::string& buf, boost::uint64_t v)
+{
+	while (v >= 0x80)
+	{
+		buf.push_back(static_cast<char> ((v & 0x7f) | 0x80));
+		v >>= 7;
+	}
+	buf.push_back(static_cast<char> (v));
+}
+
+/**
+ * Decode a variable-length integer starting at @p p and advance @p p past
+ * it.
+ * @throw std::runtime_error if the encoding extends beyond @p end
+ */
+inline boost::uint64_t getVarint(const char*& p, const char* end)
+{
+	boost::uint64_t v = 0;
+	for (unsigned int shift = 0; shift < 64; shift += 7)
+	{
+		if (p == end)
+			break;
+		const unsigned char b = static_cast<unsigned char> (*p++);
+		v |= static_cast<boost::uint64_t> (b & 0x7f) << shift;
+		if ((b & 0x80) == 0)
+			return v;
+	}
+	throw std::runtime_error("Truncated or invalid varint.");
+}
+
+/// Map signed to unsigned integers so that small magnitudes stay small.
+inline boost::uint64_t zigzag(const boost::int64_t v)
+{
+	return (static_cast<boost::uint64_t> (v) << 1) ^ static_cast<boost::uint64_t> (v >> 63);
+}
+
+/// Inverse of zigzag().
+inline boost::int64_t unzigzag(const boost::uint64_t v)
+{
+	return static_cast<boost::int64_t> (v >> 1) ^ -static_cast<boost::int64_t> (v & 1);
+}
+
+}
+}
+
+#endif /* VARINT_H_ */
@@ -0,0 +1,166 @@
+/**
+ * @file DegreeHistogram.cpp
+ * @date 18.10.2026
+ */
+
+#include "DegreeHistogram.h"
+#include <largenet2/base/Graph.h>
+
+namespace largenet
+{
+namespace measures
+{
+
+DegreeHistogram::DegreeHistogram(Graph& g) :
+	g_(g), states_(g.numberOfNodeStates()), removing_(false), removed_(0)
+{
+	rebuild();
+	g_.addGraphListener(this);
+}
+
+DegreeHistogram::~DegreeHistogram()
+{
+	g_.removeGraphListener(this);
+}
+
+degree_t DegreeHistogram::degree(const Node& n, const Kind kind)
+{
+	switch (kind)
+	{
+	case IN_DEGREE:
+		return n.inDegree();
+	case OUT_DEGREE:
+		return n.outDegree();
+	default:
+		return n.undirectedDegree();
+	}
+}
+
+void DegreeHistogram::rebuild()
+{
+	removing_ = false;
+	for (unsigned int k = 0; k < kinds; ++k)
+		hist_[k].assign(states_ + 1, degree_dist_t(1, 0));
+	Graph::NodeIteratorRange nodes = g_.nodes();
+	for (Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+	{
+		const node_state_t s = g_.nodeState(n.id());
+		for (unsigned int k = 0; k < kinds; ++k)
+			add(Kind(k), s, degree(*n, Kind(k)));
+	}
+}
+
+void DegreeHistogram::add(const Kind kind, const node_state_t s,
+		const degree_t k)
+{
+	degree_dist_t* d[2] = { &hist_[kind][s], &hist_[kind][states_] };
+	for (unsigned int i = 0; i < 2; ++i)
+	{
+		if (d[i]->size() <= k)
+			d[i]->resize(k + 1, 0);
+		++(*d[i])[k];
+	}
+}
+
+void DegreeHistogram::remove(const Kind kind, const node_state_t s,
+		const degree_t k)
+{
+	degree_dist_t* d[2] = { &hist_[kind][s], &hist_[kind][states_] };
+	for (unsigned int i = 0; i < 2; ++i)
+	{
+		--(*d[i])[k];
+		// keep the last bin occupied
+		while (d[i]->size() > 1 && d[i]->back() == 0)
+			d[i]->pop_back();
+	}
+}
+
+void DegreeHistogram::move(const Node& n, const Kind kind,
+		const degree_t from, const degree_t to)
+{
+	if (ignored(n))
+		return;
+	const node_state_t s = g_.nodeState(n.id());
+	// add first, so that trimming after the removal sees the new bin
+	add(kind, s, to);
+	remove(kind, s, from);
+}
+
+void DegreeHistogram::afterNodeAddEvent(Graph& g, Node& n)
+{
+	if (ignored(n))
+		removing_ = false;
+	const node_state_t s = g.nodeState(n.id());
+	for (unsigned int k = 0; k < kinds; ++k)
+		add(Kind(k), s, degree(n, Kind(k)));
+}
+
+void DegreeHistogram::afterEdgeAddEvent(Graph&, Edge& e)
+{
+	// the new edge is already counted in the degrees
+	Node& u = *e.source();
+	Node& v = *e.target();
+	if (e.isDirected())
+	{
+		move(u, OUT_DEGREE, u.outDegree() - 1, u.outDegree());
+		move(v, IN_DEGREE, v.inDegree() - 1, v.inDegree());
+	}
+	else
+	{
+		move(u, UNDIRECTED_DEGREE, u.undirectedDegree() - 1,
+				u.undirectedDegree());
+		if (!e.isLoop())
+			move(v, UNDIRECTED_DEGREE, v.undirectedDegree() - 1,
+					v.undirectedDegree());
+	}
+}
+
+void DegreeHistogram::beforeEdgeRemoveEvent(Graph&, Edge& e)
+{
+	Node& u = *e.source();
+	Node& v = *e.target();
+	if (e.isDirected())
+	{
+		move(u, OUT_DEGREE, u.outDegree(), u.outDegree() - 1);
+		move(v, IN_DEGREE, v.inDegree(), v.inDegree() - 1);
+	}
+	else
+	{
+		move(u, UNDIRECTED_DEGREE, u.undirectedDegree(),
+				u.undirectedDegree() - 1);
+		if (!e.isLoop())
+			move(v, UNDIRECTED_DEGREE, v.undirectedDegree(),
+					v.undirectedDegree() - 1);
+	}
+}
+
+void DegreeHistogram::beforeNodeRemoveEvent(Graph& g, Node& n)
+{
+	const node_state_t s = g.nodeState(n.id());
+	for (unsigned int k = 0; k < kinds; ++k)
+		remove(Kind(k), s, degree(n, Kind(k)));
+	// the graph removes the adjacent edges next; they must not move n
+	removing_ = true;
+	removed_ = n.id();
+}
+
+void DegreeHistogram::beforeGraphClearEvent(Graph&)
+{
+	removing_ = false;
+	for (unsigned int k = 0; k < kinds; ++k)
+		hist_[k].assign(states_ + 1, degree_dist_t(1, 0));
+}
+
+void DegreeHistogram::afterNodeStateChangeEvent(Graph&, Node& n,
+		const node_state_t oldState, const node_state_t newState)
+{
+	for (unsigned int k = 0; k < kinds; ++k)
+	{
+		const degree_t d = degree(n, Kind(k));
+		add(Kind(k), newState, d);
+		remove(Kind(k), oldState, d);
+	}
+}
+
+}
+}
@@ -0,0 +1,106 @@
+/**
+ * @file DegreeHistogram.h
+ * @date 18.10.2026
+ */
+
+#ifndef DEGREEHISTOGRAM_H_
+#define DEGREEHISTOGRAM_H_
+
+#include <largenet2/base/GraphListener.h>
+#include <largenet2/measures/DegreeDistribution.h>
+#include <boost/noncopyable.hpp>
+#include <vector>
+
+namespace largenet
+{
+namespace measures
+{
+
+/**
+ * Incrementally maintained in-, out-, and undirected degree distributions,
+ * per node state and over all nodes.
+ *
+ * The histogram listens to its Graph and moves a node between degree bins
+ * in constant time whenever an edge is added or removed, or the node changes
+ * its state. Reading a distribution thus takes O(k_max) time, instead of the
+ * full scan of a DegreeDistribution, with which it agrees.
+ */
+class DegreeHistogram: public GraphListener, public boost::noncopyable
+{
+public:
+	/// Degree types
+	enum Kind
+	{
+		IN_DEGREE, OUT_DEGREE, UNDIRECTED_DEGREE
+	};
+
+	/// Build the distributions of @p g and register with it.
+	explicit DegreeHistogram(Graph& g);
+	/// Unregister from the graph.
+	virtual ~DegreeHistogram();
+
+	node_state_size_t numberOfNodeStates() const
+	{
+		return states_;
+	}
+	/**
+	 * Distribution of degree type @p kind among nodes in state @p s. The
+	 * last entry is nonzero unless the distribution has a single entry.
+	 */
+	const degree_dist_t& distribution(Kind kind, node_state_t s) const
+	{
+		return hist_[kind][s];
+	}
+	/// Distribution of degree type @p kind among all nodes.
+	const degree_dist_t& distribution(Kind kind) const
+	{
+		return hist_[kind][states_];
+	}
+	/// Number of nodes in state @p s with degree @p k of type @p kind.
+	node_size_t count(Kind kind, node_state_t s, degree_t k) const
+	{
+		const degree_dist_t& d = distribution(kind, s);
+		return k < d.size() ? d[k] : 0;
+	}
+	/// Maximum degree of type @p kind.
+	degree_t maxDegree(Kind kind) const
+	{
+		return distribution(kind).size() - 1;
+	}
+	/// Rebuild all distributions from scratch.
+	void rebuild();
+
+private:
+	static const unsigned int kinds = 3;
+
+	void afterNodeAddEvent(Graph& g, Node& n);
+	void afterEdgeAddEvent(Graph& g, Edge& e);
+	void beforeNodeRemoveEvent(Graph& g, Node& n);
+	void beforeEdgeRemoveEvent(Graph& g, Edge& e);
+	void beforeGraphClearEvent(Graph& g);
+	void afterNodeStateChangeEvent(Graph& g, Node& n, node_state_t oldState,
+			node_state_t newState);
+
+	static degree_t degree(const Node& n, Kind kind);
+	void add(Kind kind, node_state_t s, degree_t k);
+	void remove(Kind kind, node_state_t s, degree_t k);
+	/// move node @p n from degree @p from to degree @p to
+	void move(const Node& n, Kind kind, degree_t from, degree_t to);
+	bool ignored(const Node& n) const
+	{
+		return removing_ && n.id() == removed_;
+	}
+
+	Graph& g_;
+	node_state_size_t states_;
+	/// distributions by kind and state, the last one for all states
+	std::vector<degree_dist_t> hist_[kinds];
+	/// node being removed, whose edge removals are ignored
+	bool removing_;
+	node_id_t removed_;
+};
+
+}
+}
+
+#endif /* DEGREEHISTOGRAM_H_ */
@@ -0,0 +1,199 @@
+/**
+ * @file TripleCounter.cpp
+ * @date 18.10.2026
+ */
+
+#include "TripleCounter.h"
+#include <largenet2/base/Graph.h>
+#include <stdexcept>
+#include <algorithm>
+
+namespace largenet
+{
+namespace measures
+{
+
+TripleCounter::TripleCounter(Graph& g) :
+	g_(g), states_(g.numberOfNodeStates()), motifs_(states_, false)
+{
+	rebuild();
+	g_.addGraphListener(this);
+}
+
+TripleCounter::~TripleCounter()
+{
+	g_.removeGraphListener(this);
+}
+
+std::size_t TripleCounter::count(const motifs::TripleMotif& t) const
+{
+	if (t.isDirected())
+		throw std::invalid_argument(
+				"TripleCounter only counts undirected triples.");
+	if (t.left() >= states_ || t.center() >= states_ || t.right() >= states_)
+		throw std::out_of_range("Node state out of range.");
+	return triples_[index(t.left(), t.center(), t.right())];
+}
+
+bool TripleCounter::counts(const Edge& e) const
+{
+	return !e.isDirected() && !e.isLoop();
+}
+
+void TripleCounter::rebuild()
+{
+	triples_.assign(states_ * states_ * states_, 0);
+	neighbors_.assign(g_.numberOfNodes() > 0 ? (g_.maxNodeID() + 1)
+			* states_ : 0, 0);
+	Graph::EdgeIteratorRange edges = g_.edges();
+	for (Graph::EdgeIterator e = edges.first; e != edges.second; ++e)
+	{
+		if (!counts(*e))
+			continue;
+		const node_id_t u = e->source()->id(), v = e->target()->id();
+		++neighbors(u)[g_.nodeState(v)];
+		++neighbors(v)[g_.nodeState(u)];
+	}
+	Graph::NodeIteratorRange nodes = g_.nodes();
+	for (Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+	{
+		const std::size_t* m = neighbors(n.id());
+		const node_state_t c = g_.nodeState(n.id());
+		for (node_state_t a = 0; a < states_; ++a)
+			for (node_state_t b = a; b < states_; ++b)
+				triples_[index(a, c, b)] += pairs(m, a, b);
+	}
+}
+
+void TripleCounter::addNeighbor(const node_id_t center, const node_state_t s)
+{
+	addNeighbor(center, g_.nodeState(center), s);
+}
+
+void TripleCounter::addNeighbor(const node_id_t center, const node_state_t c,
+		const node_state_t s)
+{
+	std::size_t* m = neighbors(center);
+	// the new neighbor forms a triple with each existing one
+	for (node_state_t a = 0; a < states_; ++a)
+		triples_[index(a, c, s)] += m[a];
+	++m[s];
+}
+
+void TripleCounter::removeNeighbor(const node_id_t center,
+		const node_state_t s)
+{
+	removeNeighbor(center, g_.nodeState(center), s);
+}
+
+void TripleCounter::removeNeighbor(const node_id_t center,
+		const node_state_t c, const node_state_t s)
+{
+	std::size_t* m = neighbors(center);
+	--m[s];
+	for (node_state_t a = 0; a < states_; ++a)
+		triples_[index(a, c, s)] -= m[a];
+}
+
+void TripleCounter::moveCenter(const node_id_t n, const node_state_t oldState,
+		const node_state_t newState)
+{
+	const std::size_t* m = neighbors(n);
+	for (node_state_t a = 0; a < states_; ++a)
+		for (node_state_t b = a; b < states_; ++b)
+		{
+			const std::size_t p = pairs(m, a, b);
+			triples_[index(a, oldState, b)] -= p;
+			triples_[index(a, newState, b)] += p;
+		}
+}
+
+void TripleCounter::afterNodeAddEvent(Graph&, Node& n)
+{
+	const std::size_t end = (n.id() + 1) * states_;
+	if (neighbors_.size() < end)
+		neighbors_.resize(end, 0);
+	std::fill(neighbors(n.id()), neighbors(n.id()) + states_, 0);
+}
+
+void TripleCounter::afterEdgeAddEvent(Graph& g, Edge& e)
+{
+	if (!counts(e))
+		return;
+	const node_id_t u = e.source()->id(), v = e.target()->id();
+	addNeighbor(u, g.nodeState(v));
+	addNeighbor(v, g.nodeState(u));
+}
+
+void TripleCounter::beforeEdgeRemoveEvent(Graph& g, Edge& e)
+{
+	if (!counts(e))
+		return;
+	const node_id_t u = e.source()->id(), v = e.target()->id();
+	removeNeighbor(u, g.nodeState(v));
+	removeNeighbor(v, g.nodeState(u));
+}
+
+void TripleCounter::beforeGraphClearEvent(Graph&)
+{
+	triples_.assign(triples_.size(), 0);
+	neighbors_.clear();
+}
+
+void TripleCounter::afterNodeStateChangeEvent(Graph&, Node& n,
+		const node_state_t oldState, const node_state_t newState)
+{
+	// triples centered at n change their center state
+	moveCenter(n.id(), oldState, newState);
+	// triples with n at an end change their end state
+	Node::edge_iterator_range un = n.undirectedEdges();
+	for (Node::edge_iterator e = un.first; e != un.second; ++e)
+	{
+		if (!counts(**e))
+			continue;
+		const node_id_t nb = (*e)->opposite(n)->id();
+		removeNeighbor(nb, oldState);
+		addNeighbor(nb, newState);
+	}
+}
+
+void TripleCounter::afterNodeStatesRebuildEvent(Graph& g,
+		const std::vector<node_state_t>& oldStates)
+{
+	std::vector<node_id_t> changed;
+	Graph::NodeIteratorRange nodes = g.nodes();
+	for (Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+		if (oldStates[n.id()] != g.nodeState(n.id()))
+			changed.push_back(n.id());
+	// recounting is cheaper if most nodes changed
+	if (2 * changed.size() > g.numberOfNodes())
+	{
+		rebuild();
+		return;
+	}
+	// Apply the single node updates in order of node IDs. Until its turn,
+	// a changed node still counts with its old state.
+	std::sort(changed.begin(), changed.end());
+	for (std::vector<node_id_t>::const_iterator it = changed.begin(); it
+			!= changed.end(); ++it)
+	{
+		const node_state_t oldState = oldStates[*it], newState =
+				g.nodeState(*it);
+		moveCenter(*it, oldState, newState);
+		Node& n = *g.node(*it);
+		Node::edge_iterator_range un = n.undirectedEdges();
+		for (Node::edge_iterator e = un.first; e != un.second; ++e)
+		{
+			if (!counts(**e))
+				continue;
+			const node_id_t nb = (*e)->opposite(n)->id();
+			const node_state_t c = nb > *it && oldStates[nb] != g.nodeState(nb)
+					? oldStates[nb] : g.nodeState(nb);
+			removeNeighbor(nb, c, oldState);
+			addNeighbor(nb, c, newState);
+		}
+	}
+}
+
+}
+}
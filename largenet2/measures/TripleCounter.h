@@ -0,0 +1,106 @@
+/**
+ * @file TripleCounter.h
+ * @date 18.10.2026
+ */
+
+#ifndef TRIPLECOUNTER_H_
+#define TRIPLECOUNTER_H_
+
+#include <largenet2/base/GraphListener.h>
+#include <largenet2/motifs/motifs.h>
+#include <boost/noncopyable.hpp>
+#include <vector>
+#include <cstddef>
+
+namespace largenet
+{
+namespace measures
+{
+
+/**
+ * Incrementally maintained counts of all undirected triple motifs.
+ *
+ * The counter listens to its Graph and keeps, for every node, the number of
+ * undirected neighbors in each state. From these, the triple counts are
+ * updated in O(S) time when an edge is added or removed, and in
+ * O(k S + S^2) time when a node of degree k changes its state, where S is
+ * the number of node states. Bulk state changes by Graph::setNodeStates()
+ * are applied node by node for the changed nodes, unless most nodes
+ * changed, in which case all triples are recounted. count() then takes constant time, instead of
+ * the O(sum k^2) of triples(const Graph&, const motifs::TripleMotif&), with
+ * which it agrees on graphs without multiple edges and self-loops.
+ *
+ * Only undirected edges form undirected triples, as in triples(). Directed
+ * triple motifs are not maintained.
+ */
+class TripleCounter: public GraphListener, public boost::noncopyable
+{
+public:
+	/// Count the triples of @p g and register with it.
+	explicit TripleCounter(Graph& g);
+	/// Unregister from the graph.
+	virtual ~TripleCounter();
+
+	/// The undirected triple motifs of the graph's node states.
+	const motifs::TripleMotifSet& motifs() const
+	{
+		return motifs_;
+	}
+	/**
+	 * Number of triples of undirected motif @p t.
+	 * @throw std::invalid_argument if @p t is directed
+	 */
+	std::size_t count(const motifs::TripleMotif& t) const;
+	/// Recount all triples from scratch.
+	void rebuild();
+
+private:
+	void afterNodeAddEvent(Graph& g, Node& n);
+	void afterEdgeAddEvent(Graph& g, Edge& e);
+	void beforeEdgeRemoveEvent(Graph& g, Edge& e);
+	void beforeGraphClearEvent(Graph& g);
+	void afterNodeStateChangeEvent(Graph& g, Node& n, node_state_t oldState,
+			node_state_t newState);
+	void afterNodeStatesRebuildEvent(Graph& g,
+			const std::vector<node_state_t>& oldStates);
+
+	/// index of motif (a, center, b) with a <= b
+	std::size_t index(node_state_t a, node_state_t center, node_state_t b) const
+	{
+		if (a > b)
+			std::swap(a, b);
+		return (center * states_ + a) * states_ + b;
+	}
+	/// neighbor state counts of node @p n
+	std::size_t* neighbors(node_id_t n)
+	{
+		return &neighbors_[n * states_];
+	}
+	/// number of neighbor pairs of states @p a and @p b for counts @p m
+	static std::size_t pairs(const std::size_t* m, node_state_t a,
+			node_state_t b)
+	{
+		if (a != b)
+			return m[a] * m[b];
+		return m[a] > 1 ? m[a] * (m[a] - 1) / 2 : 0;
+	}
+	void addNeighbor(node_id_t center, node_state_t s);
+	void removeNeighbor(node_id_t center, node_state_t s);
+	/// as above, with the center node counted in state @p c
+	void addNeighbor(node_id_t center, node_state_t c, node_state_t s);
+	void removeNeighbor(node_id_t center, node_state_t c, node_state_t s);
+	/// move the triples centered at @p n to another center state
+	void moveCenter(node_id_t n, node_state_t oldState, node_state_t newState);
+	bool counts(const Edge& e) const;
+
+	Graph& g_;
+	node_state_size_t states_;
+	motifs::TripleMotifSet motifs_;
+	std::vector<std::size_t> triples_;
+	std::vector<std::size_t> neighbors_;
+};
+
+}
+}
+
+#endif /* TRIPLECOUNTER_H_ */
@@ -0,0 +1,127 @@
+/**
+ * @file mapped_measures.cpp
+ * @date 18.10.2026
+ */
+
+#include "mapped_measures.h"
+
+namespace largenet
+{
+namespace measures
+{
+
+namespace
+{
+
+typedef degree_t (io::MappedGraph::*degree_func_t)(node_id_t) const;
+
+degree_range_t degreeRange(const io::MappedGraph& g, const degree_func_t deg)
+{
+	degree_t min = g.numberOfEdges(), max = 0;
+	for (node_id_t n = 0; n < g.numberOfNodes(); ++n)
+	{
+		const degree_t k = (g.*deg)(n);
+		if (min > k)
+			min = k;
+		if (max < k)
+			max = k;
+	}
+	return std::make_pair(min, max);
+}
+
+}
+
+degree_t maxInDegree(const io::MappedGraph& g)
+{
+	return inDegreeRange(g).second;
+}
+
+degree_t minInDegree(const io::MappedGraph& g)
+{
+	return inDegreeRange(g).first;
+}
+
+degree_range_t inDegreeRange(const io::MappedGraph& g)
+{
+	return degreeRange(g, &io::MappedGraph::inDegree);
+}
+
+degree_t maxOutDegree(const io::MappedGraph& g)
+{
+	return outDegreeRange(g).second;
+}
+
+degree_t minOutDegree(const io::MappedGraph& g)
+{
+	return outDegreeRange(g).first;
+}
+
+degree_range_t outDegreeRange(const io::MappedGraph& g)
+{
+	return degreeRange(g, &io::MappedGraph::outDegree);
+}
+
+std::size_t edges(const io::MappedGraph& net, const motifs::LinkMotif& l)
+{
+	std::size_t count = 0;
+	for (node_id_t n = 0; n < net.numberOfNodes(); ++n)
+	{
+		if (net.nodeState(n) != l.source())
+			continue;
+		io::MappedGraph::NeighborIteratorRange nb = l.isDirected()
+				? net.outNeighbors(n) : net.undirectedNeighbors(n);
+		for (; nb.first != nb.second; ++nb.first)
+			if (net.nodeState(*nb.first) == l.target())
+				++count;
+	}
+	if (l.isSymmetric())
+		count /= 2;
+	return count;
+}
+
+std::size_t triples(const io::MappedGraph& net)
+{
+	std::size_t t = 0;
+	for (node_id_t n = 0; n < net.numberOfNodes(); ++n)
+	{
+		const degree_t d = net.degree(n);
+		if (d > 1)
+			t += d * (d - 1) - 2 * net.mutualDegree(n); // do not count 2-loops as triples
+	}
+	return t / 2;
+}
+
+std::size_t outTriples(const io::MappedGraph& net)
+{
+	std::size_t t = 0;
+	for (node_id_t n = 0; n < net.numberOfNodes(); ++n)
+	{
+		const degree_t d = net.outDegree(n);
+		if (d > 1)
+			t += d * (d - 1);
+	}
+	return t / 2;
+}
+
+std::size_t inTriples(const io::MappedGraph& net)
+{
+	std::size_t t = 0;
+	for (node_id_t n = 0; n < net.numberOfNodes(); ++n)
+	{
+		const degree_t d = net.inDegree(n);
+		if (d > 1)
+			t += d * (d - 1);
+	}
+	return t / 2;
+}
+
+std::size_t inOutTriples(const io::MappedGraph& net)
+{
+	std::size_t t = 0;
+	for (node_id_t n = 0; n < net.numberOfNodes(); ++n)
+		t += net.inDegree(n) * net.outDegree(n) - net.mutualDegree(n);
+	return t;
+}
+
+}
+}
@@ -0,0 +1,61 @@
+/**
+ * @file mapped_measures.h
+ * @date 18.10.2026
+ */
+
+#ifndef MAPPED_MEASURES_H_
+#define MAPPED_MEASURES_H_
+
+#include <largenet2/io/MappedGraph.h>
+#include <largenet2/measures/measures.h>
+#include <largenet2/motifs/LinkMotif.h>
+#include <cstddef>
+
+namespace largenet
+{
+/**
+ * Overloads of the degree-based measures in measures.h and counts.h for
+ * read-only io::MappedGraph views, computed directly on the mapped file.
+ *
+ * They are declared in this separate header so that taking the address of
+ * the Graph versions (e.g. to pass them as function objects) stays
+ * unambiguous in code that does not use MappedGraph.
+ */
+namespace measures
+{
+
+degree_t maxInDegree(const io::MappedGraph& g);
+degree_t minInDegree(const io::MappedGraph& g);
+degree_range_t inDegreeRange(const io::MappedGraph& g);
+degree_t maxOutDegree(const io::MappedGraph& g);
+degree_t minOutDegree(const io::MappedGraph& g);
+degree_range_t outDegreeRange(const io::MappedGraph& g);
+inline double meanDegree(const io::MappedGraph& g)
+{
+	return static_cast<double> (g.numberOfEdges()) / g.numberOfNodes();
+}
+
+inline std::size_t nodes(const io::MappedGraph& net)
+{
+	return net.numberOfNodes();
+}
+inline std::size_t nodes(const io::MappedGraph& net, const node_state_t s)
+{
+	return net.numberOfNodes(s);
+}
+inline std::size_t edges(const io::MappedGraph& net)
+{
+	return net.numberOfEdges();
+}
+/// number of edges of type @p l
+std::size_t edges(const io::MappedGraph& net, const motifs::LinkMotif& l);
+/// number of triples, see triples(const Graph&)
+std::size_t triples(const io::MappedGraph& net);
+std::size_t inTriples(const io::MappedGraph& net);
+std::size_t outTriples(const io::MappedGraph& net);
+std::size_t inOutTriples(const io::MappedGraph& net);
+
+}
+}
+
+#endif /* MAPPED_MEASURES_H_ */
@@ -23,7 +23,16 @@ public:
 	}
 
 	virtual ~SimApp()
-	{ // actually, this is not necessary
+	{
+		// pending asynchronous output must reach the streams before they
+		// close; exec() should have called flushOutput() to see write errors
+		try
+		{
+			outputter_.flush();
+		} catch (...)
+		{
+		}
+		// actually, this is not necessary
 		for (ofstream_ptr_v::iterator i = outStreams_.begin(); i
 				!= outStreams_.end(); ++i)
 			i->close();
@@ -68,6 +77,16 @@ protected:
 		outputter_.addOutput(output);
 	}
 
+	/**
+	 * Write record outputs from a background thread, with at most
+	 * @p capacity records in flight (0 for synchronous output).
+	 * @see output::Outputter::setAsync()
+	 */
+	void setAsyncOutput(std::size_t capacity)
+	{
+		outputter_.setAsync(capacity);
+	}
+
 	void writeHeaders()
 	{
 		outputter_.writeHeaders();
@@ -78,6 +97,16 @@ protected:
 		outputter_.output(t, force);
 	}
 
+	/**
+	 * Wait until all asynchronous output has been written. Call this at the
+	 * end of exec(), as errors are not reported from the destructor.
+	 * @throw std::runtime_error if asynchronous writing failed
+	 */
+	void flushOutput()
+	{
+		outputter_.flush();
+	}
+
 private:
 	std::string appName_;
 	output::Outputter outputter_;
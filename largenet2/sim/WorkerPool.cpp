@@ -0,0 +1,69 @@
+/**
+ * @file WorkerPool.cpp
+ * @date 18.10.2026
+ */
+
+#include "WorkerPool.h"
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace sim
+{
+
+WorkerPool::WorkerPool(const unsigned int size) :
+	size_(std::max(size, 1u)), stop_(false), start_(size_), finish_(size_),
+			barrier_(size_)
+{
+	for (unsigned int w = 1; w < size_; ++w)
+		threads_.create_thread(boost::bind(&WorkerPool::loop, this, w));
+}
+
+WorkerPool::~WorkerPool()
+{
+	// the barrier publishes stop_ to the waiting workers
+	stop_ = true;
+	if (size_ > 1)
+		start_.wait();
+	threads_.join_all();
+}
+
+void WorkerPool::run(const Job& job)
+{
+	job_ = job;
+	error_.clear();
+	if (size_ > 1)
+		start_.wait();
+	call(0);
+	if (size_ > 1)
+		finish_.wait();
+	job_.clear();
+	if (!error_.empty())
+		throw std::runtime_error("Worker failed: " + error_);
+}
+
+void WorkerPool::loop(const unsigned int worker)
+{
+	while (true)
+	{
+		start_.wait();
+		if (stop_)
+			return;
+		call(worker);
+		finish_.wait();
+	}
+}
+
+void WorkerPool::call(const unsigned int worker)
+{
+	try
+	{
+		job_(worker);
+	} catch (std::exception& e)
+	{
+		boost::mutex::scoped_lock lock(mutex_);
+		error_ = e.what();
+	}
+}
+
+}
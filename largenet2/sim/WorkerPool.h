@@ -0,0 +1,75 @@
+/**
+ * @file WorkerPool.h
+ * @date 18.10.2026
+ */
+
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+#include <boost/noncopyable.hpp>
+#include <boost/function.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/barrier.hpp>
+#include <string>
+
+namespace sim
+{
+
+/**
+ * Fixed set of threads running one parallel job at a time.
+ *
+ * The threads are started on construction and wait between jobs, so that
+ * engines doing many short parallel steps do not create threads in every
+ * step. run() calls the job with each worker index from 0 to size() - 1,
+ * index 0 on the calling thread, and returns when all workers have
+ * finished. Within a job, the workers can wait for each other on barrier().
+ *
+ * An exception thrown by the job is rethrown from run() as
+ * std::runtime_error; workers waiting on barrier() for the failed one are
+ * not released, so jobs using barrier() must not throw.
+ */
+class WorkerPool: public boost::noncopyable
+{
+public:
+	typedef boost::function<void(unsigned int)> Job;
+
+	/**
+	 * Constructor
+	 * @param size number of workers, including the calling thread
+	 */
+	explicit WorkerPool(unsigned int size);
+	/// Stop the worker threads.
+	~WorkerPool();
+
+	unsigned int size() const
+	{
+		return size_;
+	}
+	/**
+	 * Run @p job on all workers and wait until it has finished.
+	 * @throw std::runtime_error if the job threw on any worker
+	 */
+	void run(const Job& job);
+	/// Barrier for all size() workers of a job
+	boost::barrier& barrier()
+	{
+		return barrier_;
+	}
+
+private:
+	void loop(unsigned int worker);
+	void call(unsigned int worker);
+
+	unsigned int size_;
+	Job job_;
+	bool stop_;
+	std::string error_;
+	boost::mutex mutex_;
+	boost::barrier start_, finish_, barrier_;
+	boost::thread_group threads_;
+};
+
+}
+
+#endif /* WORKERPOOL_H_ */
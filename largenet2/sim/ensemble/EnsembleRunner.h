@@ -0,0 +1,290 @@
+/**
+ * @file EnsembleRunner.h
+ * @date 18.10.2026
+ */
+
+#ifndef ENSEMBLERUNNER_H_
+#define ENSEMBLERUNNER_H_
+
+#include <largenet2/sim/ensemble/Replica.h>
+#include <largenet2/sim/ensemble/EnsembleStatistics.h>
+#include <largenet2/sim/seeds.h>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+#include <deque>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <memory>
+#include <stdexcept>
+
+namespace sim
+{
+namespace ensemble
+{
+
+namespace detail
+{
+
+/**
+ * One task deque per worker. Workers take tasks from the back of their own
+ * deque and, once it is empty, steal from the front of the others.
+ */
+class WorkStealingQueues: public boost::noncopyable
+{
+public:
+	explicit WorkStealingQueues(unsigned int workers)
+	{
+		for (unsigned int i = 0; i < workers; ++i)
+			queues_.push_back(new Queue);
+	}
+	void push(unsigned int worker, unsigned int task)
+	{
+		Queue& q = queues_[worker];
+		boost::mutex::scoped_lock lock(q.mutex);
+		q.tasks.push_back(task);
+	}
+	/**
+	 * Get the next task for @p worker.
+	 * @return false if no task is left in any queue
+	 */
+	bool pop(unsigned int worker, unsigned int& task)
+	{
+		{
+			Queue& q = queues_[worker];
+			boost::mutex::scoped_lock lock(q.mutex);
+			if (!q.tasks.empty())
+			{
+				task = q.tasks.back();
+				q.tasks.pop_back();
+				return true;
+			}
+		}
+		for (unsigned int i = 1; i < queues_.size(); ++i)
+		{
+			Queue& q = queues_[(worker + i) % queues_.size()];
+			boost::mutex::scoped_lock lock(q.mutex);
+			if (!q.tasks.empty())
+			{
+				task = q.tasks.front();
+				q.tasks.pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+
+private:
+	struct Queue
+	{
+		boost::mutex mutex;
+		std::deque<unsigned int> tasks;
+	};
+	boost::ptr_vector<Queue> queues_;
+};
+
+}
+
+/**
+ * Run an ensemble of independent replicas of a simulation in parallel.
+ *
+ * Replicas are created on demand by a ReplicaFactory, which is called with
+ * the replica index and a seed for its random number generator. Seeds are
+ * derived from a single ensemble seed by the SplitMix64 mixing function, so
+ * that each replica has its own random number stream and the ensemble is
+ * reproducible regardless of the number of threads.
+ *
+ * The replicas are distributed over a pool of worker threads with work
+ * stealing, so that long-running replicas do not leave threads idle. Each
+ * replica is run until @p tmax (or until it has stopped) and its observables
+ * are recorded on the common time grid @f$0, \Delta t, 2\Delta t, \ldots@f$.
+ * Observables are evaluated after every step, so that each grid point gets
+ * exactly the state the replica was in at that time. If a replica stops
+ * early, its final state is recorded for all remaining grid points. The resulting
+ * EnsembleStatistics is kept in memory.
+ *
+ * Example:
+ * @code
+ * Replica* makeReplica(unsigned int i, unsigned long seed);
+ *
+ * EnsembleRunner runner(makeReplica, 2, 1000, 1);
+ * runner.setSeed(42);
+ * runner.run(500);
+ * runner.statistics().write(std::cout);
+ * @endcode
+ *
+ * The factory is called concurrently from several threads and must
+ * therefore be thread-safe.
+ */
+class EnsembleRunner: public boost::noncopyable
+{
+public:
+	typedef boost::function<Replica*(unsigned int, unsigned long)> ReplicaFactory;
+
+	/**
+	 * Constructor
+	 * @param factory creates replica @p i using random seed @p seed
+	 * @param observables number of observables per replica
+	 * @param tmax simulation time of each replica
+	 * @param interval time grid spacing
+	 */
+	EnsembleRunner(const ReplicaFactory& factory, unsigned int observables,
+			double tmax, double interval) :
+			factory_(factory), observables_(observables), tmax_(tmax), interval_(
+					interval), threads_(
+					boost::thread::hardware_concurrency()), seed_(0), storeSamples_(
+					false), stats_(0, observables, interval)
+	{
+		if (interval <= 0 || tmax < 0)
+			throw std::invalid_argument(
+					"Time grid needs positive interval and non-negative tmax");
+		if (threads_ == 0)
+			threads_ = 1;
+	}
+
+	void setThreads(unsigned int n)
+	{
+		threads_ = n > 0 ? n : 1;
+	}
+	unsigned int threads() const
+	{
+		return threads_;
+	}
+	void setSeed(unsigned long seed)
+	{
+		seed_ = seed;
+	}
+	unsigned long seed() const
+	{
+		return seed_;
+	}
+	/**
+	 * Keep all samples in the statistics so that quantiles can be computed.
+	 */
+	void setStoreSamples(bool store)
+	{
+		storeSamples_ = store;
+	}
+	unsigned int gridPoints() const
+	{
+		return static_cast<unsigned int>(tmax_ / interval_ + 1e-9) + 1;
+	}
+
+	/**
+	 * Run @p replicas replicas and collect their statistics.
+	 * @return ensemble statistics
+	 */
+	const EnsembleStatistics& run(unsigned int replicas)
+	{
+		const unsigned int workers = std::min(threads_,
+				std::max(replicas, 1u));
+		detail::WorkStealingQueues queues(workers);
+		for (unsigned int r = 0; r < replicas; ++r)
+			queues.push(r % workers, r);
+
+		boost::ptr_vector<EnsembleStatistics> partial;
+		for (unsigned int w = 0; w < workers; ++w)
+			partial.push_back(
+					new EnsembleStatistics(gridPoints(), observables_,
+							interval_, storeSamples_));
+
+		error_.clear();
+		boost::thread_group pool;
+		for (unsigned int w = 0; w < workers; ++w)
+			pool.create_thread(
+					boost::bind(&EnsembleRunner::work, this, w,
+							boost::ref(queues), boost::ref(partial[w])));
+		pool.join_all();
+		if (!error_.empty())
+			throw std::runtime_error("Replica failed: " + error_);
+
+		stats_ = partial[0];
+		for (unsigned int w = 1; w < workers; ++w)
+			stats_.merge(partial[w]);
+		return stats_;
+	}
+
+	/**
+	 * Statistics of the last run.
+	 */
+	const EnsembleStatistics& statistics() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * Random seed for replica @p replica, derived from the ensemble seed
+	 * @p seed by SplitMix64.
+	 */
+	static unsigned long replicaSeed(unsigned long seed, unsigned int replica)
+	{
+		return deriveSeed(seed, replica);
+	}
+
+private:
+	void work(unsigned int worker, detail::WorkStealingQueues& queues,
+			EnsembleStatistics& stats)
+	{
+		unsigned int r;
+		while (queues.pop(worker, r))
+		{
+			try
+			{
+				runReplica(r, stats);
+			} catch (std::exception& e)
+			{
+				boost::mutex::scoped_lock lock(errorMutex_);
+				if (error_.empty())
+					error_ = e.what();
+				return;
+			}
+		}
+	}
+
+	void runReplica(unsigned int r, EnsembleStatistics& stats)
+	{
+		std::auto_ptr<Replica> rep(factory_(r, replicaSeed(seed_, r)));
+		if (rep.get() == 0)
+			throw std::runtime_error("Replica factory returned null");
+
+		const unsigned int points = stats.gridPoints();
+		std::vector<double> values(observables_);
+		rep->outputter().writeHeaders();
+		double t = 0;
+		unsigned int g = 0;
+		// values always hold the state on [t, t + tau)
+		rep->observe(values);
+		while (!rep->stopped())
+		{
+			rep->outputter().output(t);
+			t += rep->step();
+			while (g < points && stats.time(g) < t)
+				stats.add(g++, values);
+			if (g == points)
+				break;
+			rep->observe(values);
+		}
+		while (g < points)
+			stats.add(g++, values);
+		rep->outputter().output(t, true);
+	}
+
+	ReplicaFactory factory_;
+	unsigned int observables_;
+	double tmax_, interval_;
+	unsigned int threads_;
+	unsigned long seed_;
+	bool storeSamples_;
+	EnsembleStatistics stats_;
+	boost::mutex errorMutex_;
+	std::string error_;
+};
+
+}
+}
+
+#endif /* ENSEMBLERUNNER_H_ */
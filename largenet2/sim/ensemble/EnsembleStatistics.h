@@ -0,0 +1,196 @@
+/**
+ * @file EnsembleStatistics.h
+ * @date 18.10.2026
+ */
+
+#ifndef ENSEMBLESTATISTICS_H_
+#define ENSEMBLESTATISTICS_H_
+
+#include <vector>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <cmath>
+#include <stdexcept>
+
+namespace sim
+{
+namespace ensemble
+{
+
+/**
+ * Ensemble statistics of a set of observables on a common time grid.
+ *
+ * Grid point @f$g@f$ corresponds to time @f$g\Delta t@f$. For each grid point
+ * and observable, mean and variance are accumulated with Welford's online
+ * algorithm. If samples are stored, quantiles are available as well; this
+ * needs memory proportional to the number of replicas.
+ *
+ * Partial statistics (e.g. from different worker threads) are combined with
+ * merge().
+ */
+class EnsembleStatistics
+{
+public:
+	/**
+	 * Constructor
+	 * @param gridPoints number of time grid points
+	 * @param observables number of observables per grid point
+	 * @param interval time between grid points
+	 * @param storeSamples keep all samples to allow for quantiles
+	 */
+	EnsembleStatistics(unsigned int gridPoints, unsigned int observables,
+			double interval, bool storeSamples = false) :
+			gridPoints_(gridPoints), observables_(observables), interval_(
+					interval), storeSamples_(storeSamples), n_(gridPoints, 0), mean_(
+					gridPoints * observables, 0.0), m2_(
+					gridPoints * observables, 0.0), samples_(
+					storeSamples ? gridPoints * observables : 0)
+	{
+	}
+
+	/**
+	 * Add the observable values of one replica at grid point @p g.
+	 */
+	void add(unsigned int g, const std::vector<double>& values)
+	{
+		if (g >= gridPoints_ || values.size() != observables_)
+			throw std::out_of_range("Grid point or number of values out of range");
+		const double n = ++n_[g];
+		for (unsigned int o = 0; o < observables_; ++o)
+		{
+			const unsigned int i = index(g, o);
+			const double delta = values[o] - mean_[i];
+			mean_[i] += delta / n;
+			m2_[i] += delta * (values[o] - mean_[i]);
+			if (storeSamples_)
+				samples_[i].push_back(values[o]);
+		}
+	}
+
+	/**
+	 * Add the statistics in @p other to this object.
+	 */
+	void merge(const EnsembleStatistics& other)
+	{
+		if (other.gridPoints_ != gridPoints_ || other.observables_
+				!= observables_ || other.storeSamples_ != storeSamples_)
+			throw std::invalid_argument("Incompatible ensemble statistics");
+		for (unsigned int g = 0; g < gridPoints_; ++g)
+		{
+			const double na = n_[g], nb = other.n_[g];
+			if (nb == 0)
+				continue;
+			const double n = na + nb;
+			for (unsigned int o = 0; o < observables_; ++o)
+			{
+				const unsigned int i = index(g, o);
+				const double delta = other.mean_[i] - mean_[i];
+				mean_[i] += delta * nb / n;
+				m2_[i] += other.m2_[i] + delta * delta * na * nb / n;
+				if (storeSamples_)
+					samples_[i].insert(samples_[i].end(),
+							other.samples_[i].begin(), other.samples_[i].end());
+			}
+			n_[g] += other.n_[g];
+		}
+	}
+
+	unsigned int gridPoints() const
+	{
+		return gridPoints_;
+	}
+	unsigned int observables() const
+	{
+		return observables_;
+	}
+	double time(unsigned int g) const
+	{
+		return g * interval_;
+	}
+	bool hasSamples() const
+	{
+		return storeSamples_;
+	}
+	/**
+	 * Number of samples at grid point @p g.
+	 */
+	unsigned long count(unsigned int g) const
+	{
+		return n_.at(g);
+	}
+	double mean(unsigned int g, unsigned int o) const
+	{
+		return mean_.at(index(g, o));
+	}
+	/**
+	 * Unbiased sample variance of observable @p o at grid point @p g.
+	 */
+	double variance(unsigned int g, unsigned int o) const
+	{
+		const unsigned long n = count(g);
+		return n > 1 ? m2_.at(index(g, o)) / (n - 1) : 0.0;
+	}
+	/**
+	 * Quantile @p p of observable @p o at grid point @p g, with linear
+	 * interpolation between order statistics. Only available if samples
+	 * are stored.
+	 */
+	double quantile(unsigned int g, unsigned int o, double p) const
+	{
+		if (!storeSamples_)
+			throw std::logic_error("Quantiles need stored samples");
+		if (p < 0 || p > 1)
+			throw std::invalid_argument("Quantile must be in [0,1]");
+		std::vector<double> s(samples_.at(index(g, o)));
+		if (s.empty())
+			return 0.0;
+		const double pos = p * (s.size() - 1);
+		const std::vector<double>::size_type lo =
+				static_cast<std::vector<double>::size_type>(std::floor(pos));
+		std::nth_element(s.begin(), s.begin() + lo, s.end());
+		const double a = s[lo];
+		if (lo + 1 >= s.size())
+			return a;
+		const double b = *std::min_element(s.begin() + lo + 1, s.end());
+		return a + (pos - lo) * (b - a);
+	}
+
+	/**
+	 * Write the statistics as tab-separated columns, one grid point per
+	 * line: time, number of samples, and mean and variance of each
+	 * observable.
+	 */
+	void write(std::ostream& out, const std::string& commentChar = "#") const
+	{
+		out << commentChar << " t\tn";
+		for (unsigned int o = 0; o < observables_; ++o)
+			out << "\tmean" << o << "\tvar" << o;
+		out << "\n";
+		for (unsigned int g = 0; g < gridPoints_; ++g)
+		{
+			out << time(g) << "\t" << count(g);
+			for (unsigned int o = 0; o < observables_; ++o)
+				out << "\t" << mean(g, o) << "\t" << variance(g, o);
+			out << "\n";
+		}
+	}
+
+private:
+	unsigned int index(unsigned int g, unsigned int o) const
+	{
+		return g * observables_ + o;
+	}
+
+	unsigned int gridPoints_, observables_;
+	double interval_;
+	bool storeSamples_;
+	std::vector<unsigned long> n_;
+	std::vector<double> mean_, m2_;
+	std::vector<std::vector<double> > samples_;
+};
+
+}
+}
+
+#endif /* ENSEMBLESTATISTICS_H_ */
@@ -0,0 +1,90 @@
+/**
+ * @file Replica.h
+ * @date 18.10.2026
+ */
+
+#ifndef REPLICA_H_
+#define REPLICA_H_
+
+#include <largenet2/sim/output/Outputter.h>
+#include <boost/noncopyable.hpp>
+#include <vector>
+
+namespace sim
+{
+namespace ensemble
+{
+
+/**
+ * A single realization of a stochastic model within an ensemble.
+ *
+ * A Replica owns everything it needs to run independently of all other
+ * replicas: its Graph, its model, its random number generator and its
+ * Outputter. Replicas are created by the EnsembleRunner through a factory,
+ * which receives a seed for an independent random number stream, and are
+ * executed on worker threads. Implementations must therefore not share
+ * mutable state with other replicas.
+ *
+ * Derived classes implement
+ * @code
+ * double doStep();                           // one model step, returns time increment
+ * bool doStopped() const;                    // true if no further change is possible
+ * void doObserve(std::vector<double>& values) const; // current observables
+ * @endcode
+ */
+class Replica: public boost::noncopyable
+{
+public:
+	virtual ~Replica()
+	{
+	}
+	/**
+	 * Perform one simulation step.
+	 * @return time increment
+	 */
+	double step()
+	{
+		return doStep();
+	}
+	/**
+	 * Check whether the simulation has stopped, i.e., has reached an
+	 * absorbing state.
+	 */
+	bool stopped() const
+	{
+		return doStopped();
+	}
+	/**
+	 * Write the current values of the ensemble observables into @p values.
+	 * @p values has as many elements as there are observables in the
+	 * ensemble.
+	 */
+	void observe(std::vector<double>& values) const
+	{
+		doObserve(values);
+	}
+	/**
+	 * Per-replica outputs. These are driven by the EnsembleRunner in
+	 * addition to the in-memory ensemble statistics; most replicas will
+	 * leave this empty.
+	 */
+	output::Outputter& outputter()
+	{
+		return outputter_;
+	}
+
+private:
+	virtual double doStep() = 0;
+	virtual bool doStopped() const
+	{
+		return false;
+	}
+	virtual void doObserve(std::vector<double>& values) const = 0;
+
+	output::Outputter outputter_;
+};
+
+}
+}
+
+#endif /* REPLICA_H_ */
@@ -0,0 +1,306 @@
+/**
+ * @file NonMarkovianEpidemic.h
+ * @date 18.10.2026
+ */
+
+#ifndef NONMARKOVIANEPIDEMIC_H_
+#define NONMARKOVIANEPIDEMIC_H_
+
+#include <largenet2/base/Graph.h>
+#include <largenet2/base/GraphListener.h>
+#include <largenet2/base/Node.h>
+#include <largenet2/base/Edge.h>
+#include <boost/heap/pairing_heap.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <vector>
+#include <limits>
+#include <stdexcept>
+
+namespace sim
+{
+namespace event
+{
+
+/**
+ * Event-driven simulation of SIR and SIS epidemics with arbitrary
+ * (non-exponential) infection and recovery time distributions.
+ *
+ * When a node becomes infected at time @f$t@f$, its recovery is scheduled at
+ * @f$t + \tau_r@f$, and for each of its outgoing or undirected edges a
+ * transmission attempt is scheduled at @f$t + \tau_i@f$. Attempts along an
+ * edge form a renewal process: after each attempt, the next one is drawn,
+ * until the source node recovers. An attempt infects the neighbor if it is
+ * susceptible at that moment. The waiting times @f$\tau_r, \tau_i@f$ are
+ * drawn from user-supplied distributions; a waiting time of
+ * @c std::numeric_limits<double>::infinity() means the event never happens.
+ *
+ * Scheduled events are kept in a pairing heap and are cancelled lazily: each
+ * node and edge carries an epoch counter that is increased whenever the
+ * node changes its state or the edge is removed, and events carrying an
+ * outdated epoch are discarded when they reach the top of the queue. The
+ * engine listens to graph events, so state changes made by other code
+ * (including the engine's own Graph::setNodeState() calls, which also drive a
+ * StateConsistencyListener), newly infected nodes, and edge additions or
+ * removals are taken into account. Thus the engine can be combined with
+ * adaptive network dynamics.
+ *
+ * For SIS dynamics, pass the susceptible state also as the recovered state.
+ *
+ * Example:
+ * @code
+ * typedef NonMarkovianEpidemic<rng_t> epi_t;
+ * epi_t epi(net, rng, S, I, R,
+ *		boost::bind(&rng_t::Gamma, _1, 2.0, 0.5),  // infection times
+ *		boost::bind(&rng_t::Gamma, _1, 10.0, 0.5)); // recovery times
+ * while (!epi.stopped())
+ *		epi.step();
+ * @endcode
+ */
+template<class RandomGen>
+class NonMarkovianEpidemic: public largenet::GraphListener,
+		public boost::noncopyable
+{
+public:
+	/// distribution of waiting times
+	typedef boost::function<double(RandomGen&)> WaitingTime;
+
+	/**
+	 * Constructor
+	 *
+	 * Registers the engine as a listener of @p g and schedules the recovery
+	 * and transmission events of all nodes already infected.
+	 * @param g graph
+	 * @param rng random number generator used for all waiting times
+	 * @param S susceptible node state
+	 * @param I infected node state
+	 * @param R recovered node state (equal to @p S for SIS dynamics)
+	 * @param infection waiting time distribution for transmission attempts
+	 * along an edge
+	 * @param recovery waiting time distribution for recovery
+	 */
+	NonMarkovianEpidemic(largenet::Graph& g, RandomGen& rng,
+			largenet::node_state_t S, largenet::node_state_t I,
+			largenet::node_state_t R, const WaitingTime& infection,
+			const WaitingTime& recovery) :
+			g_(g), rng_(rng), S_(S), I_(I), R_(R), infection_(infection), recovery_(
+					recovery), t_(0), seq_(0), events_(0)
+	{
+		if (S == I || I == R)
+			throw std::invalid_argument(
+					"Infected state must differ from susceptible and recovered states.");
+		g_.addGraphListener(this);
+		largenet::Graph::NodeStateIteratorRange inf = g_.nodes(I_);
+		for (largenet::Graph::NodeStateIterator n = inf.first; n != inf.second; ++n)
+			scheduleInfected(*n);
+	}
+
+	virtual ~NonMarkovianEpidemic()
+	{
+		g_.removeGraphListener(this);
+	}
+
+	/**
+	 * Check whether the epidemic is over, i.e., no node is infected.
+	 */
+	bool stopped() const
+	{
+		return g_.numberOfNodes(I_) == 0;
+	}
+
+	/**
+	 * Execute the next event.
+	 * @return time increment (1000 if no event is scheduled)
+	 */
+	double step()
+	{
+		while (!queue_.empty())
+		{
+			const Event ev = queue_.top();
+			queue_.pop();
+			if (!valid(ev))
+				continue;
+			const double dt = ev.time - t_;
+			t_ = ev.time;
+			++events_;
+			if (ev.recovery)
+				g_.setNodeState(ev.node, R_);
+			else
+				transmit(ev);
+			return dt;
+		}
+		return 1000;
+	}
+
+	/**
+	 * Current simulation time
+	 */
+	double time() const
+	{
+		return t_;
+	}
+	/**
+	 * Number of executed (valid) events
+	 */
+	unsigned long events() const
+	{
+		return events_;
+	}
+	/**
+	 * Number of scheduled events, including cancelled ones not yet discarded
+	 */
+	unsigned long pending() const
+	{
+		return queue_.size();
+	}
+
+private:
+	struct Event
+	{
+		double time;
+		unsigned long seq; ///< tie-breaker for deterministic order
+		largenet::node_id_t node; ///< infected (source) node
+		largenet::edge_id_t edge;
+		unsigned long nodeEpoch, edgeEpoch;
+		bool recovery;
+	};
+	struct Later
+	{
+		bool operator()(const Event& a, const Event& b) const
+		{
+			return a.time > b.time || (a.time == b.time && a.seq > b.seq);
+		}
+	};
+	typedef boost::heap::pairing_heap<Event, boost::heap::compare<Later> > EventQueue;
+
+	bool valid(const Event& ev) const
+	{
+		if (nodeEpoch(ev.node) != ev.nodeEpoch)
+			return false;
+		return ev.recovery || edgeEpoch(ev.edge) == ev.edgeEpoch;
+	}
+
+	void transmit(const Event& ev)
+	{
+		const largenet::Edge* e = g_.edge(ev.edge);
+		const largenet::Node* src = g_.node(ev.node);
+		const largenet::node_id_t target = e->opposite(*src)->id();
+		// schedule the next attempt first: infecting the target does not
+		// change the source's epoch
+		scheduleTransmission(ev.node, ev.edge);
+		if (g_.nodeState(target) == S_)
+			g_.setNodeState(target, I_);
+	}
+
+	void schedule(Event& ev)
+	{
+		ev.seq = seq_++;
+		queue_.push(ev);
+	}
+
+	void scheduleTransmission(largenet::node_id_t n, largenet::edge_id_t e)
+	{
+		const double tau = infection_(rng_);
+		if (!(tau < std::numeric_limits<double>::infinity()))
+			return;
+		Event ev;
+		ev.time = t_ + tau;
+		ev.node = n;
+		ev.edge = e;
+		ev.nodeEpoch = nodeEpoch(n);
+		ev.edgeEpoch = edgeEpoch(e);
+		ev.recovery = false;
+		schedule(ev);
+	}
+
+	void scheduleInfected(largenet::Node& n)
+	{
+		const double tau = recovery_(rng_);
+		if (tau < std::numeric_limits<double>::infinity())
+		{
+			Event ev;
+			ev.time = t_ + tau;
+			ev.node = n.id();
+			ev.edge = 0;
+			ev.nodeEpoch = nodeEpoch(n.id());
+			ev.edgeEpoch = 0;
+			ev.recovery = true;
+			schedule(ev);
+		}
+		largenet::Node::edge_iterator_range out = n.outEdges();
+		for (largenet::Node::edge_iterator it = out.first; it != out.second; ++it)
+			scheduleTransmission(n.id(), (*it)->id());
+		largenet::Node::edge_iterator_range un = n.undirectedEdges();
+		for (largenet::Node::edge_iterator it = un.first; it != un.second; ++it)
+			scheduleTransmission(n.id(), (*it)->id());
+	}
+
+	unsigned long nodeEpoch(largenet::node_id_t n) const
+	{
+		return n < nodeEpochs_.size() ? nodeEpochs_[n] : 0;
+	}
+	unsigned long edgeEpoch(largenet::edge_id_t e) const
+	{
+		return e < edgeEpochs_.size() ? edgeEpochs_[e] : 0;
+	}
+	void invalidateNode(largenet::node_id_t n)
+	{
+		if (n >= nodeEpochs_.size())
+			nodeEpochs_.resize(n + 1, 0);
+		++nodeEpochs_[n];
+	}
+	void invalidateEdge(largenet::edge_id_t e)
+	{
+		if (e >= edgeEpochs_.size())
+			edgeEpochs_.resize(e + 1, 0);
+		++edgeEpochs_[e];
+	}
+
+	virtual void afterNodeStateChangeEvent(largenet::Graph&,
+			largenet::Node& n, largenet::node_state_t oldState,
+			largenet::node_state_t newState)
+	{
+		if (oldState == I_)
+			invalidateNode(n.id());
+		if (newState == I_)
+			scheduleInfected(n);
+	}
+	virtual void afterNodeAddEvent(largenet::Graph& g, largenet::Node& n)
+	{
+		if (g.nodeState(n.id()) == I_)
+			scheduleInfected(n);
+	}
+	virtual void afterEdgeAddEvent(largenet::Graph& g, largenet::Edge& e)
+	{
+		if (g.nodeState(e.source()->id()) == I_)
+			scheduleTransmission(e.source()->id(), e.id());
+		if (!e.isDirected() && g.nodeState(e.target()->id()) == I_)
+			scheduleTransmission(e.target()->id(), e.id());
+	}
+	virtual void beforeEdgeRemoveEvent(largenet::Graph&, largenet::Edge& e)
+	{
+		invalidateEdge(e.id());
+	}
+	virtual void beforeNodeRemoveEvent(largenet::Graph&, largenet::Node& n)
+	{
+		invalidateNode(n.id());
+	}
+	virtual void beforeGraphClearEvent(largenet::Graph&)
+	{
+		queue_.clear();
+	}
+
+	largenet::Graph& g_;
+	RandomGen& rng_;
+	largenet::node_state_t S_, I_, R_;
+	WaitingTime infection_, recovery_;
+	double t_;
+	unsigned long seq_, events_;
+	EventQueue queue_;
+	std::vector<unsigned long> nodeEpochs_, edgeEpochs_;
+};
+
+}
+}
+
+#endif /* NONMARKOVIANEPIDEMIC_H_ */
@@ -0,0 +1,189 @@
+/**
+ * @file GraphBatch.h
+ * @date 18.10.2026
+ */
+
+#ifndef GRAPHBATCH_H_
+#define GRAPHBATCH_H_
+
+#include <largenet2/base/Graph.h>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+namespace sim
+{
+namespace gillespie
+{
+
+/**
+ * Batch functor for TauLeapMethod acting on nodes in a given state.
+ *
+ * Called with the number of firings @p k of a leap, it picks @p k distinct
+ * nodes uniformly at random among those in state @p s at the beginning of
+ * the batch and applies the transition functor, which is called with the
+ * node ID, to each of them, with no rate evaluations between the
+ * transitions. A picked node that has left state @p s through an earlier
+ * transition of the same batch is skipped.
+ *
+ * If @p k is small compared to the number of nodes in state @p s, as in
+ * typical leaps, the nodes are drawn with Graph::randomNode() and duplicates
+ * are redrawn, at a cost of O(k log k); skipped nodes are not replaced.
+ * Otherwise, the IDs of all nodes in state @p s are copied and partially
+ * shuffled, and skipped nodes are replaced by further ones, so that fewer
+ * than @p k transitions are applied only if the nodes in state @p s run out:
+ * @code
+ * // Recover(net)(n) sets node n to state S
+ * stepper.registerProcess(recoveryRate, recoverRandomNode,
+ * 		sim::gillespie::nodeBatch(net, I, rng, Recover(net)));
+ * @endcode
+ * Transitions may change the states of any nodes, but must not remove
+ * nodes in state @p s.
+ * @see nodeBatch(), EdgeBatch
+ */
+template<class RandomGen, class Transition>
+class NodeBatch
+{
+public:
+	NodeBatch(largenet::Graph& g, const largenet::node_state_t s,
+			RandomGen& rng, const Transition& t) :
+		g_(&g), s_(s), rng_(&rng), t_(t)
+	{
+	}
+	/**
+	 * Apply up to @p k transitions.
+	 * @return number of transitions applied
+	 */
+	unsigned long operator()(const unsigned long k)
+	{
+		const std::size_t n = g_->numberOfNodes(s_);
+		ids_.clear();
+		if (k == 0 || n == 0)
+			return 0;
+		if (k < n / 4)
+		{
+			// draw with replacement until k distinct IDs are found
+			while (ids_.size() < k)
+			{
+				while (ids_.size() < k)
+					ids_.push_back(g_->randomNode(s_, *rng_)->id());
+				std::sort(ids_.begin(), ids_.end());
+				ids_.erase(std::unique(ids_.begin(), ids_.end()), ids_.end());
+			}
+		}
+		else
+		{
+			largenet::Graph::NodeStateIteratorRange r = g_->nodes(s_);
+			for (largenet::Graph::NodeStateIterator i = r.first; i != r.second; ++i)
+				ids_.push_back(i.id());
+		}
+		// partial Fisher-Yates shuffle, which also undoes the sorting of drawn IDs
+		unsigned long fired = 0;
+		for (std::size_t i = 0; i < ids_.size() && fired < k; ++i)
+		{
+			std::swap(ids_[i], ids_[rng_->IntFromTo(i, ids_.size() - 1)]);
+			if (g_->nodeState(ids_[i]) != s_)
+				continue;
+			t_(ids_[i]);
+			++fired;
+		}
+		return fired;
+	}
+
+private:
+	largenet::Graph* g_;
+	largenet::node_state_t s_;
+	RandomGen* rng_;
+	Transition t_;
+	std::vector<largenet::node_id_t> ids_;
+};
+
+/**
+ * Batch functor for TauLeapMethod acting on edges in a given state.
+ *
+ * Works like NodeBatch, with the transition functor called with edge IDs.
+ * Transitions may remove the edge they act on, e.g. for rewiring, and change
+ * the states of any edges, but must not remove other edges in state @p s.
+ * @see edgeBatch(), NodeBatch
+ */
+template<class RandomGen, class Transition>
+class EdgeBatch
+{
+public:
+	EdgeBatch(largenet::Graph& g, const largenet::edge_state_t s,
+			RandomGen& rng, const Transition& t) :
+		g_(&g), s_(s), rng_(&rng), t_(t)
+	{
+	}
+	/**
+	 * Apply up to @p k transitions.
+	 * @return number of transitions applied
+	 */
+	unsigned long operator()(const unsigned long k)
+	{
+		const std::size_t n = g_->numberOfEdges(s_);
+		ids_.clear();
+		if (k == 0 || n == 0)
+			return 0;
+		if (k < n / 4)
+		{
+			// draw with replacement until k distinct IDs are found
+			while (ids_.size() < k)
+			{
+				while (ids_.size() < k)
+					ids_.push_back(g_->randomEdge(s_, *rng_)->id());
+				std::sort(ids_.begin(), ids_.end());
+				ids_.erase(std::unique(ids_.begin(), ids_.end()), ids_.end());
+			}
+		}
+		else
+		{
+			largenet::Graph::EdgeStateIteratorRange r = g_->edges(s_);
+			for (largenet::Graph::EdgeStateIterator i = r.first; i != r.second; ++i)
+				ids_.push_back(i.id());
+		}
+		// partial Fisher-Yates shuffle, which also undoes the sorting of drawn IDs
+		unsigned long fired = 0;
+		for (std::size_t i = 0; i < ids_.size() && fired < k; ++i)
+		{
+			std::swap(ids_[i], ids_[rng_->IntFromTo(i, ids_.size() - 1)]);
+			if (g_->edgeState(ids_[i]) != s_)
+				continue;
+			t_(ids_[i]);
+			++fired;
+		}
+		return fired;
+	}
+
+private:
+	largenet::Graph* g_;
+	largenet::edge_state_t s_;
+	RandomGen* rng_;
+	Transition t_;
+	std::vector<largenet::edge_id_t> ids_;
+};
+
+/**
+ * Create a NodeBatch applying @p t to nodes in state @p s.
+ */
+template<class RandomGen, class Transition>
+NodeBatch<RandomGen, Transition> nodeBatch(largenet::Graph& g,
+		const largenet::node_state_t s, RandomGen& rng, const Transition& t)
+{
+	return NodeBatch<RandomGen, Transition> (g, s, rng, t);
+}
+
+/**
+ * Create an EdgeBatch applying @p t to edges in state @p s.
+ */
+template<class RandomGen, class Transition>
+EdgeBatch<RandomGen, Transition> edgeBatch(largenet::Graph& g,
+		const largenet::edge_state_t s, RandomGen& rng, const Transition& t)
+{
+	return EdgeBatch<RandomGen, Transition> (g, s, rng, t);
+}
+
+}
+}
+
+#endif /* GRAPHBATCH_H_ */
@@ -0,0 +1,178 @@
+/**
+ * @file StaticDirectMethod.h
+ * @date 18.10.2026
+ */
+
+#ifndef STATICDIRECTMETHOD_H_
+#define STATICDIRECTMETHOD_H_
+
+#include <boost/tuple/tuple.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace sim
+{
+namespace gillespie
+{
+
+namespace detail
+{
+
+/**
+ * Compile-time recursion over a boost::tuples::cons list of processes.
+ */
+template<class Cons>
+struct ProcessList
+{
+	static double rates(Cons& procs, double* r)
+	{
+		*r = procs.get_head().rate();
+		return *r + ProcessList<typename Cons::tail_type>::rates(
+				procs.get_tail(), r + 1);
+	}
+	static void fire(Cons& procs, const unsigned int k)
+	{
+		if (k == 0)
+			procs.get_head()();
+		else
+			ProcessList<typename Cons::tail_type>::fire(procs.get_tail(),
+					k - 1);
+	}
+};
+
+template<>
+struct ProcessList<boost::tuples::null_type>
+{
+	static double rates(const boost::tuples::null_type&, double*)
+	{
+		return 0.0;
+	}
+	static void fire(const boost::tuples::null_type&, unsigned int)
+	{
+		assert(false);
+	}
+};
+
+}
+
+/**
+ * Gillespie direct method with a process set fixed at compile time.
+ *
+ * This is a drop-in replacement for DirectMethod for models whose processes
+ * are known in advance. Instead of registering boost::function objects at
+ * runtime, the process types are given as template arguments, so that rate
+ * evaluations and actions are ordinary (inlinable) member function calls.
+ *
+ * Each process type @p P must provide
+ * @code
+ * double rate();     // instantaneous rate of the process
+ * void operator()(); // perform the process
+ * @endcode
+ *
+ * Given the same random number sequence, StaticDirectMethod fires exactly the
+ * same processes as a DirectMethod with the processes registered in the same
+ * order.
+ *
+ * Example:
+ * @code
+ * typedef StaticDirectMethod<Infection, Recovery, Rewiring> stepper_t;
+ * stepper_t stepper(boost::make_tuple(Infection(model), Recovery(model),
+ *		Rewiring(model)));
+ * double tau = stepper.step(rng);
+ * @endcode
+ *
+ * At most ten processes are supported (the boost::tuple limit).
+ */
+template<class P0, class P1 = boost::tuples::null_type,
+		class P2 = boost::tuples::null_type, class P3 = boost::tuples::null_type,
+		class P4 = boost::tuples::null_type, class P5 = boost::tuples::null_type,
+		class P6 = boost::tuples::null_type, class P7 = boost::tuples::null_type,
+		class P8 = boost::tuples::null_type, class P9 = boost::tuples::null_type>
+class StaticDirectMethod
+{
+public:
+	/// tuple type holding the process objects
+	typedef boost::tuple<P0, P1, P2, P3, P4, P5, P6, P7, P8, P9> ProcessTuple;
+	/// number of processes
+	static const unsigned int num_processes = boost::tuples::length<
+			ProcessTuple>::value;
+
+	/**
+	 * Create a stepper with default-constructed process objects.
+	 */
+	StaticDirectMethod()
+	{
+		init();
+	}
+	/**
+	 * Create a stepper using copies of the process objects in @p procs.
+	 */
+	explicit StaticDirectMethod(const ProcessTuple& procs) :
+			procs_(procs)
+	{
+		init();
+	}
+
+	/**
+	 * Perform one Gillespie step.
+	 * @param rng Random number generator providing Exponential(double) and
+	 * Uniform01()
+	 * @return time increment
+	 */
+	template<class RandomGen>
+	double step(RandomGen& rng)
+	{
+		const double atot = detail::ProcessList<
+				typename ProcessTuple::inherited>::rates(procs_, rates_);
+		if (atot == 0.0)
+			return 1000;
+
+		const double tau = rng.Exponential(1.0 / atot);
+		const double x = rng.Uniform01() * atot;
+		unsigned int k = 0;
+		double sum = rates_[pr_[k]];
+		while (sum < x && k < num_processes - 1)
+			sum += rates_[pr_[++k]];
+
+		// call process k
+		detail::ProcessList<typename ProcessTuple::inherited>::fire(procs_,
+				pr_[k]);
+
+		if (k > 0)
+			std::swap(pr_[k], pr_[k - 1]);
+		return tau;
+	}
+
+	unsigned int countReactions() const
+	{
+		return num_processes;
+	}
+
+	/**
+	 * Access the process object at index @p N.
+	 */
+	template<int N>
+	typename boost::tuples::element<N, ProcessTuple>::type& process()
+	{
+		return boost::get<N>(procs_);
+	}
+
+private:
+	void init()
+	{
+		for (unsigned int i = 0; i < num_processes; ++i)
+		{
+			pr_[i] = i;
+			rates_[i] = 0.0;
+		}
+	}
+
+	ProcessTuple procs_;
+	double rates_[num_processes];
+	unsigned int pr_[num_processes]; ///< priority list
+};
+
+}
+}
+
+#endif /* STATICDIRECTMETHOD_H_ */
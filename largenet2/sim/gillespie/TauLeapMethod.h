@@ -0,0 +1,250 @@
+/**
+ * @file TauLeapMethod.h
+ * @date 18.10.2026
+ */
+
+#ifndef TAULEAPMETHOD_H_
+#define TAULEAPMETHOD_H_
+
+#include <largenet2/sim/random/distributions.h>
+#include <boost/function.hpp>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <stdexcept>
+
+namespace sim
+{
+namespace gillespie
+{
+
+/**
+ * Approximate stochastic simulation by explicit tau-leaping.
+ *
+ * Instead of executing one event per step like DirectMethod, TauLeapMethod
+ * selects a time step @f$\tau@f$ in which the rates are not expected to change
+ * appreciably and fires each process a Poisson-distributed number of times
+ * with mean @f$a_j\tau@f$. The leap size is chosen by the criterion of
+ * Cao, Gillespie, and Petzold, J. Chem. Phys. 124, 044109 (2006): the expected
+ * relative change of every registered species population @f$x_i@f$ is bounded
+ * by @f$\epsilon/g_i@f$,
+ * @f[ \tau = \min_i \left\{ \frac{\max(\epsilon x_i/g_i, 1)}{|\mu_i|},
+ * \frac{\max(\epsilon x_i/g_i, 1)^2}{\sigma_i^2} \right\}, @f]
+ * where @f$\mu_i = \sum_j v_{ij} a_j@f$ and @f$\sigma_i^2 = \sum_j v_{ij}^2 a_j@f$
+ * are computed from the state change vectors @f$v_{ij}@f$ set by
+ * setStateChange().
+ *
+ * In network models, species are typically node or edge counts per state
+ * (e.g. Graph::numberOfNodes(I), Graph::numberOfEdges(SI)), and the state
+ * change of a process on an edge count is its expected change (e.g. the
+ * mean excess degree for an infection).
+ *
+ * Whenever a leap would contain fewer than exactThreshold() events on
+ * average, or no species are registered, an exact direct-method step is
+ * performed instead. step() has the same semantics as DirectMethod::step(),
+ * returning the time increment.
+ *
+ * Processes are fired in batches through a BatchFunctor, which receives the
+ * number of firings. For processes acting on the nodes or edges in a given
+ * state, NodeBatch and EdgeBatch from GraphBatch.h apply the transitions to
+ * distinct randomly chosen elements in one pass. If no BatchFunctor is
+ * given, the process functor is called repeatedly as long as the process
+ * rate stays positive, so that a batch never acts on an empty set of nodes
+ * or edges. This fallback is a slow path that evaluates the rate functor
+ * before each firing.
+ */
+class TauLeapMethod
+{
+public:
+	typedef boost::function<double()> RateFunctor;
+	typedef boost::function<void()> ProcFunctor;
+	typedef boost::function<void(unsigned long)> BatchFunctor;
+	typedef boost::function<double()> PopulationFunctor;
+
+	/**
+	 * Constructor
+	 * @param epsilon error control parameter (maximum relative change of
+	 * a species population during one leap)
+	 * @param exactThreshold minimum mean number of events in a leap; smaller
+	 * leaps are replaced by exact steps
+	 */
+	explicit TauLeapMethod(double epsilon = 0.03, double exactThreshold = 10.0) :
+			epsilon_(epsilon), exactThreshold_(exactThreshold), leaped_(false)
+	{
+	}
+	/**
+	 * Register a species population, such as the number of nodes in a state.
+	 * @param pop functor returning the current population
+	 * @param hor highest order of reaction @f$g_i@f$ in which the species
+	 * appears as a reactant (1 for first-order processes)
+	 * @return species index
+	 */
+	unsigned int registerSpecies(const PopulationFunctor& pop, double hor = 1.0)
+	{
+		species_.push_back(pop);
+		hor_.push_back(hor);
+		for (std::vector<std::vector<double> >::iterator it = changes_.begin(); it
+				!= changes_.end(); ++it)
+			it->push_back(0.0);
+		return species_.size() - 1;
+	}
+	/**
+	 * Register a process that is fired by repeated calls to @p procFunc.
+	 * @return process index
+	 */
+	unsigned int registerProcess(const RateFunctor& rateFunc,
+			const ProcFunctor& procFunc)
+	{
+		return registerProcess(rateFunc, procFunc, BatchFunctor());
+	}
+	/**
+	 * Register a process with a dedicated batch functor, which is called with
+	 * the number of firings during a leap.
+	 * @return process index
+	 */
+	unsigned int registerProcess(const RateFunctor& rateFunc,
+			const ProcFunctor& procFunc, const BatchFunctor& batchFunc)
+	{
+		rateFuncs_.push_back(rateFunc);
+		procFuncs_.push_back(procFunc);
+		batchFuncs_.push_back(batchFunc);
+		rates_.push_back(0.0);
+		changes_.push_back(std::vector<double>(species_.size(), 0.0));
+		return rateFuncs_.size() - 1;
+	}
+	/**
+	 * Set the (expected) change of species @p species caused by one firing
+	 * of process @p process.
+	 */
+	void setStateChange(unsigned int process, unsigned int species,
+			double change)
+	{
+		if (process >= changes_.size() || species >= species_.size())
+			throw std::out_of_range("Process or species index out of range");
+		changes_[process][species] = change;
+	}
+
+	template<class RandomGen>
+	double step(RandomGen& rng)
+	{
+		double atot = 0.0;
+		for (unsigned int j = 0; j < rates_.size(); ++j)
+		{
+			rates_[j] = rateFuncs_[j]();
+			atot += rates_[j];
+		}
+		if (atot == 0.0)
+			return 1000;
+
+		const double tau = leapSize();
+		if (tau * atot < exactThreshold_)
+		{
+			leaped_ = false;
+			return exactStep(rng, atot);
+		}
+
+		leaped_ = true;
+		for (unsigned int j = 0; j < rates_.size(); ++j)
+		{
+			const unsigned long k = random::poisson(rng, rates_[j] * tau);
+			if (k > 0)
+				fire(j, k);
+		}
+		return tau;
+	}
+
+	unsigned int countReactions() const
+	{
+		return rateFuncs_.size();
+	}
+	unsigned int countSpecies() const
+	{
+		return species_.size();
+	}
+	double epsilon() const
+	{
+		return epsilon_;
+	}
+	double exactThreshold() const
+	{
+		return exactThreshold_;
+	}
+	/**
+	 * Check whether the last call to step() performed a leap (as opposed to
+	 * an exact step).
+	 */
+	bool lastStepWasLeap() const
+	{
+		return leaped_;
+	}
+
+private:
+	double leapSize() const
+	{
+		double tau = std::numeric_limits<double>::infinity();
+		for (unsigned int i = 0; i < species_.size(); ++i)
+		{
+			double mu = 0.0, sigma2 = 0.0;
+			for (unsigned int j = 0; j < rates_.size(); ++j)
+			{
+				const double v = changes_[j][i];
+				mu += v * rates_[j];
+				sigma2 += v * v * rates_[j];
+			}
+			const double bound = std::max(epsilon_ * species_[i]() / hor_[i],
+					1.0);
+			if (mu != 0.0)
+				tau = std::min(tau, bound / std::fabs(mu));
+			if (sigma2 > 0.0)
+				tau = std::min(tau, bound * bound / sigma2);
+		}
+		// without any species constraints we cannot leap safely
+		if (tau == std::numeric_limits<double>::infinity())
+			return 0.0;
+		return tau;
+	}
+
+	template<class RandomGen>
+	double exactStep(RandomGen& rng, const double atot)
+	{
+		const double tau = rng.Exponential(1.0 / atot);
+		const double x = rng.Uniform01() * atot;
+		unsigned int k = 0;
+		double sum = rates_[k];
+		while (sum < x && k < rates_.size() - 1)
+			sum += rates_[++k];
+		procFuncs_[k]();
+		return tau;
+	}
+
+	void fire(const unsigned int j, const unsigned long k)
+	{
+		if (batchFuncs_[j])
+			batchFuncs_[j](k);
+		else
+		{
+			for (unsigned long n = 0; n < k; ++n)
+			{
+				if (rateFuncs_[j]() <= 0.0)
+					break;
+				procFuncs_[j]();
+			}
+		}
+	}
+
+	double epsilon_, exactThreshold_;
+	bool leaped_;
+	std::vector<double> rates_;
+	std::vector<RateFunctor> rateFuncs_;
+	std::vector<ProcFunctor> procFuncs_;
+	std::vector<BatchFunctor> batchFuncs_;
+	std::vector<PopulationFunctor> species_;
+	std::vector<double> hor_;
+	std::vector<std::vector<double> > changes_; ///< state change vectors, changes_[process][species]
+};
+
+}
+}
+
+#endif /* TAULEAPMETHOD_H_ */
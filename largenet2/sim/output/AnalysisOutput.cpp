@@ -0,0 +1,195 @@
+/**
+ * @file AnalysisOutput.cpp
+ * @date 18.10.2026
+ */
+
+#include "AnalysisOutput.h"
+#include <largenet2/base/Graph.h>
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <memory>
+#include <stdexcept>
+
+namespace sim
+{
+namespace output
+{
+
+AnalysisOutput::AnalysisOutput(std::ostream& out, const largenet::Graph& net,
+		const double interval, const unsigned int threads,
+		const std::size_t maxPending) :
+	IntervalOutput(out, interval), net_(net), threads_(threads), maxPending_(
+			maxPending), started_(false), stopping_(false), submitted_(0),
+			written_(0)
+{
+	if (threads_ == 0)
+		threads_ = boost::thread::hardware_concurrency();
+	if (threads_ == 0)
+		threads_ = 1;
+	if (maxPending_ == 0)
+		maxPending_ = 2 * threads_;
+}
+
+AnalysisOutput::~AnalysisOutput()
+{
+	try
+	{
+		flush();
+	} catch (...)
+	{
+	}
+	stop();
+}
+
+void AnalysisOutput::addMeasure(const std::string& name, const Measure& f)
+{
+	if (started_)
+		throw std::logic_error("Cannot add measures after the first output.");
+	names_.push_back(name);
+	measures_.push_back(f);
+}
+
+void AnalysisOutput::start()
+{
+	started_ = true;
+	for (unsigned int i = 0; i < threads_; ++i)
+		pool_.create_thread(boost::bind(&AnalysisOutput::work, this));
+}
+
+void AnalysisOutput::stop()
+{
+	{
+		boost::mutex::scoped_lock lock(mutex_);
+		stopping_ = true;
+	}
+	jobReady_.notify_all();
+	pool_.join_all();
+	while (!jobs_.empty())
+	{
+		delete jobs_.front();
+		jobs_.pop_front();
+	}
+}
+
+void AnalysisOutput::rethrow()
+{
+	if (!error_.empty())
+	{
+		const std::string e = error_;
+		error_.clear();
+		throw std::runtime_error("Analysis failed: " + e);
+	}
+}
+
+void AnalysisOutput::doOutput(const double t)
+{
+	if (!started_)
+		start();
+	std::auto_ptr<Job> job(new Job);
+	job->t = t;
+	job->snapshot.capture(net_, false);
+
+	boost::mutex::scoped_lock lock(mutex_);
+	writeReady();
+	while (submitted_ - written_ >= maxPending_ && error_.empty())
+	{
+		resultReady_.wait(lock);
+		writeReady();
+	}
+	job->seq = submitted_++;
+	jobs_.push_back(job.release());
+	jobReady_.notify_one();
+	// the snapshot is taken even if an earlier one has failed
+	rethrow();
+}
+
+void AnalysisOutput::flush()
+{
+	boost::mutex::scoped_lock lock(mutex_);
+	writeReady();
+	while (written_ < submitted_ && error_.empty())
+	{
+		resultReady_.wait(lock);
+		writeReady();
+	}
+	rethrow();
+	stream().flush();
+}
+
+void AnalysisOutput::work()
+{
+	while (true)
+	{
+		boost::scoped_ptr<Job> job;
+		{
+			boost::mutex::scoped_lock lock(mutex_);
+			while (jobs_.empty() && !stopping_)
+				jobReady_.wait(lock);
+			if (jobs_.empty())
+				return;
+			job.reset(jobs_.front());
+			jobs_.pop_front();
+		}
+
+		Result r;
+		r.t = job->t;
+		std::string error;
+		try
+		{
+			boost::scoped_ptr<largenet::Graph> g(job->snapshot.createGraph());
+			r.values.reserve(measures_.size());
+			for (std::vector<Measure>::const_iterator f = measures_.begin(); f
+					!= measures_.end(); ++f)
+				r.values.push_back((*f)(*g));
+		} catch (std::exception& e)
+		{
+			error = e.what();
+		} catch (...)
+		{
+			error = "unknown error";
+		}
+
+		boost::mutex::scoped_lock lock(mutex_);
+		if (!error.empty())
+		{
+			// skip the result, so that later ones are still written
+			if (error_.empty())
+				error_ = error;
+			r.values.clear();
+		}
+		results_[job->seq] = r;
+		resultReady_.notify_all();
+	}
+}
+
+void AnalysisOutput::writeReady()
+{
+	const char tab = '\t';
+	std::map<unsigned long, Result>::iterator r;
+	while ((r = results_.find(written_)) != results_.end())
+	{
+		if (!r->second.values.empty() || measures_.empty())
+		{
+			stream() << r->second.t;
+			for (std::vector<double>::const_iterator v =
+					r->second.values.begin(); v != r->second.values.end(); ++v)
+				stream() << tab << *v;
+			stream() << "\n";
+		}
+		results_.erase(r);
+		++written_;
+	}
+}
+
+void AnalysisOutput::doWriteHeader()
+{
+	const char tab = '\t';
+	stream() << commentChar() << " t";
+	for (std::vector<std::string>::const_iterator n = names_.begin(); n
+			!= names_.end(); ++n)
+		stream() << tab << *n;
+	stream() << "\n";
+}
+
+}
+}
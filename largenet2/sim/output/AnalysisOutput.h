@@ -0,0 +1,135 @@
+/**
+ * @file AnalysisOutput.h
+ * @date 18.10.2026
+ */
+
+#ifndef ANALYSISOUTPUT_H_
+#define ANALYSISOUTPUT_H_
+
+#include <largenet2/sim/output/IntervalOutput.h>
+#include <largenet2/sim/output/SnapshotArchive.h>
+#include <boost/function.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <vector>
+#include <deque>
+#include <map>
+#include <string>
+#include <cstddef>
+
+namespace largenet
+{
+class Graph;
+}
+
+namespace sim
+{
+namespace output
+{
+
+/**
+ * Computes expensive network measures on a pool of worker threads while the
+ * simulation continues.
+ *
+ * At each output time, the simulation thread only copies the nodes and edges
+ * of the network into flat arrays (an unsorted ArchivedSnapshot). A worker
+ * rebuilds a private Graph from the copy and evaluates all registered
+ * measures on it, so that any function of a const Graph&, such as those in
+ * largenet2/measures, can be used:
+ * @code
+ * AnalysisOutput* a = new AnalysisOutput(out, net, 10.0);
+ * a->addMeasure("r_inout", largenet::measures::inOutDegreeCorrelation);
+ * a->addMeasure("kmax", largenet::measures::maxOutDegree);
+ * @endcode
+ * Results are written in the order of the output times, one tab-separated
+ * line per time, no matter which worker finishes first. The workers hand
+ * finished results back, and the lines are written on the simulation thread
+ * by later outputs and flush(), so the stream may be shared with other
+ * outputs. At most maxPending() snapshots are in flight; further outputs
+ * block until a result has been written, which bounds memory use.
+ *
+ * Measures must not modify shared state. The output must be destroyed, or
+ * flush()ed, before its stream. Exceptions thrown by a measure are reported
+ * as std::runtime_error by the next output or flush().
+ */
+class AnalysisOutput: public IntervalOutput
+{
+public:
+	typedef boost::function<double(const largenet::Graph&)> Measure;
+
+	/**
+	 * Constructor
+	 * @param out output stream
+	 * @param net graph (must outlive the output)
+	 * @param interval time between analyses
+	 * @param threads number of worker threads, 0 for one per core
+	 * @param maxPending maximum number of snapshots in flight, 0 for twice
+	 * the number of threads
+	 */
+	AnalysisOutput(std::ostream& out, const largenet::Graph& net,
+			double interval, unsigned int threads = 0,
+			std::size_t maxPending = 0);
+	/// Write all pending results and stop the workers.
+	virtual ~AnalysisOutput();
+
+	/// Register measure @p f, written in column @p name.
+	void addMeasure(const std::string& name, const Measure& f);
+	/// Wait until all pending results are written.
+	void flush();
+
+	unsigned int threads() const
+	{
+		return threads_;
+	}
+	std::size_t maxPending() const
+	{
+		return maxPending_;
+	}
+
+private:
+	struct Job
+	{
+		unsigned long seq;
+		double t;
+		ArchivedSnapshot snapshot;
+	};
+	struct Result
+	{
+		double t;
+		std::vector<double> values;
+	};
+
+	void doOutput(double t);
+	void doWriteHeader();
+
+	void start();
+	void stop();
+	void work();
+	/**
+	 * Write consecutive finished results; called on the simulation thread
+	 * with the mutex held.
+	 */
+	void writeReady();
+	void rethrow();
+
+	const largenet::Graph& net_;
+	std::vector<std::string> names_;
+	std::vector<Measure> measures_;
+	unsigned int threads_;
+	std::size_t maxPending_;
+
+	boost::thread_group pool_;
+	bool started_, stopping_;
+	boost::mutex mutex_;
+	boost::condition_variable jobReady_, resultReady_;
+	std::deque<Job*> jobs_;
+	std::map<unsigned long, Result> results_;
+	unsigned long submitted_, written_;
+	std::string error_;
+};
+
+}
+}
+
+#endif /* ANALYSISOUTPUT_H_ */
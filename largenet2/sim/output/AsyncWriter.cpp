@@ -0,0 +1,131 @@
+/**
+ * @file AsyncWriter.cpp
+ * @date 18.10.2026
+ */
+
+#include "AsyncWriter.h"
+#include "RecordOutput.h"
+#include <boost/bind.hpp>
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+
+namespace sim
+{
+namespace output
+{
+
+AsyncWriter::AsyncWriter(const std::size_t capacity) :
+	slots_(std::max<std::size_t>(capacity, 1)), head_(0), count_(0), busy_(
+			false), stop_(false), stalls_(0)
+{
+	thread_.reset(new boost::thread(boost::bind(&AsyncWriter::run, this)));
+}
+
+AsyncWriter::~AsyncWriter()
+{
+	{
+		boost::mutex::scoped_lock lock(mutex_);
+		stop_ = true;
+	}
+	queued_.notify_one();
+	thread_->join();
+}
+
+void AsyncWriter::submit(RecordOutput& out, const double t)
+{
+	std::size_t tail;
+	{
+		boost::mutex::scoped_lock lock(mutex_);
+		throwIfFailed();
+		if (count_ == slots_.size())
+		{
+			++stalls_;
+			while (count_ == slots_.size() && error_.empty())
+				freed_.wait(lock);
+			throwIfFailed();
+		}
+		tail = (head_ + count_) % slots_.size();
+	}
+	// the writer thread does not touch slots beyond the queue
+	Slot& s = slots_[tail];
+	s.out = &out;
+	s.t = t;
+	s.record.resize(out.recordSize());
+	if (!s.record.empty())
+		out.sample(&s.record[0]);
+	{
+		boost::mutex::scoped_lock lock(mutex_);
+		++count_;
+	}
+	queued_.notify_one();
+}
+
+void AsyncWriter::flush()
+{
+	boost::mutex::scoped_lock lock(mutex_);
+	while ((count_ > 0 || busy_) && error_.empty())
+		freed_.wait(lock);
+	throwIfFailed();
+}
+
+void AsyncWriter::throwIfFailed()
+{
+	if (!error_.empty())
+		throw std::runtime_error("Asynchronous output failed: " + error_);
+}
+
+void AsyncWriter::run()
+{
+	boost::mutex::scoped_lock lock(mutex_);
+	while (true)
+	{
+		if (count_ == 0)
+		{
+			if (!dirty_.empty())
+			{
+				// flush while the simulation thread may continue
+				busy_ = true;
+				lock.unlock();
+				for (std::vector<std::ostream*>::iterator s = dirty_.begin(); s
+						!= dirty_.end(); ++s)
+					(*s)->flush();
+				dirty_.clear();
+				lock.lock();
+				busy_ = false;
+				freed_.notify_all();
+				continue;
+			}
+			if (stop_)
+				return;
+			queued_.wait(lock);
+			continue;
+		}
+		Slot& s = slots_[head_];
+		busy_ = true;
+		lock.unlock();
+		try
+		{
+			s.out->format(s.t, s.record.empty() ? 0 : &s.record[0]);
+			std::ostream* out = &s.out->stream();
+			if (std::find(dirty_.begin(), dirty_.end(), out) == dirty_.end())
+				dirty_.push_back(out);
+		} catch (std::exception& e)
+		{
+			lock.lock();
+			error_ = e.what();
+			busy_ = false;
+			count_ = 0;
+			freed_.notify_all();
+			return;
+		}
+		lock.lock();
+		busy_ = false;
+		head_ = (head_ + 1) % slots_.size();
+		--count_;
+		freed_.notify_all();
+	}
+}
+
+}
+}
@@ -0,0 +1,95 @@
+/**
+ * @file AsyncWriter.h
+ * @date 18.10.2026
+ */
+
+#ifndef ASYNCWRITER_H_
+#define ASYNCWRITER_H_
+
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <iosfwd>
+
+namespace sim
+{
+namespace output
+{
+
+class RecordOutput;
+
+/**
+ * Background writer for RecordOutputs.
+ *
+ * Records are sampled on the simulation thread into a ring of capacity()
+ * preallocated slots, and a background thread formats and writes them. The
+ * streams are flushed whenever the ring runs empty. If the writer falls
+ * behind, e.g. on a slow network filesystem, submit() blocks until a slot is
+ * free, so that memory use stays bounded; stalls() counts these waits.
+ *
+ * The writer must be destroyed, or flush()ed, before any RecordOutput or
+ * stream it has records for. Errors of the writer thread are reported as
+ * std::runtime_error by the next call to submit() or flush().
+ */
+class AsyncWriter: public boost::noncopyable
+{
+public:
+	/**
+	 * Constructor
+	 * @param capacity maximum number of records waiting to be written
+	 */
+	explicit AsyncWriter(std::size_t capacity = 1024);
+	/// Write all pending records and stop the writer thread.
+	~AsyncWriter();
+
+	/**
+	 * Sample a record of @p out at time @p t and queue it for writing.
+	 * Blocks while the queue is full.
+	 */
+	void submit(RecordOutput& out, double t);
+	/**
+	 * Wait until all queued records are written and the streams flushed.
+	 */
+	void flush();
+
+	std::size_t capacity() const
+	{
+		return slots_.size();
+	}
+	/// Number of times submit() had to wait for a free slot
+	unsigned long stalls() const
+	{
+		return stalls_;
+	}
+
+private:
+	struct Slot
+	{
+		RecordOutput* out;
+		double t;
+		std::vector<double> record;
+	};
+
+	void run();
+	void throwIfFailed();
+
+	std::vector<Slot> slots_;
+	std::size_t head_, count_;
+	bool busy_, stop_;
+	unsigned long stalls_;
+	std::string error_;
+	std::vector<std::ostream*> dirty_; ///< streams written since the last flush
+	boost::mutex mutex_;
+	boost::condition_variable queued_, freed_;
+	boost::scoped_ptr<boost::thread> thread_;
+};
+
+}
+}
+
+#endif /* ASYNCWRITER_H_ */
@@ -0,0 +1,462 @@
+/**
+ * @file BinaryTimeSeries.cpp
+ * @date 18.10.2026
+ */
+
+#include "BinaryTimeSeries.h"
+#include <largenet2/io/varint.h>
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+#include <cstring>
+#include <cmath>
+
+using namespace std;
+using largenet::io::putVarint;
+using largenet::io::getVarint;
+using largenet::io::zigzag;
+using largenet::io::unzigzag;
+
+namespace sim
+{
+namespace output
+{
+
+namespace
+{
+
+const char fileMagic[4] = { 'L', 'N', 'T', 'S' };
+const char indexMagic[4] = { 'L', 'N', 'T', 'X' };
+const boost::uint32_t formatVersion = 1;
+const boost::uint32_t compressedFlag = 1;
+
+/// column encodings in compressed blocks
+enum ColumnEncoding
+{
+	RAW_DOUBLES = 0, INTEGER_DELTAS = 1
+};
+
+/// footer size after the index entries: records, index offset, magic
+const std::size_t footerSize = 2 * sizeof(boost::uint64_t) + 4;
+const std::size_t indexEntrySize = 2 * sizeof(boost::uint64_t) + sizeof(double);
+
+void appendDoubles(string& buf, const vector<double>& x)
+{
+	if (!x.empty())
+		buf.append(reinterpret_cast<const char*> (&x[0]), x.size()
+				* sizeof(double));
+}
+
+void readDoubles(const char*& p, const char* end, vector<double>& x,
+		const std::size_t n)
+{
+	if (static_cast<std::size_t> (end - p) < n * sizeof(double))
+		throw runtime_error("Truncated time series block.");
+	x.resize(n);
+	if (n > 0)
+		memcpy(&x[0], p, n * sizeof(double));
+	p += n * sizeof(double);
+}
+
+/// orders block index entries by their first time
+struct FirstTimeLess
+{
+	template<class Entry>
+	bool operator()(const double t, const Entry& e) const
+	{
+		return t < e.firstTime;
+	}
+};
+
+bool integral(const vector<double>& x)
+{
+	for (vector<double>::const_iterator v = x.begin(); v != x.end(); ++v)
+		if (!(std::fabs(*v) < 9007199254740992.0) || *v != std::floor(*v))
+			return false;
+	return true;
+}
+
+}
+
+BinaryTimeSeriesWriter::BinaryTimeSeriesWriter(ostream& out,
+		const vector<string>& columns, const bool compress,
+		const unsigned int blockSize) :
+	out_(out), columns_(columns), compress_(compress), blockSize_(
+			max(blockSize, 1u)), headerWritten_(false), finished_(false),
+			offset_(0), records_(0), values_(columns.size())
+{
+}
+
+BinaryTimeSeriesWriter::~BinaryTimeSeriesWriter()
+{
+	try
+	{
+		finish();
+	} catch (...)
+	{
+	}
+}
+
+void BinaryTimeSeriesWriter::put(const void* data, const std::size_t size)
+{
+	if (out_.rdbuf()->sputn(static_cast<const char*> (data), size)
+			!= static_cast<streamsize> (size))
+		throw runtime_error("Could not write time series.");
+	offset_ += size;
+}
+
+void BinaryTimeSeriesWriter::writeHeader()
+{
+	if (headerWritten_)
+		return;
+	headerWritten_ = true;
+	const boost::uint32_t flags = compress_ ? compressedFlag : 0;
+	const boost::uint32_t n = columns_.size();
+	put(fileMagic, 4);
+	put(&formatVersion, sizeof(formatVersion));
+	put(&flags, sizeof(flags));
+	put(&n, sizeof(n));
+	put(&blockSize_, sizeof(blockSize_));
+	for (vector<string>::const_iterator c = columns_.begin(); c
+			!= columns_.end(); ++c)
+	{
+		const boost::uint32_t len = c->size();
+		put(&len, sizeof(len));
+		put(c->data(), len);
+	}
+}
+
+void BinaryTimeSeriesWriter::append(const double t, const double* values)
+{
+	if (finished_)
+		throw logic_error("Time series has already been finished.");
+	times_.push_back(t);
+	for (std::size_t c = 0; c < columns_.size(); ++c)
+		values_[c].push_back(values[c]);
+	if (times_.size() == blockSize_)
+		writeBlock();
+}
+
+void BinaryTimeSeriesWriter::writeBlock()
+{
+	writeHeader();
+	if (times_.empty())
+		return;
+	payload_.clear();
+	appendDoubles(payload_, times_);
+	for (std::size_t c = 0; c < columns_.size(); ++c)
+	{
+		const vector<double>& x = values_[c];
+		if (!compress_)
+			appendDoubles(payload_, x);
+		else if (integral(x))
+		{
+			payload_.push_back(static_cast<char> (INTEGER_DELTAS));
+			boost::int64_t prev = 0;
+			for (vector<double>::const_iterator v = x.begin(); v != x.end(); ++v)
+			{
+				const boost::int64_t i = static_cast<boost::int64_t> (*v);
+				putVarint(payload_, zigzag(i - prev));
+				prev = i;
+			}
+		}
+		else
+		{
+			payload_.push_back(static_cast<char> (RAW_DOUBLES));
+			appendDoubles(payload_, x);
+		}
+	}
+
+	IndexEntry e;
+	e.offset = offset_;
+	e.firstRecord = records_;
+	e.firstTime = times_.front();
+	index_.push_back(e);
+
+	const boost::uint32_t n = times_.size(), bytes = payload_.size();
+	put(&n, sizeof(n));
+	put(&bytes, sizeof(bytes));
+	put(payload_.data(), payload_.size());
+	records_ += n;
+	times_.clear();
+	for (std::size_t c = 0; c < columns_.size(); ++c)
+		values_[c].clear();
+}
+
+void BinaryTimeSeriesWriter::finish()
+{
+	if (finished_)
+		return;
+	writeBlock();
+	finished_ = true;
+	const boost::uint64_t indexOffset = offset_, blocks = index_.size();
+	put(&blocks, sizeof(blocks));
+	for (vector<IndexEntry>::const_iterator e = index_.begin(); e
+			!= index_.end(); ++e)
+	{
+		put(&e->offset, sizeof(e->offset));
+		put(&e->firstRecord, sizeof(e->firstRecord));
+		put(&e->firstTime, sizeof(e->firstTime));
+	}
+	put(&records_, sizeof(records_));
+	put(&indexOffset, sizeof(indexOffset));
+	put(indexMagic, 4);
+	out_.flush();
+}
+
+BinaryTimeSeriesReader::BinaryTimeSeriesReader(istream& in) :
+	in_(in), compressed_(false), records_(0), dataStart_(0), block_(0),
+			pos_(0)
+{
+	char magic[4];
+	get(magic, 4);
+	if (memcmp(magic, fileMagic, 4) != 0)
+		throw runtime_error("Not a binary time series.");
+	boost::uint32_t version, flags, n, blockSize;
+	get(&version, sizeof(version));
+	if (version != formatVersion)
+		throw runtime_error("Unsupported time series format version.");
+	get(&flags, sizeof(flags));
+	get(&n, sizeof(n));
+	get(&blockSize, sizeof(blockSize));
+	compressed_ = (flags & compressedFlag) != 0;
+	for (boost::uint32_t c = 0; c < n; ++c)
+	{
+		boost::uint32_t len;
+		get(&len, sizeof(len));
+		string name(len, ' ');
+		if (len > 0)
+			get(&name[0], len);
+		columns_.push_back(name);
+	}
+	dataStart_ = in_.tellg();
+	if (!readIndex())
+		scanBlocks();
+	values_.resize(columns_.size());
+	block_ = index_.size();
+	rewind();
+}
+
+void BinaryTimeSeriesReader::get(void* data, const std::size_t size)
+{
+	if (in_.rdbuf()->sgetn(static_cast<char*> (data), size)
+			!= static_cast<streamsize> (size))
+		throw runtime_error("Truncated time series.");
+}
+
+bool BinaryTimeSeriesReader::readIndex()
+{
+	in_.clear();
+	in_.seekg(0, ios::end);
+	const streamoff size = in_.tellg();
+	if (size < dataStart_ + static_cast<streamoff> (footerSize
+			+ sizeof(boost::uint64_t)))
+		return false;
+	in_.seekg(size - static_cast<streamoff> (footerSize));
+	boost::uint64_t records, indexOffset;
+	char magic[4];
+	get(&records, sizeof(records));
+	get(&indexOffset, sizeof(indexOffset));
+	get(magic, 4);
+	if (memcmp(magic, indexMagic, 4) != 0 || indexOffset
+			< static_cast<boost::uint64_t> (dataStart_))
+		return false;
+	in_.seekg(indexOffset);
+	boost::uint64_t blocks;
+	get(&blocks, sizeof(blocks));
+	if (indexOffset + sizeof(blocks) + blocks * indexEntrySize + footerSize
+			!= static_cast<boost::uint64_t> (size))
+		return false;
+	index_.resize(blocks);
+	for (vector<IndexEntry>::iterator e = index_.begin(); e != index_.end(); ++e)
+	{
+		get(&e->offset, sizeof(e->offset));
+		get(&e->firstRecord, sizeof(e->firstRecord));
+		get(&e->firstTime, sizeof(e->firstTime));
+	}
+	records_ = records;
+	return true;
+}
+
+void BinaryTimeSeriesReader::scanBlocks()
+{
+	index_.clear();
+	records_ = 0;
+	in_.clear();
+	in_.seekg(0, ios::end);
+	const streamoff size = in_.tellg();
+	streamoff offset = dataStart_;
+	while (offset + static_cast<streamoff> (2 * sizeof(boost::uint32_t)
+			+ sizeof(double)) <= size)
+	{
+		in_.seekg(offset);
+		boost::uint32_t n, bytes;
+		get(&n, sizeof(n));
+		get(&bytes, sizeof(bytes));
+		const streamoff end = offset + static_cast<streamoff> (2
+				* sizeof(boost::uint32_t)) + bytes;
+		// stop at a partially written block
+		if (n == 0 || end > size || bytes < n * sizeof(double))
+			break;
+		IndexEntry e;
+		e.offset = offset;
+		e.firstRecord = records_;
+		get(&e.firstTime, sizeof(e.firstTime));
+		index_.push_back(e);
+		records_ += n;
+		offset = end;
+	}
+	in_.clear();
+}
+
+void BinaryTimeSeriesReader::loadBlock(const std::size_t b)
+{
+	block_ = b;
+	pos_ = 0;
+	times_.clear();
+	for (std::size_t c = 0; c < values_.size(); ++c)
+		values_[c].clear();
+	if (b >= index_.size())
+		return;
+	in_.clear();
+	in_.seekg(index_[b].offset);
+	boost::uint32_t n, bytes;
+	get(&n, sizeof(n));
+	get(&bytes, sizeof(bytes));
+	payload_.resize(bytes);
+	if (bytes > 0)
+		get(&payload_[0], bytes);
+	const char* p = payload_.data();
+	const char* end = p + payload_.size();
+	readDoubles(p, end, times_, n);
+	for (std::size_t c = 0; c < values_.size(); ++c)
+	{
+		vector<double>& x = values_[c];
+		int encoding = RAW_DOUBLES;
+		if (compressed_)
+		{
+			if (p == end)
+				throw runtime_error("Truncated time series block.");
+			encoding = *p++;
+		}
+		if (encoding == RAW_DOUBLES)
+			readDoubles(p, end, x, n);
+		else if (encoding == INTEGER_DELTAS)
+		{
+			x.resize(n);
+			boost::int64_t prev = 0;
+			for (boost::uint32_t i = 0; i < n; ++i)
+			{
+				prev += unzigzag(getVarint(p, end));
+				x[i] = static_cast<double> (prev);
+			}
+		}
+		else
+			throw runtime_error("Unknown column encoding in time series.");
+	}
+}
+
+std::size_t BinaryTimeSeriesReader::column(const string& name) const
+{
+	vector<string>::const_iterator c = find(columns_.begin(), columns_.end(),
+			name);
+	if (c == columns_.end())
+		throw invalid_argument("No time series column " + name);
+	return c - columns_.begin();
+}
+
+bool BinaryTimeSeriesReader::next(double& t, vector<double>& values)
+{
+	while (pos_ == times_.size())
+	{
+		if (block_ + 1 >= index_.size())
+			return false;
+		loadBlock(block_ + 1);
+	}
+	t = times_[pos_];
+	values.resize(values_.size());
+	for (std::size_t c = 0; c < values_.size(); ++c)
+		values[c] = values_[c][pos_];
+	++pos_;
+	return true;
+}
+
+void BinaryTimeSeriesReader::rewind()
+{
+	if (index_.empty())
+	{
+		block_ = 0;
+		pos_ = 0;
+		times_.clear();
+	}
+	else
+		loadBlock(0);
+}
+
+void BinaryTimeSeriesReader::seek(const double t)
+{
+	// last block starting at or before t
+	vector<IndexEntry>::const_iterator b = upper_bound(index_.begin(),
+			index_.end(), t, FirstTimeLess());
+	if (b != index_.begin())
+		--b;
+	if (b == index_.end())
+		return rewind();
+	if (static_cast<std::size_t> (b - index_.begin()) != block_)
+		loadBlock(b - index_.begin());
+	pos_ = lower_bound(times_.begin(), times_.end(), t) - times_.begin();
+}
+
+vector<double> BinaryTimeSeriesReader::times()
+{
+	vector<double> x;
+	x.reserve(records_);
+	for (std::size_t b = 0; b < index_.size(); ++b)
+	{
+		loadBlock(b);
+		x.insert(x.end(), times_.begin(), times_.end());
+	}
+	rewind();
+	return x;
+}
+
+vector<double> BinaryTimeSeriesReader::values(const std::size_t c)
+{
+	if (c >= columns_.size())
+		throw invalid_argument("No such time series column.");
+	vector<double> x;
+	x.reserve(records_);
+	for (std::size_t b = 0; b < index_.size(); ++b)
+	{
+		loadBlock(b);
+		x.insert(x.end(), values_[c].begin(), values_[c].end());
+	}
+	rewind();
+	return x;
+}
+
+void BinaryTimeSeriesReader::writeText(ostream& out, const string& commentChar)
+{
+	const char tab = '\t';
+	out << commentChar << "   t";
+	for (vector<string>::const_iterator c = columns_.begin(); c
+			!= columns_.end(); ++c)
+		out << tab << *c;
+	out << "\n";
+	rewind();
+	double t;
+	vector<double> values;
+	const streamsize precision = out.precision();
+	while (next(t, values))
+	{
+		out << setprecision(9) << t << setprecision(15);
+		for (std::size_t c = 0; c < values.size(); ++c)
+			out << tab << values[c];
+		out << "\n";
+	}
+	out.precision(precision);
+	rewind();
+}
+
+}
+}
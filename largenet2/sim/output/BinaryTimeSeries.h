@@ -0,0 +1,185 @@
+/**
+ * @file BinaryTimeSeries.h
+ * @date 18.10.2026
+ */
+
+#ifndef BINARYTIMESERIES_H_
+#define BINARYTIMESERIES_H_
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace sim
+{
+namespace output
+{
+
+/**
+ * Writer for binary columnar time series.
+ *
+ * A time series file consists of
+ * - a self-describing header: magic "LNTS", format version, flags, number of
+ *   columns, block size, and the column names;
+ * - blocks of up to blockSize() records, each stored column by column (first
+ *   all times, then all values of the first column, etc.), preceded by the
+ *   number of records and the payload size;
+ * - a block index with the file offset, first record number, and first time
+ *   of each block, for seeking, followed by the index offset and the magic
+ *   "LNTX".
+ *
+ * Uncompressed blocks hold fixed-width doubles. With compression, times are
+ * stored unchanged, and each value column that contains only integers (such
+ * as node and link counts) is stored as zigzag varint deltas between
+ * consecutive records, typically one byte per value; other columns are
+ * stored as plain doubles. Numbers use the native byte order, like
+ * largenet::io::BinWriter.
+ *
+ * Use BinaryTimeSeriesReader to read the files.
+ */
+class BinaryTimeSeriesWriter: public boost::noncopyable
+{
+public:
+	/**
+	 * Constructor
+	 * @param out binary stream, positioned at its beginning
+	 * @param columns names of the value columns
+	 * @param compress delta-encode integer columns
+	 * @param blockSize number of records per block
+	 */
+	BinaryTimeSeriesWriter(std::ostream& out,
+			const std::vector<std::string>& columns, bool compress = true,
+			unsigned int blockSize = 1024);
+	/// Calls finish().
+	~BinaryTimeSeriesWriter();
+
+	/// Write the header, unless it has already been written.
+	void writeHeader();
+	/// Append a record with time @p t and columns().size() @p values.
+	void append(double t, const double* values);
+	/**
+	 * Write the last block and the block index. Further records cannot be
+	 * appended.
+	 */
+	void finish();
+
+	const std::vector<std::string>& columns() const
+	{
+		return columns_;
+	}
+	unsigned int blockSize() const
+	{
+		return blockSize_;
+	}
+
+private:
+	void writeBlock();
+	void put(const void* data, std::size_t size);
+
+	std::ostream& out_;
+	std::vector<std::string> columns_;
+	bool compress_;
+	unsigned int blockSize_;
+	bool headerWritten_, finished_;
+	boost::uint64_t offset_; ///< bytes written so far
+	boost::uint64_t records_; ///< records written in completed blocks
+	std::vector<double> times_;
+	std::vector<std::vector<double> > values_; ///< current block, by column
+	std::string payload_;
+	struct IndexEntry
+	{
+		boost::uint64_t offset, firstRecord;
+		double firstTime;
+	};
+	std::vector<IndexEntry> index_;
+};
+
+/**
+ * Reader for files written by BinaryTimeSeriesWriter.
+ *
+ * Records can be read sequentially with next(), starting at any time with
+ * seek(), or column by column. Files without a block index, e.g. from an
+ * interrupted simulation, are indexed by scanning the complete blocks.
+ * Malformed files cause std::runtime_error.
+ */
+class BinaryTimeSeriesReader: public boost::noncopyable
+{
+public:
+	/// Read the header and block index from the seekable stream @p in.
+	explicit BinaryTimeSeriesReader(std::istream& in);
+
+	const std::vector<std::string>& columns() const
+	{
+		return columns_;
+	}
+	/// Index of column @p name; throws std::invalid_argument if unknown.
+	std::size_t column(const std::string& name) const;
+	bool compressed() const
+	{
+		return compressed_;
+	}
+	boost::uint64_t records() const
+	{
+		return records_;
+	}
+	std::size_t blocks() const
+	{
+		return index_.size();
+	}
+
+	/**
+	 * Read the next record.
+	 * @return false at the end of the series
+	 */
+	bool next(double& t, std::vector<double>& values);
+	/// Position at the first record with time at least @p t.
+	void seek(double t);
+	/// Position at the first record.
+	void rewind();
+
+	/// All times.
+	std::vector<double> times();
+	/// All values of column @p c.
+	std::vector<double> values(std::size_t c);
+	std::vector<double> values(const std::string& name)
+	{
+		return values(column(name));
+	}
+
+	/**
+	 * Convert to the text format of TimeSeriesOutput: a header line and one
+	 * tab-separated line per record.
+	 */
+	void writeText(std::ostream& out, const std::string& commentChar = "#");
+
+private:
+	struct IndexEntry
+	{
+		boost::uint64_t offset, firstRecord;
+		double firstTime;
+	};
+	void get(void* data, std::size_t size);
+	bool readIndex();
+	void scanBlocks();
+	void loadBlock(std::size_t b);
+
+	std::istream& in_;
+	std::vector<std::string> columns_;
+	bool compressed_;
+	boost::uint64_t records_;
+	std::streamoff dataStart_;
+	std::vector<IndexEntry> index_;
+	std::size_t block_; ///< loaded block, blocks() if none
+	std::size_t pos_; ///< next record within the loaded block
+	std::vector<double> times_;
+	std::vector<std::vector<double> > values_;
+	std::string payload_;
+};
+
+}
+}
+
+#endif /* BINARYTIMESERIES_H_ */
@@ -0,0 +1,78 @@
+/**
+ * @file BinaryTimeSeriesOutput.h
+ * @date 18.10.2026
+ */
+
+#ifndef BINARYTIMESERIESOUTPUT_H_
+#define BINARYTIMESERIESOUTPUT_H_
+
+#include <largenet2/sim/output/TimeSeriesOutput.h>
+#include <largenet2/sim/output/BinaryTimeSeries.h>
+
+namespace sim
+{
+namespace output
+{
+
+/**
+ * Outputs the same node and link counts as TimeSeriesOutput, but in the
+ * binary columnar format of BinaryTimeSeriesWriter, with one column per
+ * motif. Open the stream in binary mode. The file is completed when the
+ * output is destroyed, or by finish().
+ *
+ * Read the files with BinaryTimeSeriesReader, which can also convert them to
+ * the text format of TimeSeriesOutput.
+ */
+template<class _Graph, class _LinkStateCalculator>
+class BinaryTimeSeriesOutput: public TimeSeriesOutput<_Graph,
+		_LinkStateCalculator>
+{
+public:
+	/**
+	 * Constructor
+	 * @param out binary stream, positioned at its beginning
+	 * @param net graph
+	 * @param lsc link state calculator
+	 * @param interval time between records
+	 * @param directedMotifs count directed link motifs
+	 * @param compress delta-encode the counts
+	 * @param blockSize number of records per block
+	 * @param triples if given, also output its triple counts
+	 */
+	BinaryTimeSeriesOutput(std::ostream& out, const _Graph& net,
+			const _LinkStateCalculator& lsc, double interval,
+			bool directedMotifs, bool compress = true,
+			unsigned int blockSize = 1024,
+			const largenet::measures::TripleCounter* triples = 0) :
+		TimeSeriesOutput<_Graph, _LinkStateCalculator> (out, net, lsc,
+				interval, directedMotifs, triples), writer_(out, this->columnNames(),
+				compress, blockSize)
+	{
+	}
+	virtual ~BinaryTimeSeriesOutput()
+	{
+	}
+
+	/// Write the last block and the block index.
+	void finish()
+	{
+		writer_.finish();
+	}
+
+private:
+	void doFormat(std::ostream&, double t, const double* record)
+	{
+		writer_.append(t, record);
+	}
+	void doWriteHeader()
+	{
+		writer_.writeHeader();
+	}
+
+	BinaryTimeSeriesWriter writer_;
+};
+
+}
+}
+
+#endif /* BINARYTIMESERIESOUTPUT_H_ */
@@ -10,9 +10,10 @@
 #include <largenet2/sim/output/IntervalOutput.h>
 #include <largenet2/motifs/motifs.h>
 #include <largenet2/measures/DegreeDistribution.h>
-#include <boost/ptr_container/ptr_map.hpp>
+#include <largenet2/measures/DegreeHistogram.h>
 #include <iomanip>
 #include <algorithm>
+#include <vector>
 
 namespace lmo = largenet::motifs;
 namespace lmeas = largenet::measures;
@@ -23,16 +24,53 @@ namespace sim
 namespace output
 {
 
+namespace detail
+{
+
+/**
+ * Write one line per degree k = 0, ..., @p maxDegree, holding t, k, and the
+ * number of nodes of degree k in each of the distributions @p dists.
+ */
+inline void writeDegreeDistributions(std::ostream& out, const double t,
+		const largenet::degree_t maxDegree,
+		const std::vector<const lmeas::degree_dist_t*>& dists)
+{
+	const char tab = '\t';
+	for (largenet::degree_t k = 0; k <= maxDegree; ++k)
+	{
+		out << t << tab << k;
+		for (std::vector<const lmeas::degree_dist_t*>::const_iterator d =
+				dists.begin(); d != dists.end(); ++d)
+			out << tab << (k < (*d)->size() ? (**d)[k] : 0);
+		out << "\n";
+	}
+	out << "\n\n";
+}
+
+/// copy of a degree distribution computed by a full scan
+template<class _Dist>
+lmeas::degree_dist_t scanned(const _Dist& d)
+{
+	return lmeas::degree_dist_t(d.begin(), d.end());
+}
+
+}
+
 /**
  * Calculates and outputs the *directed* degree distribution for each node state in the network.
+ *
+ * If a DegreeHistogram of the network is given, the distributions are read
+ * from it; otherwise they are computed by scanning the network at each
+ * output time.
  */
 template<class _Graph>
 class DegDistOutput: public IntervalOutput
 {
 public:
-	DegDistOutput(std::ostream& out, const _Graph& net, double interval) :
+	DegDistOutput(std::ostream& out, const _Graph& net, double interval,
+			const lmeas::DegreeHistogram* hist = 0) :
 		IntervalOutput(out, interval), net_(net), nodeMotifs_(
-				net_.numberOfNodeStates())
+				net_.numberOfNodeStates()), hist_(hist)
 	{
 	}
 	virtual ~DegDistOutput()
@@ -42,45 +80,43 @@ public:
 private:
 	void doOutput(double t)
 	{
-		typedef boost::ptr_map<lmo::NodeMotif, lmeas::InDegreeDistribution>
-				in_dist_map;
-		typedef boost::ptr_map<lmo::NodeMotif, lmeas::OutDegreeDistribution>
-				out_dist_map;
+		std::vector<const lmeas::degree_dist_t*> dists;
+		if (hist_)
+		{
+			for (lmo::NodeMotifSet::const_iterator motif = nodeMotifs_.begin(); motif
+					!= nodeMotifs_.end(); ++motif)
+				dists.push_back(&hist_->distribution(
+						lmeas::DegreeHistogram::IN_DEGREE, *motif));
+			for (lmo::NodeMotifSet::const_iterator motif = nodeMotifs_.begin(); motif
+					!= nodeMotifs_.end(); ++motif)
+				dists.push_back(&hist_->distribution(
+						lmeas::DegreeHistogram::OUT_DEGREE, *motif));
+			detail::writeDegreeDistributions(stream(), t, std::max(
+					hist_->maxDegree(lmeas::DegreeHistogram::IN_DEGREE),
+					hist_->maxDegree(lmeas::DegreeHistogram::OUT_DEGREE)), dists);
+			return;
+		}
 
-		in_dist_map in_dists;
-		out_dist_map out_dists;
+		std::vector<lmeas::degree_dist_t> scans;
 		largenet::degree_t maxDegree = 0;
 		for (lmo::NodeMotifSet::const_iterator motif = nodeMotifs_.begin(); motif
 				!= nodeMotifs_.end(); ++motif)
 		{
-			lmeas::InDegreeDistribution* d1 = new lmeas::InDegreeDistribution(
-					net_, *motif);
-			in_dists.insert(*motif, std::auto_ptr<lmeas::InDegreeDistribution>(
-					d1));
-			lmeas::OutDegreeDistribution* d2 =
-					new lmeas::OutDegreeDistribution(net_, *motif);
-			out_dists.insert(*motif,
-					std::auto_ptr<lmeas::OutDegreeDistribution>(d2));
-
-			if (maxDegree < d1->maxDegree())
-				maxDegree = d1->maxDegree();
-			if (maxDegree < d2->maxDegree())
-				maxDegree = d2->maxDegree();
+			lmeas::InDegreeDistribution d(net_, *motif);
+			scans.push_back(detail::scanned(d));
+			maxDegree = std::max(maxDegree, d.maxDegree());
 		}
-
-		const char tab = '\t';
-		for (largenet::degree_t k = 0; k <= maxDegree; ++k)
+		for (lmo::NodeMotifSet::const_iterator motif = nodeMotifs_.begin(); motif
+				!= nodeMotifs_.end(); ++motif)
 		{
-			stream() << t << tab << k;
-			for (in_dist_map::const_iterator i = in_dists.begin(); i
-					!= in_dists.end(); ++i)
-				stream() << tab << (*i->second)[k];
-			for (out_dist_map::const_iterator i = out_dists.begin(); i
-					!= out_dists.end(); ++i)
-				stream() << tab << (*i->second)[k];
-			stream() << "\n";
+			lmeas::OutDegreeDistribution d(net_, *motif);
+			scans.push_back(detail::scanned(d));
+			maxDegree = std::max(maxDegree, d.maxDegree());
 		}
-		stream() << "\n\n";
+		for (std::vector<lmeas::degree_dist_t>::const_iterator d = scans.begin(); d
+				!= scans.end(); ++d)
+			dists.push_back(&*d);
+		detail::writeDegreeDistributions(stream(), t, maxDegree, dists);
 	}
 
 	void doWriteHeader()
@@ -99,15 +135,22 @@ private:
 
 	const _Graph& net_;
 	lmo::NodeMotifSet nodeMotifs_;
+	const lmeas::DegreeHistogram* hist_;
 };
 
+/**
+ * Calculates and outputs the *directed* degree distribution of all nodes in the network.
+ *
+ * If a DegreeHistogram of the network is given, the distributions are read
+ * from it.
+ */
 template<class _Graph>
 class StatelessDegDistOutput: public IntervalOutput
 {
 public:
 	StatelessDegDistOutput(std::ostream& out, const _Graph& net,
-			double interval) :
-		IntervalOutput(out, interval), net_(net)
+			double interval, const lmeas::DegreeHistogram* hist = 0) :
+		IntervalOutput(out, interval), net_(net), hist_(hist)
 	{
 	}
 	virtual ~StatelessDegDistOutput()
@@ -117,18 +160,27 @@ public:
 private:
 	void doOutput(double t)
 	{
-		lmeas::InDegreeDistribution in_dist(net_);
-		lmeas::OutDegreeDistribution out_dist(net_);
-		largenet::degree_t maxDegree = std::max(in_dist.maxDegree(),
-				out_dist.maxDegree());
-
-		const char tab = '\t';
-		for (largenet::degree_t k = 0; k <= maxDegree; ++k)
+		std::vector<const lmeas::degree_dist_t*> dists;
+		if (hist_)
 		{
-			stream() << t << tab << k << tab << in_dist[k] << tab
-					<< out_dist[k] << "\n";
+			dists.push_back(&hist_->distribution(
+					lmeas::DegreeHistogram::IN_DEGREE));
+			dists.push_back(&hist_->distribution(
+					lmeas::DegreeHistogram::OUT_DEGREE));
+			detail::writeDegreeDistributions(stream(), t, std::max(
+					hist_->maxDegree(lmeas::DegreeHistogram::IN_DEGREE),
+					hist_->maxDegree(lmeas::DegreeHistogram::OUT_DEGREE)), dists);
+			return;
 		}
-		stream() << "\n\n";
+
+		lmeas::InDegreeDistribution in_dist(net_);
+		lmeas::OutDegreeDistribution out_dist(net_);
+		const lmeas::degree_dist_t in = detail::scanned(in_dist), out =
+				detail::scanned(out_dist);
+		dists.push_back(&in);
+		dists.push_back(&out);
+		detail::writeDegreeDistributions(stream(), t, std::max(
+				in_dist.maxDegree(), out_dist.maxDegree()), dists);
 	}
 
 	void doWriteHeader()
@@ -139,15 +191,23 @@ private:
 	}
 
 	const _Graph& net_;
+	const lmeas::DegreeHistogram* hist_;
 };
 
+/**
+ * Calculates and outputs the undirected degree distribution for each node state in the network.
+ *
+ * If a DegreeHistogram of the network is given, the distributions are read
+ * from it.
+ */
 template<class _Graph>
 class UndirectedDegDistOutput: public IntervalOutput
 {
 public:
-	UndirectedDegDistOutput(std::ostream& out, const _Graph& net, double interval) :
+	UndirectedDegDistOutput(std::ostream& out, const _Graph& net,
+			double interval, const lmeas::DegreeHistogram* hist = 0) :
 		IntervalOutput(out, interval), net_(net), nodeMotifs_(
-				net_.numberOfNodeStates())
+				net_.numberOfNodeStates()), hist_(hist)
 	{
 	}
 	virtual ~UndirectedDegDistOutput()
@@ -157,32 +217,31 @@ public:
 private:
 	void doOutput(double t)
 	{
-		typedef boost::ptr_map<lmo::NodeMotif, lmeas::UndirectedDegreeDistribution>
-				un_dist_map;
+		std::vector<const lmeas::degree_dist_t*> dists;
+		if (hist_)
+		{
+			for (lmo::NodeMotifSet::const_iterator motif = nodeMotifs_.begin(); motif
+					!= nodeMotifs_.end(); ++motif)
+				dists.push_back(&hist_->distribution(
+						lmeas::DegreeHistogram::UNDIRECTED_DEGREE, *motif));
+			detail::writeDegreeDistributions(stream(), t, hist_->maxDegree(
+					lmeas::DegreeHistogram::UNDIRECTED_DEGREE), dists);
+			return;
+		}
 
-		un_dist_map un_dists;
+		std::vector<lmeas::degree_dist_t> scans;
 		largenet::degree_t maxDegree = 0;
 		for (lmo::NodeMotifSet::const_iterator motif = nodeMotifs_.begin(); motif
 				!= nodeMotifs_.end(); ++motif)
 		{
-			lmeas::UndirectedDegreeDistribution* d1 = new lmeas::UndirectedDegreeDistribution(
-					net_, *motif);
-			un_dists.insert(*motif, std::auto_ptr<lmeas::UndirectedDegreeDistribution>(
-					d1));
-			if (maxDegree < d1->maxDegree())
-				maxDegree = d1->maxDegree();
-		}
-
-		const char tab = '\t';
-		for (largenet::degree_t k = 0; k <= maxDegree; ++k)
-		{
-			stream() << t << tab << k;
-			for (un_dist_map::const_iterator i = un_dists.begin(); i
-					!= un_dists.end(); ++i)
-				stream() << tab << (*i->second)[k];
-			stream() << "\n";
+			lmeas::UndirectedDegreeDistribution d(net_, *motif);
+			scans.push_back(detail::scanned(d));
+			maxDegree = std::max(maxDegree, d.maxDegree());
 		}
-		stream() << "\n\n";
+		for (std::vector<lmeas::degree_dist_t>::const_iterator d = scans.begin(); d
+				!= scans.end(); ++d)
+			dists.push_back(&*d);
+		detail::writeDegreeDistributions(stream(), t, maxDegree, dists);
 	}
 
 	void doWriteHeader()
@@ -197,6 +256,7 @@ private:
 
 	const _Graph& net_;
 	lmo::NodeMotifSet nodeMotifs_;
+	const lmeas::DegreeHistogram* hist_;
 };
 
 }
@@ -24,6 +24,7 @@ IntervalOutput::~IntervalOutput()
 
 void IntervalOutput::output(const double t, const bool force)
 {
+	doObserve(t);
 	if (force || t >= nextOutputTime_)
 	{
 		doOutput(t);
@@ -25,11 +25,30 @@ public:
 	std::string commentChar() const;
 	void output(double t, bool force=false);
 	void writeHeader();
+	/**
+	 * Check whether this output asks the simulation loop to terminate,
+	 * e.g. because a steady state has been detected.
+	 */
+	bool stopRequested() const;
 protected:
 	std::ostream& stream() const;
+	/// Time of the next regular output.
+	double nextOutputTime() const;
 private:
+	/**
+	 * Called by output() for every time @p t it is called with, before any
+	 * output is written; outputs that follow the dynamics between output
+	 * times override this.
+	 */
+	virtual void doObserve(double t)
+	{
+	}
 	virtual void doOutput(double t) = 0;
 	virtual void doWriteHeader() = 0;
+	virtual bool doStopRequested() const
+	{
+		return false;
+	}
 	double interval_, nextOutputTime_;
 	std::ostream& out_;
 	std::string commentChar_;
@@ -40,6 +59,11 @@ inline std::ostream& IntervalOutput::stream() const
 	return out_;
 }
 
+inline double IntervalOutput::nextOutputTime() const
+{
+	return nextOutputTime_;
+}
+
 inline void IntervalOutput::setCommentChar(const std::string& commentChar)
 {
 	commentChar_ = commentChar;
@@ -55,6 +79,11 @@ inline void IntervalOutput::writeHeader()
 	doWriteHeader();
 }
 
+inline bool IntervalOutput::stopRequested() const
+{
+	return doStopRequested();
+}
+
 }
 }
 
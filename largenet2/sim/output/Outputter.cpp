@@ -6,6 +6,8 @@
 
 #include "Outputter.h"
 #include "IntervalOutput.h"
+#include "RecordOutput.h"
+#include "AsyncWriter.h"
 
 namespace sim
 {
@@ -18,11 +20,41 @@ Outputter::Outputter()
 
 Outputter::~Outputter()
 {
+	// write pending records while the outputs still exist
+	writer_.reset();
 }
 
 void Outputter::addOutput(IntervalOutput* output)
 {
 	outputs_.push_back(output);
+	attach(*output);
+}
+
+void Outputter::setAsync(const std::size_t capacity)
+{
+	writer_.reset();
+	if (capacity > 0)
+		writer_.reset(new AsyncWriter(capacity));
+	for (OutputVector::iterator it = outputs_.begin(); it != outputs_.end(); ++it)
+		attach(*it);
+}
+
+bool Outputter::async() const
+{
+	return writer_.get() != 0;
+}
+
+void Outputter::flush()
+{
+	if (writer_)
+		writer_->flush();
+}
+
+void Outputter::attach(IntervalOutput& output)
+{
+	RecordOutput* r = dynamic_cast<RecordOutput*> (&output);
+	if (r != 0)
+		r->setWriter(writer_.get());
 }
 
 void Outputter::output(const double t, const bool force)
@@ -33,8 +65,20 @@ void Outputter::output(const double t, const bool force)
 	}
 }
 
+bool Outputter::stopRequested() const
+{
+	for (OutputVector::const_iterator it = outputs_.begin(); it
+			!= outputs_.end(); ++it)
+	{
+		if (it->stopRequested())
+			return true;
+	}
+	return false;
+}
+
 void Outputter::writeHeaders()
 {
+	flush();
 	for (OutputVector::iterator it = outputs_.begin(); it != outputs_.end(); ++it)
 	{
 		it->writeHeader();
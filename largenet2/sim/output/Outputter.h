@@ -8,6 +8,8 @@
 #define OUTPUTTER_H_
 
 #include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <cstddef>
 
 namespace sim
 {
@@ -15,6 +17,7 @@ namespace output
 {
 
 class IntervalOutput;
+class AsyncWriter;
 
 class Outputter
 {
@@ -24,9 +27,28 @@ public:
 	void writeHeaders();
 	void output(double t, bool force=false);
 	void addOutput(IntervalOutput* output);
+	/**
+	 * Write RecordOutputs asynchronously through an AsyncWriter that keeps
+	 * at most @p capacity records in flight, or synchronously if @p capacity
+	 * is 0. Other outputs are always written synchronously and should not
+	 * share a stream with asynchronous ones.
+	 */
+	void setAsync(std::size_t capacity);
+	bool async() const;
+	/**
+	 * Wait until all asynchronously written records have reached their
+	 * streams.
+	 */
+	void flush();
+	/**
+	 * Check whether any of the outputs asks the simulation loop to terminate.
+	 */
+	bool stopRequested() const;
 private:
 	typedef boost::ptr_vector<IntervalOutput> OutputVector;
+	void attach(IntervalOutput& output);
 	OutputVector outputs_;
+	boost::scoped_ptr<AsyncWriter> writer_; ///< destroyed before the outputs
 };
 
 }
@@ -0,0 +1,51 @@
+/**
+ * @file RecordOutput.cpp
+ * @date 18.10.2026
+ */
+
+#include "RecordOutput.h"
+#include "AsyncWriter.h"
+#include <iomanip>
+
+namespace sim
+{
+namespace output
+{
+
+RecordOutput::RecordOutput(std::ostream& out, const double interval,
+		const std::string commentChar) :
+	IntervalOutput(out, interval, commentChar), writer_(0)
+{
+}
+
+RecordOutput::~RecordOutput()
+{
+}
+
+void RecordOutput::doOutput(const double t)
+{
+	if (writer_ != 0)
+		writer_->submit(*this, t);
+	else
+	{
+		record_.resize(recordSize());
+		if (!record_.empty())
+			sample(&record_[0]);
+		format(t, record_.empty() ? 0 : &record_[0]);
+	}
+}
+
+void RecordOutput::doFormat(std::ostream& out, const double t,
+		const double* record)
+{
+	const char sep = '\t';
+	const std::streamsize precision = out.precision();
+	out << std::setprecision(9) << t << std::setprecision(15);
+	for (std::size_t i = 0; i < recordSize(); ++i)
+		out << sep << record[i];
+	out << "\n";
+	out.precision(precision);
+}
+
+}
+}
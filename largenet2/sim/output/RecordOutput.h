@@ -0,0 +1,84 @@
+/**
+ * @file RecordOutput.h
+ * @date 18.10.2026
+ */
+
+#ifndef RECORDOUTPUT_H_
+#define RECORDOUTPUT_H_
+
+#include <largenet2/sim/output/IntervalOutput.h>
+#include <vector>
+#include <cstddef>
+
+namespace sim
+{
+namespace output
+{
+
+class AsyncWriter;
+
+/**
+ * An IntervalOutput that separates sampling from formatting.
+ *
+ * At each output time, doSample() copies the observables into a record of
+ * recordSize() numbers. doFormat() then turns the record into text. Without
+ * an AsyncWriter, both happen immediately. With an AsyncWriter (see
+ * Outputter::setAsync()), only sampling happens on the simulation thread,
+ * and the writer thread formats and writes the record later.
+ *
+ * Derived classes implement
+ * @code
+ * std::size_t doRecordSize() const;                // constant number of values
+ * void doSample(double* record);                   // simulation thread
+ * void doFormat(std::ostream& out, double t, const double* record); // optional
+ * void doWriteHeader();
+ * @endcode
+ * doFormat() must only use the record, not the simulation state. By default,
+ * it writes the time and the values separated by tabs, one record per line.
+ */
+class RecordOutput: public IntervalOutput
+{
+public:
+	RecordOutput(std::ostream& out, double interval, std::string commentChar =
+			"#");
+	virtual ~RecordOutput();
+
+	/// Number of values per record
+	std::size_t recordSize() const
+	{
+		return doRecordSize();
+	}
+	/// Copy the current observables into @p record.
+	void sample(double* record)
+	{
+		doSample(record);
+	}
+	/// Write @p record, sampled at time @p t, to the output stream.
+	void format(double t, const double* record)
+	{
+		doFormat(stream(), t, record);
+	}
+	/// Hand records to @p writer instead of writing them directly (0 to stop).
+	void setWriter(AsyncWriter* writer)
+	{
+		writer_ = writer;
+	}
+
+protected:
+	/// Default formatting: time and values, tab-separated, one line
+	virtual void doFormat(std::ostream& out, double t, const double* record);
+
+private:
+	friend class AsyncWriter;
+	void doOutput(double t);
+	virtual std::size_t doRecordSize() const = 0;
+	virtual void doSample(double* record) = 0;
+
+	AsyncWriter* writer_;
+	std::vector<double> record_; ///< record for synchronous output
+};
+
+}
+}
+
+#endif /* RECORDOUTPUT_H_ */
@@ -0,0 +1,529 @@
+/**
+ * @file SnapshotArchive.cpp
+ * @date 18.10.2026
+ */
+
+#include "SnapshotArchive.h"
+#include <largenet2/base/Graph.h>
+#include <largenet2/io/varint.h>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+using namespace std;
+using largenet::io::putVarint;
+using largenet::io::getVarint;
+
+namespace sim
+{
+namespace output
+{
+
+namespace
+{
+
+const char fileMagic[4] = { 'L', 'N', 'S', 'A' };
+const char indexMagic[4] = { 'L', 'N', 'S', 'X' };
+const boost::uint32_t formatVersion = 1;
+const boost::uint32_t deltaFlag = 1;
+
+/// snapshot record types
+enum RecordType
+{
+	FULL_SNAPSHOT = 0, DELTA_SNAPSHOT = 1
+};
+
+/// record header: type, time, payload size
+const std::size_t recordHeaderSize = sizeof(boost::uint32_t) + sizeof(double)
+		+ sizeof(boost::uint64_t);
+/// footer size after the index entries: snapshots, index offset, magic
+const std::size_t footerSize = 2 * sizeof(boost::uint64_t) + 4;
+const std::size_t indexEntrySize = 2 * sizeof(boost::uint64_t) + sizeof(double);
+
+typedef ArchivedSnapshot::NodeRecord NodeRecord;
+typedef ArchivedSnapshot::EdgeRecord EdgeRecord;
+
+struct NodeLess
+{
+	bool operator()(const NodeRecord& a, const NodeRecord& b) const
+	{
+		return a.id < b.id;
+	}
+};
+
+struct EdgeLess
+{
+	bool operator()(const EdgeRecord& a, const EdgeRecord& b) const
+	{
+		if (a.source != b.source)
+			return a.source < b.source;
+		if (a.target != b.target)
+			return a.target < b.target;
+		if (a.directed != b.directed)
+			return a.directed < b.directed;
+		// parallel edges differing in state must have distinct keys
+		return a.state < b.state;
+	}
+};
+
+bool sameState(const NodeRecord& a, const NodeRecord& b)
+{
+	return a.state == b.state;
+}
+
+bool sameState(const EdgeRecord& a, const EdgeRecord& b)
+{
+	return a.state == b.state;
+}
+
+template<class T>
+void appendRaw(string& buf, const T& x)
+{
+	buf.append(reinterpret_cast<const char*> (&x), sizeof(x));
+}
+
+void encode(string& buf, const vector<NodeRecord>& nodes, const bool states)
+{
+	putVarint(buf, nodes.size());
+	largenet::node_id_t prev = 0;
+	for (vector<NodeRecord>::const_iterator n = nodes.begin(); n
+			!= nodes.end(); ++n)
+	{
+		putVarint(buf, n->id - prev);
+		prev = n->id;
+		if (states)
+			putVarint(buf, n->state);
+	}
+}
+
+void encode(string& buf, const vector<EdgeRecord>& edges, const bool states)
+{
+	putVarint(buf, edges.size());
+	largenet::node_id_t prev = 0;
+	for (vector<EdgeRecord>::const_iterator e = edges.begin(); e
+			!= edges.end(); ++e)
+	{
+		putVarint(buf, e->source - prev);
+		prev = e->source;
+		putVarint(buf, e->target);
+		putVarint(buf, states ? 2 * static_cast<boost::uint64_t> (e->state)
+				+ e->directed : e->directed);
+	}
+}
+
+void decode(const char*& p, const char* end, vector<NodeRecord>& nodes,
+		const bool states)
+{
+	const boost::uint64_t n = getVarint(p, end);
+	if (n > static_cast<boost::uint64_t> (end - p))
+		throw runtime_error("Corrupt snapshot record.");
+	nodes.resize(n);
+	largenet::node_id_t prev = 0;
+	for (vector<NodeRecord>::iterator r = nodes.begin(); r != nodes.end(); ++r)
+	{
+		r->id = prev + getVarint(p, end);
+		prev = r->id;
+		r->state = states ? getVarint(p, end) : 0;
+	}
+}
+
+void decode(const char*& p, const char* end, vector<EdgeRecord>& edges,
+		const bool states)
+{
+	const boost::uint64_t n = getVarint(p, end);
+	if (n > static_cast<boost::uint64_t> (end - p))
+		throw runtime_error("Corrupt snapshot record.");
+	edges.resize(n);
+	largenet::node_id_t prev = 0;
+	for (vector<EdgeRecord>::iterator r = edges.begin(); r != edges.end(); ++r)
+	{
+		r->source = prev + getVarint(p, end);
+		prev = r->source;
+		r->target = getVarint(p, end);
+		const boost::uint64_t x = getVarint(p, end);
+		r->directed = (x & 1) != 0;
+		r->state = states ? x >> 1 : 0;
+	}
+}
+
+/**
+ * Records of @p prev missing from @p cur, and records of @p cur that are new
+ * or have changed their state, both sorted.
+ */
+template<class Record, class Less>
+void diff(const vector<Record>& prev, const vector<Record>& cur,
+		vector<Record>& removed, vector<Record>& changed, const Less less)
+{
+	removed.clear();
+	changed.clear();
+	typename vector<Record>::const_iterator a = prev.begin(), b = cur.begin();
+	while (a != prev.end() || b != cur.end())
+	{
+		if (b == cur.end() || (a != prev.end() && less(*a, *b)))
+			removed.push_back(*a++);
+		else if (a == prev.end() || less(*b, *a))
+			changed.push_back(*b++);
+		else
+		{
+			if (!sameState(*a, *b))
+				changed.push_back(*b);
+			++a;
+			++b;
+		}
+	}
+}
+
+/// Inverse of diff(): turn @p x from prev into cur.
+template<class Record, class Less>
+void patch(vector<Record>& x, const vector<Record>& removed,
+		const vector<Record>& changed, const Less less)
+{
+	vector<Record> result;
+	result.reserve(x.size() + changed.size());
+	typename vector<Record>::const_iterator a = x.begin(), r = removed.begin(),
+			c = changed.begin();
+	while (a != x.end() || c != changed.end())
+	{
+		if (a == x.end() || (c != changed.end() && !less(*a, *c)))
+		{
+			// changed records replace equal keys with a different state,
+			// records equal to an existing one are parallel edges
+			if (a != x.end() && !less(*c, *a) && !sameState(*a, *c))
+				++a;
+			result.push_back(*c++);
+			continue;
+		}
+		while (r != removed.end() && less(*r, *a))
+			++r;
+		// each removed record cancels exactly one equal record
+		if (r != removed.end() && !less(*a, *r))
+		{
+			++r;
+			++a;
+			continue;
+		}
+		result.push_back(*a);
+		++a;
+	}
+	x.swap(result);
+}
+
+}
+
+void ArchivedSnapshot::capture(const largenet::Graph& g, const bool sorted)
+{
+	nodeStates = g.numberOfNodeStates();
+	edgeStates = g.numberOfEdgeStates();
+	nodes.resize(g.numberOfNodes());
+	vector<NodeRecord>::iterator r = nodes.begin();
+	largenet::Graph::ConstNodeIteratorRange ni = g.nodes();
+	for (largenet::Graph::ConstNodeIterator n = ni.first; n != ni.second; ++n, ++r)
+	{
+		r->id = n.id();
+		r->state = g.nodeState(n.id());
+	}
+	if (sorted)
+		sort(nodes.begin(), nodes.end(), NodeLess());
+	edges.resize(g.numberOfEdges());
+	vector<EdgeRecord>::iterator s = edges.begin();
+	largenet::Graph::ConstEdgeIteratorRange ei = g.edges();
+	for (largenet::Graph::ConstEdgeIterator e = ei.first; e != ei.second; ++e, ++s)
+	{
+		s->source = e->source()->id();
+		s->target = e->target()->id();
+		s->state = g.edgeState(e.id());
+		s->directed = e->isDirected();
+	}
+	if (sorted)
+		sort(edges.begin(), edges.end(), EdgeLess());
+}
+
+largenet::Graph* ArchivedSnapshot::createGraph() const
+{
+	largenet::Graph* g = new largenet::Graph(nodeStates, edgeStates);
+	largenet::node_id_t maxID = 0;
+	for (vector<NodeRecord>::const_iterator n = nodes.begin(); n
+			!= nodes.end(); ++n)
+		maxID = max(maxID, n->id);
+	vector<largenet::node_id_t> ids(nodes.empty() ? 0 : maxID + 1);
+	for (vector<NodeRecord>::const_iterator n = nodes.begin(); n
+			!= nodes.end(); ++n)
+		ids[n->id] = g->addNode(n->state);
+	for (vector<EdgeRecord>::const_iterator e = edges.begin(); e
+			!= edges.end(); ++e)
+	{
+		if (e->source >= ids.size() || e->target >= ids.size())
+		{
+			delete g;
+			throw runtime_error("Snapshot edge refers to unknown node.");
+		}
+		const largenet::edge_id_t id = g->addEdge(ids[e->source],
+				ids[e->target], e->directed);
+		g->setEdgeState(id, e->state);
+	}
+	return g;
+}
+
+SnapshotArchiveWriter::SnapshotArchiveWriter(ostream& out, const bool delta,
+		const unsigned int keyFrameInterval) :
+	out_(out), delta_(delta), keyFrameInterval_(delta ? max(keyFrameInterval,
+			1u) : 1), headerWritten_(false), finished_(false), offset_(0)
+{
+}
+
+SnapshotArchiveWriter::~SnapshotArchiveWriter()
+{
+	try
+	{
+		finish();
+	} catch (...)
+	{
+	}
+}
+
+void SnapshotArchiveWriter::put(const void* data, const std::size_t size)
+{
+	if (out_.rdbuf()->sputn(static_cast<const char*> (data), size)
+			!= static_cast<streamsize> (size))
+		throw runtime_error("Could not write snapshot archive.");
+	offset_ += size;
+}
+
+void SnapshotArchiveWriter::writeHeader()
+{
+	if (headerWritten_)
+		return;
+	headerWritten_ = true;
+	const boost::uint32_t flags = delta_ ? deltaFlag : 0;
+	put(fileMagic, 4);
+	put(&formatVersion, sizeof(formatVersion));
+	put(&flags, sizeof(flags));
+	put(&keyFrameInterval_, sizeof(keyFrameInterval_));
+}
+
+void SnapshotArchiveWriter::append(const double t, const largenet::Graph& g)
+{
+	if (finished_)
+		throw logic_error("Snapshot archive has already been finished.");
+	writeHeader();
+	cur_.capture(g);
+	const bool full = index_.size() % keyFrameInterval_ == 0
+			|| cur_.nodeStates != prev_.nodeStates || cur_.edgeStates
+			!= prev_.edgeStates;
+
+	// reserve the record header, then encode the payload behind it
+	record_.assign(recordHeaderSize, 0);
+	if (full)
+	{
+		putVarint(record_, cur_.nodeStates);
+		putVarint(record_, cur_.edgeStates);
+		encode(record_, cur_.nodes, true);
+		encode(record_, cur_.edges, true);
+	}
+	else
+	{
+		vector<NodeRecord> removedNodes, changedNodes;
+		diff(prev_.nodes, cur_.nodes, removedNodes, changedNodes, NodeLess());
+		vector<EdgeRecord> removedEdges, changedEdges;
+		diff(prev_.edges, cur_.edges, removedEdges, changedEdges, EdgeLess());
+		encode(record_, removedNodes, false);
+		encode(record_, changedNodes, true);
+		encode(record_, removedEdges, true);
+		encode(record_, changedEdges, true);
+	}
+	string header;
+	appendRaw(header, static_cast<boost::uint32_t> (full ? FULL_SNAPSHOT
+			: DELTA_SNAPSHOT));
+	appendRaw(header, t);
+	appendRaw(header, static_cast<boost::uint64_t> (record_.size()
+			- recordHeaderSize));
+	record_.replace(0, recordHeaderSize, header);
+
+	IndexEntry e;
+	e.offset = offset_;
+	e.keyFrame = full ? index_.size() : index_.back().keyFrame;
+	e.t = t;
+	put(record_.data(), record_.size());
+	index_.push_back(e);
+	swap(prev_, cur_);
+}
+
+void SnapshotArchiveWriter::finish()
+{
+	if (finished_)
+		return;
+	writeHeader();
+	finished_ = true;
+	string footer;
+	const boost::uint64_t indexOffset = offset_, n = index_.size();
+	for (vector<IndexEntry>::const_iterator e = index_.begin(); e
+			!= index_.end(); ++e)
+	{
+		appendRaw(footer, e->offset);
+		appendRaw(footer, e->keyFrame);
+		appendRaw(footer, e->t);
+	}
+	appendRaw(footer, n);
+	appendRaw(footer, indexOffset);
+	footer.append(indexMagic, 4);
+	put(footer.data(), footer.size());
+	out_.flush();
+}
+
+SnapshotArchiveReader::SnapshotArchiveReader(istream& in) :
+	in_(in), dataStart_(0), current_(0)
+{
+	char magic[4];
+	get(magic, 4);
+	if (memcmp(magic, fileMagic, 4) != 0)
+		throw runtime_error("Not a snapshot archive.");
+	boost::uint32_t version, flags, keyFrameInterval;
+	get(&version, sizeof(version));
+	if (version != formatVersion)
+		throw runtime_error("Unsupported snapshot archive version.");
+	get(&flags, sizeof(flags));
+	get(&keyFrameInterval, sizeof(keyFrameInterval));
+	dataStart_ = in_.tellg();
+	if (!readIndex())
+		scanRecords();
+	current_ = index_.size();
+}
+
+void SnapshotArchiveReader::get(void* data, const std::size_t size)
+{
+	if (in_.rdbuf()->sgetn(static_cast<char*> (data), size)
+			!= static_cast<streamsize> (size))
+		throw runtime_error("Truncated snapshot archive.");
+}
+
+bool SnapshotArchiveReader::readIndex()
+{
+	in_.clear();
+	in_.seekg(0, ios::end);
+	const streamoff size = in_.tellg();
+	if (size < dataStart_ + static_cast<streamoff> (footerSize))
+		return false;
+	in_.seekg(size - static_cast<streamoff> (footerSize));
+	boost::uint64_t n, indexOffset;
+	char magic[4];
+	get(&n, sizeof(n));
+	get(&indexOffset, sizeof(indexOffset));
+	get(magic, 4);
+	if (memcmp(magic, indexMagic, 4) != 0 || indexOffset
+			< static_cast<boost::uint64_t> (dataStart_) || indexOffset + n
+			* indexEntrySize + footerSize != static_cast<boost::uint64_t> (size))
+		return false;
+	in_.seekg(indexOffset);
+	index_.resize(n);
+	for (vector<IndexEntry>::iterator e = index_.begin(); e != index_.end(); ++e)
+	{
+		get(&e->offset, sizeof(e->offset));
+		get(&e->keyFrame, sizeof(e->keyFrame));
+		get(&e->t, sizeof(e->t));
+	}
+	return true;
+}
+
+void SnapshotArchiveReader::scanRecords()
+{
+	index_.clear();
+	in_.clear();
+	in_.seekg(0, ios::end);
+	const streamoff size = in_.tellg();
+	streamoff offset = dataStart_;
+	while (offset + static_cast<streamoff> (recordHeaderSize) <= size)
+	{
+		in_.seekg(offset);
+		boost::uint32_t type;
+		IndexEntry e;
+		boost::uint64_t bytes;
+		get(&type, sizeof(type));
+		get(&e.t, sizeof(e.t));
+		get(&bytes, sizeof(bytes));
+		const streamoff end = offset
+				+ static_cast<streamoff> (recordHeaderSize + bytes);
+		// stop at a partially written record, or one without its key frame
+		if (end > size || type > DELTA_SNAPSHOT || (type == DELTA_SNAPSHOT
+				&& index_.empty()))
+			break;
+		e.offset = offset;
+		e.keyFrame = type == FULL_SNAPSHOT ? index_.size()
+				: index_.back().keyFrame;
+		index_.push_back(e);
+		offset = end;
+	}
+	in_.clear();
+}
+
+std::size_t SnapshotArchiveReader::find(const double t) const
+{
+	std::size_t i = index_.size();
+	while (i > 0 && index_[i - 1].t > t)
+		--i;
+	return i > 0 ? i - 1 : index_.size();
+}
+
+void SnapshotArchiveReader::apply(const std::size_t i)
+{
+	in_.clear();
+	in_.seekg(index_[i].offset);
+	boost::uint32_t type;
+	double t;
+	boost::uint64_t bytes;
+	get(&type, sizeof(type));
+	get(&t, sizeof(t));
+	get(&bytes, sizeof(bytes));
+	payload_.resize(bytes);
+	if (bytes > 0)
+		get(&payload_[0], bytes);
+	const char* p = payload_.data();
+	const char* end = p + payload_.size();
+	if (type == FULL_SNAPSHOT)
+	{
+		snapshot_.nodeStates = getVarint(p, end);
+		snapshot_.edgeStates = getVarint(p, end);
+		decode(p, end, snapshot_.nodes, true);
+		decode(p, end, snapshot_.edges, true);
+	}
+	else if (type == DELTA_SNAPSHOT)
+	{
+		vector<NodeRecord> removedNodes, changedNodes;
+		vector<EdgeRecord> removedEdges, changedEdges;
+		decode(p, end, removedNodes, false);
+		decode(p, end, changedNodes, true);
+		decode(p, end, removedEdges, true);
+		decode(p, end, changedEdges, true);
+		patch(snapshot_.nodes, removedNodes, changedNodes, NodeLess());
+		patch(snapshot_.edges, removedEdges, changedEdges, EdgeLess());
+	}
+	else
+		throw runtime_error("Unknown snapshot record type.");
+}
+
+const ArchivedSnapshot& SnapshotArchiveReader::read(const std::size_t i)
+{
+	if (i >= index_.size())
+		throw out_of_range("No such snapshot.");
+	const std::size_t key = index_[i].keyFrame;
+	std::size_t from = current_;
+	// snapshot_ is undefined if decoding fails
+	current_ = index_.size();
+	// continue from the current snapshot if it is on the way
+	if (from >= index_.size() || from > i || index_[from].keyFrame != key)
+	{
+		apply(key);
+		from = key;
+	}
+	for (std::size_t j = from + 1; j <= i; ++j)
+		apply(j);
+	current_ = i;
+	return snapshot_;
+}
+
+largenet::Graph* SnapshotArchiveReader::createGraph(const std::size_t i)
+{
+	return read(i).createGraph();
+}
+
+}
+}
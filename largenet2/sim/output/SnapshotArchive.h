@@ -0,0 +1,205 @@
+/**
+ * @file SnapshotArchive.h
+ * @date 18.10.2026
+ */
+
+#ifndef SNAPSHOTARCHIVE_H_
+#define SNAPSHOTARCHIVE_H_
+
+#include <largenet2/base/types.h>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace largenet
+{
+class Graph;
+}
+
+namespace sim
+{
+namespace output
+{
+
+/**
+ * A network configuration as stored in a snapshot archive: all nodes with
+ * their states, ordered by node ID, and all edges with their states and
+ * directedness, ordered by source, target, directedness, and state.
+ * Parallel edges appear as repeated records.
+ */
+struct ArchivedSnapshot
+{
+	struct NodeRecord
+	{
+		largenet::node_id_t id;
+		largenet::node_state_t state;
+	};
+	struct EdgeRecord
+	{
+		largenet::node_id_t source, target;
+		largenet::edge_state_t state;
+		bool directed;
+	};
+
+	ArchivedSnapshot() :
+		nodeStates(0), edgeStates(0)
+	{
+	}
+	/**
+	 * Capture the nodes and edges of @p g.
+	 * @param g graph
+	 * @param sorted sort nodes and edges as described above; unsorted
+	 * snapshots can only be used for createGraph()
+	 */
+	void capture(const largenet::Graph& g, bool sorted = true);
+	/**
+	 * Create a graph with the stored nodes and edges. Nodes are added in the
+	 * stored order, so that for sorted snapshots, contiguous IDs starting at
+	 * zero are preserved.
+	 */
+	largenet::Graph* createGraph() const;
+
+	largenet::node_state_size_t nodeStates;
+	largenet::edge_state_size_t edgeStates;
+	std::vector<NodeRecord> nodes;
+	std::vector<EdgeRecord> edges;
+};
+
+/**
+ * Writer for snapshot archives, which hold a series of network
+ * configurations in a single file.
+ *
+ * An archive consists of
+ * - a header: magic "LNSA", format version, flags, and key frame interval;
+ * - one record per snapshot: its type (full or delta), time, payload size,
+ *   and payload;
+ * - an index with the file offset, time, and key frame of each snapshot,
+ *   followed by the number of snapshots, the index offset, and the magic
+ *   "LNSX".
+ *
+ * Full snapshots store the node and edge lists of an ArchivedSnapshot as
+ * varints, with node IDs and edge sources as gaps to their predecessors.
+ * With delta encoding, all but every keyFrameInterval()-th snapshot store
+ * only the removed nodes and edges and the added or changed ones, relative
+ * to the previous snapshot. Edges are matched as multisets, so each removed
+ * edge record cancels one equal record of the previous snapshot. Each snapshot is encoded into a buffer first and
+ * written with a single call to the stream buffer. Fixed-width numbers use
+ * the native byte order, like largenet::io::BinWriter.
+ *
+ * Use SnapshotArchiveReader to read the archives.
+ */
+class SnapshotArchiveWriter: public boost::noncopyable
+{
+public:
+	/**
+	 * Constructor
+	 * @param out binary stream, positioned at its beginning
+	 * @param delta store snapshots as deltas to their predecessors
+	 * @param keyFrameInterval number of snapshots per full snapshot
+	 */
+	SnapshotArchiveWriter(std::ostream& out, bool delta = true,
+			unsigned int keyFrameInterval = 16);
+	/// Calls finish().
+	~SnapshotArchiveWriter();
+
+	/// Write the header, unless it has already been written.
+	void writeHeader();
+	/// Append a snapshot of @p g at time @p t.
+	void append(double t, const largenet::Graph& g);
+	/// Write the index. Further snapshots cannot be appended.
+	void finish();
+
+	bool delta() const
+	{
+		return delta_;
+	}
+	unsigned int keyFrameInterval() const
+	{
+		return keyFrameInterval_;
+	}
+	/// number of snapshots written
+	std::size_t size() const
+	{
+		return index_.size();
+	}
+
+private:
+	void put(const void* data, std::size_t size);
+
+	std::ostream& out_;
+	bool delta_;
+	unsigned int keyFrameInterval_;
+	bool headerWritten_, finished_;
+	boost::uint64_t offset_; ///< bytes written so far
+	ArchivedSnapshot prev_, cur_;
+	std::string record_;
+	struct IndexEntry
+	{
+		boost::uint64_t offset, keyFrame;
+		double t;
+	};
+	std::vector<IndexEntry> index_;
+};
+
+/**
+ * Reader for archives written by SnapshotArchiveWriter.
+ *
+ * Any snapshot can be read directly; a delta snapshot is reconstructed from
+ * its key frame, or from the previously read snapshot if that lies in
+ * between, so that reading the snapshots in order decodes each record once.
+ * Archives without an index, e.g. from an interrupted simulation, are
+ * indexed by scanning the complete records. Malformed archives cause
+ * std::runtime_error.
+ */
+class SnapshotArchiveReader: public boost::noncopyable
+{
+public:
+	/// Read the header and index from the seekable stream @p in.
+	explicit SnapshotArchiveReader(std::istream& in);
+
+	/// number of snapshots
+	std::size_t size() const
+	{
+		return index_.size();
+	}
+	/// time of snapshot @p i
+	double time(std::size_t i) const
+	{
+		return index_.at(i).t;
+	}
+	/// index of the last snapshot at or before time @p t, or size() if none
+	std::size_t find(double t) const;
+	/**
+	 * Snapshot @p i. The reference is valid until the next call.
+	 * @throw std::out_of_range if there is no such snapshot
+	 */
+	const ArchivedSnapshot& read(std::size_t i);
+	/// Create a graph from snapshot @p i.
+	largenet::Graph* createGraph(std::size_t i);
+
+private:
+	struct IndexEntry
+	{
+		boost::uint64_t offset, keyFrame;
+		double t;
+	};
+	void get(void* data, std::size_t size);
+	bool readIndex();
+	void scanRecords();
+	void apply(std::size_t i);
+
+	std::istream& in_;
+	std::streamoff dataStart_;
+	std::vector<IndexEntry> index_;
+	ArchivedSnapshot snapshot_;
+	std::size_t current_; ///< snapshot in snapshot_, size() if none
+	std::string payload_;
+};
+
+}
+}
+
+#endif /* SNAPSHOTARCHIVE_H_ */
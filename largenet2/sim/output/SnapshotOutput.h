@@ -0,0 +1,71 @@
+/**
+ * @file SnapshotOutput.h
+ * @date 18.10.2026
+ */
+
+#ifndef SNAPSHOTOUTPUT_H_
+#define SNAPSHOTOUTPUT_H_
+
+#include <largenet2/sim/output/IntervalOutput.h>
+#include <largenet2/sim/output/SnapshotArchive.h>
+
+namespace sim
+{
+namespace output
+{
+
+/**
+ * Writes the complete network, i.e. all nodes and edges with their states,
+ * at regular intervals into a single snapshot archive (see
+ * SnapshotArchiveWriter). Open the stream in binary mode. The archive is
+ * completed when the output is destroyed, or by finish().
+ *
+ * Read the archives with SnapshotArchiveReader, which gives random access to
+ * every snapshot.
+ */
+class SnapshotOutput: public IntervalOutput
+{
+public:
+	/**
+	 * Constructor
+	 * @param out binary stream, positioned at its beginning
+	 * @param net graph (must outlive the output)
+	 * @param interval time between snapshots
+	 * @param delta store snapshots as deltas to their predecessors
+	 * @param keyFrameInterval number of snapshots per full snapshot
+	 */
+	SnapshotOutput(std::ostream& out, const largenet::Graph& net,
+			double interval, bool delta = true,
+			unsigned int keyFrameInterval = 16) :
+		IntervalOutput(out, interval), net_(net), writer_(out, delta,
+				keyFrameInterval)
+	{
+	}
+	virtual ~SnapshotOutput()
+	{
+	}
+
+	/// Write the archive index.
+	void finish()
+	{
+		writer_.finish();
+	}
+
+private:
+	void doOutput(double t)
+	{
+		writer_.append(t, net_);
+	}
+	void doWriteHeader()
+	{
+		writer_.writeHeader();
+	}
+
+	const largenet::Graph& net_;
+	SnapshotArchiveWriter writer_;
+};
+
+}
+}
+
+#endif /* SNAPSHOTOUTPUT_H_ */
@@ -0,0 +1,175 @@
+/**
+ * @file SteadyStateDetector.cpp
+ * @date 18.10.2026
+ */
+
+#include "SteadyStateDetector.h"
+#include <largenet2/base/Graph.h>
+#include <largenet2/sim/statistics.h>
+#include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace sim
+{
+namespace output
+{
+
+namespace
+{
+
+const unsigned int batchSize = 5; ///< observations per MSER batch
+const unsigned int ciBatches = 20; ///< batches for the confidence interval
+
+class NodeCount
+{
+public:
+	NodeCount(const largenet::Graph& g, largenet::node_state_t s) :
+		g_(g), s_(s)
+	{
+	}
+	double operator()() const
+	{
+		return g_.numberOfNodes(s_);
+	}
+private:
+	const largenet::Graph& g_;
+	largenet::node_state_t s_;
+};
+
+class EdgeCount
+{
+public:
+	EdgeCount(const largenet::Graph& g, largenet::edge_state_t s) :
+		g_(g), s_(s)
+	{
+	}
+	double operator()() const
+	{
+		return g_.numberOfEdges(s_);
+	}
+private:
+	const largenet::Graph& g_;
+	largenet::edge_state_t s_;
+};
+
+}
+
+SteadyStateDetector::SteadyStateDetector(std::ostream& out,
+		const largenet::Graph& net, const double interval) :
+	IntervalOutput(out, interval), inBatch_(0), nextCheck_(ciBatches),
+			relative_(0.01), absolute_(0), converged_(false),
+			convergenceTime_(0), warmupTime_(0)
+{
+	for (largenet::node_state_t s = 0; s < net.numberOfNodeStates(); ++s)
+	{
+		std::ostringstream name;
+		name << "n" << s;
+		addObservable(name.str(), NodeCount(net, s));
+	}
+	for (largenet::edge_state_t s = 0; s < net.numberOfEdgeStates(); ++s)
+	{
+		std::ostringstream name;
+		name << "e" << s;
+		addObservable(name.str(), EdgeCount(net, s));
+	}
+}
+
+SteadyStateDetector::SteadyStateDetector(std::ostream& out,
+		const double interval) :
+	IntervalOutput(out, interval), inBatch_(0), nextCheck_(ciBatches),
+			relative_(0.01), absolute_(0), converged_(false),
+			convergenceTime_(0), warmupTime_(0)
+{
+}
+
+SteadyStateDetector::~SteadyStateDetector()
+{
+}
+
+void SteadyStateDetector::addObservable(const std::string& name,
+		const Observable& f)
+{
+	if (!batchTime_.empty() || inBatch_ > 0)
+		throw std::logic_error("Cannot add observables after the first output.");
+	names_.push_back(name);
+	functions_.push_back(f);
+	batchSum_.push_back(0);
+	batches_.push_back(std::vector<double>());
+	mean_.push_back(0);
+	halfWidth_.push_back(0);
+}
+
+void SteadyStateDetector::setPrecision(const double relative,
+		const double absolute)
+{
+	relative_ = relative;
+	absolute_ = absolute;
+}
+
+void SteadyStateDetector::doWriteHeader()
+{
+	stream() << commentChar() << " steady state detection:";
+	for (unsigned int i = 0; i < names_.size(); ++i)
+		stream() << " " << names_[i];
+	stream() << "\n";
+}
+
+void SteadyStateDetector::doOutput(const double t)
+{
+	if (converged_ || names_.empty())
+		return;
+	if (inBatch_ == 0)
+		batchTime_.push_back(t);
+	for (unsigned int i = 0; i < functions_.size(); ++i)
+		batchSum_[i] += functions_[i]();
+	if (++inBatch_ < batchSize)
+		return;
+	for (unsigned int i = 0; i < functions_.size(); ++i)
+	{
+		batches_[i].push_back(batchSum_[i] / batchSize);
+		batchSum_[i] = 0;
+	}
+	inBatch_ = 0;
+	if (batches_[0].size() >= nextCheck_)
+	{
+		check(t);
+		nextCheck_ = batches_[0].size() + batches_[0].size() / 10 + 1;
+	}
+}
+
+void SteadyStateDetector::check(const double t)
+{
+	const std::size_t n = batches_[0].size();
+	std::size_t d = 0;
+	for (unsigned int i = 0; i < batches_.size(); ++i)
+		d = std::max(d, mserTruncation(batches_[i]));
+	const std::size_t size = (n - d) / ciBatches;
+	if (size == 0)
+		return;
+	// use the most recent ciBatches * size batches after truncation
+	const std::size_t first = n - ciBatches * size;
+	bool ok = true;
+	for (unsigned int i = 0; i < batches_.size(); ++i)
+	{
+		batchMeansInterval(batches_[i], first, n, ciBatches, mean_[i],
+				halfWidth_[i]);
+		if (halfWidth_[i] > std::max(absolute_, relative_ * std::fabs(mean_[i])))
+			ok = false;
+	}
+	if (!ok)
+		return;
+	converged_ = true;
+	convergenceTime_ = t;
+	warmupTime_ = batchTime_[d];
+	stream() << commentChar() << " steady state at t = " << t
+			<< " (transient until t = " << warmupTime_ << "):";
+	for (unsigned int i = 0; i < names_.size(); ++i)
+		stream() << " " << names_[i] << " = " << mean_[i] << " +- "
+				<< halfWidth_[i];
+	stream() << "\n";
+}
+
+}
+}
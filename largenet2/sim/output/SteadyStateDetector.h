@@ -0,0 +1,135 @@
+/**
+ * @file SteadyStateDetector.h
+ * @date 18.10.2026
+ */
+
+#ifndef STEADYSTATEDETECTOR_H_
+#define STEADYSTATEDETECTOR_H_
+
+#include <largenet2/sim/output/IntervalOutput.h>
+#include <largenet2/base/types.h>
+#include <boost/function.hpp>
+#include <vector>
+#include <string>
+
+namespace largenet
+{
+class Graph;
+}
+
+namespace sim
+{
+namespace output
+{
+
+/**
+ * Online detection of a steady state, for terminating runs early.
+ *
+ * The detector is driven like any other IntervalOutput and records a set of
+ * observables, by default the numbers of nodes and edges in each state of a
+ * Graph. Observations are averaged in batches of five. At geometrically
+ * spaced checks, the end of the initial transient is located by the MSER-5
+ * rule (White, Simulation 69, 323 (1997)), i.e. the truncation point that
+ * minimizes the standard error of the remaining mean, over the first half of
+ * the data. The remaining data are split into 20 batches, and the batch
+ * means give a 95% confidence interval for each observable. Once the
+ * confidence intervals of all observables are narrower than the requested
+ * precision, the detector reports the steady state to its stream and
+ * stopRequested() becomes true, so that the simulation loop can terminate:
+ * @code
+ * Outputter out;
+ * SteadyStateDetector* ssd = new SteadyStateDetector(std::cerr, net, 1.0);
+ * ssd->setPrecision(0.01);
+ * out.addOutput(ssd);
+ * while (t <= tmax && !model.stopped() && !out.stopRequested())
+ * {
+ * 	out.output(t);
+ * 	t += model.step(rng);
+ * }
+ * @endcode
+ */
+class SteadyStateDetector: public IntervalOutput
+{
+public:
+	typedef boost::function<double()> Observable;
+
+	/**
+	 * Constructor tracking the numbers of nodes and edges in each state.
+	 * @param out stream for the report
+	 * @param net graph (must outlive the detector)
+	 * @param interval time between observations
+	 */
+	SteadyStateDetector(std::ostream& out, const largenet::Graph& net,
+			double interval);
+	/**
+	 * Constructor without any default observables; use addObservable().
+	 */
+	SteadyStateDetector(std::ostream& out, double interval);
+	virtual ~SteadyStateDetector();
+
+	void addObservable(const std::string& name, const Observable& f);
+	/**
+	 * Set the required half width of the confidence intervals, relative to
+	 * the observable's mean, or absolute, whichever is larger.
+	 */
+	void setPrecision(double relative, double absolute = 0);
+
+	bool converged() const
+	{
+		return converged_;
+	}
+	/// time at which the steady state was detected
+	double convergenceTime() const
+	{
+		return convergenceTime_;
+	}
+	/// end of the initial transient according to MSER-5
+	double warmupTime() const
+	{
+		return warmupTime_;
+	}
+	unsigned int observables() const
+	{
+		return names_.size();
+	}
+	const std::string& name(unsigned int i) const
+	{
+		return names_.at(i);
+	}
+	/// steady-state mean of observable @p i (after convergence)
+	double mean(unsigned int i) const
+	{
+		return mean_.at(i);
+	}
+	/// half width of the 95% confidence interval of observable @p i
+	double halfWidth(unsigned int i) const
+	{
+		return halfWidth_.at(i);
+	}
+
+private:
+	void doOutput(double t);
+	void doWriteHeader();
+	bool doStopRequested() const
+	{
+		return converged_;
+	}
+	void check(double t);
+
+	std::vector<std::string> names_;
+	std::vector<Observable> functions_;
+	std::vector<double> batchSum_; ///< running sums of the current batch
+	std::vector<std::vector<double> > batches_; ///< batch means per observable
+	std::vector<double> batchTime_; ///< start time of each batch
+	unsigned int inBatch_;
+	std::size_t nextCheck_;
+	double relative_, absolute_;
+	bool converged_;
+	double convergenceTime_, warmupTime_;
+	std::vector<double> mean_, halfWidth_;
+};
+
+}
+}
+
+#endif /* STEADYSTATEDETECTOR_H_ */
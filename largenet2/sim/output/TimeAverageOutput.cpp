@@ -0,0 +1,144 @@
+/**
+ * @file TimeAverageOutput.cpp
+ * @date 18.10.2026
+ */
+
+#include "TimeAverageOutput.h"
+#include <largenet2/base/Graph.h>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace sim
+{
+namespace output
+{
+
+TimeAverageOutput::TimeAverageOutput(std::ostream& out,
+		const largenet::Graph& net, const double interval) :
+	IntervalOutput(out, interval), net_(net), interval_(interval), started_(
+			false), last_(0), end_(interval), covered_(0), acc_(
+			net.numberOfNodeStates() + net.numberOfEdgeStates())
+{
+	if (interval <= 0)
+		throw std::invalid_argument("Interval must be positive.");
+}
+
+TimeAverageOutput::~TimeAverageOutput()
+{
+}
+
+void TimeAverageOutput::hold()
+{
+	std::vector<Accumulator>::iterator a = acc_.begin();
+	for (largenet::node_state_t s = 0; s < net_.numberOfNodeStates(); ++s, ++a)
+		a->held = net_.numberOfNodes(s);
+	for (largenet::edge_state_t s = 0; s < net_.numberOfEdgeStates(); ++s, ++a)
+		a->held = net_.numberOfEdges(s);
+}
+
+void TimeAverageOutput::advance(const double t)
+{
+	const double dt = t - last_;
+	if (dt <= 0)
+		return;
+	for (std::vector<Accumulator>::iterator a = acc_.begin(); a != acc_.end(); ++a)
+	{
+		const double d = a->held - a->shift;
+		a->sum += d * dt;
+		a->sumSq += d * d * dt;
+		if (a->held < a->min)
+			a->min = a->held;
+		if (a->held > a->max)
+			a->max = a->held;
+	}
+	covered_ += dt;
+	last_ = t;
+}
+
+void TimeAverageOutput::close(const double t)
+{
+	if (covered_ > 0)
+	{
+		Record r;
+		r.t = t;
+		r.values.reserve(4 * acc_.size());
+		for (std::vector<Accumulator>::const_iterator a = acc_.begin(); a
+				!= acc_.end(); ++a)
+		{
+			const double m = a->sum / covered_;
+			// variance is shift invariant; clamp rounding errors
+			r.values.push_back(a->shift + m);
+			r.values.push_back(std::max(0.0, a->sumSq / covered_ - m * m));
+			r.values.push_back(a->min);
+			r.values.push_back(a->max);
+		}
+		pending_.push_back(r);
+	}
+	covered_ = 0;
+	for (std::vector<Accumulator>::iterator a = acc_.begin(); a != acc_.end(); ++a)
+	{
+		a->shift = a->held;
+		a->sum = a->sumSq = 0;
+		a->min = std::numeric_limits<double>::infinity();
+		a->max = -std::numeric_limits<double>::infinity();
+	}
+}
+
+void TimeAverageOutput::doObserve(const double t)
+{
+	if (!started_)
+	{
+		started_ = true;
+		last_ = t;
+		end_ = (std::floor(t / interval_) + 1) * interval_;
+		hold();
+		close(t);
+		return;
+	}
+	// the counts held since the last event are valid until t
+	while (t >= end_)
+	{
+		advance(end_);
+		close(end_);
+		end_ += interval_;
+	}
+	advance(t);
+	hold();
+}
+
+void TimeAverageOutput::doOutput(const double t)
+{
+	// a forced output before the end of the interval reports it so far
+	if (pending_.empty() && t < nextOutputTime() && covered_ > 0)
+		close(t);
+	const char tab = '\t';
+	while (!pending_.empty())
+	{
+		const Record& r = pending_.front();
+		stream() << r.t;
+		for (std::vector<double>::const_iterator v = r.values.begin(); v
+				!= r.values.end(); ++v)
+			stream() << tab << *v;
+		stream() << "\n";
+		pending_.pop_front();
+	}
+}
+
+void TimeAverageOutput::doWriteHeader()
+{
+	const char tab = '\t';
+	const char* stats[] = { "mean", "var", "min", "max" };
+	stream() << commentChar() << " t";
+	for (largenet::node_state_t s = 0; s < net_.numberOfNodeStates(); ++s)
+		for (unsigned int i = 0; i < 4; ++i)
+			stream() << tab << "n" << s << "_" << stats[i];
+	for (largenet::edge_state_t s = 0; s < net_.numberOfEdgeStates(); ++s)
+		for (unsigned int i = 0; i < 4; ++i)
+			stream() << tab << "e" << s << "_" << stats[i];
+	stream() << "\n";
+}
+
+}
+}
@@ -0,0 +1,106 @@
+/**
+ * @file TimeAverageOutput.h
+ * @date 18.10.2026
+ */
+
+#ifndef TIMEAVERAGEOUTPUT_H_
+#define TIMEAVERAGEOUTPUT_H_
+
+#include <largenet2/sim/output/IntervalOutput.h>
+#include <vector>
+#include <deque>
+
+namespace largenet
+{
+class Graph;
+}
+
+namespace sim
+{
+namespace output
+{
+
+/**
+ * Exact time averages of the numbers of nodes and edges in each state.
+ *
+ * Instead of sampling the graph at the output times, the output integrates
+ * the state counts over simulated time: every call to output() closes the
+ * period during which the previous counts were held, which takes
+ * O(number of states) time using the category counts of the Graph. For each
+ * output interval, it writes the time-weighted mean and variance and the
+ * minimum and maximum of every count, so that coarse output intervals still
+ * give accurate statistics. The simulation loop must call output() after
+ * every event, with the time from which the new state holds:
+ * @code
+ * TimeAverageOutput* avg = new TimeAverageOutput(out, net, 10.0);
+ * while (t <= tmax)
+ * {
+ * 	outputter.output(t);
+ * 	t += model.step(rng);
+ * }
+ * outputter.output(t, true);
+ * @endcode
+ * Output intervals are (k dt, (k+1) dt], reported at their end. A forced
+ * output reports the current interval up to the given time. Intervals the
+ * simulation did not cover are skipped.
+ */
+class TimeAverageOutput: public IntervalOutput
+{
+public:
+	/**
+	 * Constructor
+	 * @param out output stream
+	 * @param net graph (must outlive the output)
+	 * @param interval length of the averaging intervals
+	 */
+	TimeAverageOutput(std::ostream& out, const largenet::Graph& net,
+			double interval);
+	virtual ~TimeAverageOutput();
+
+	/// number of integrated counts (node states, then edge states)
+	unsigned int observables() const
+	{
+		return acc_.size();
+	}
+
+private:
+	/// time integrals of one count over the current interval
+	struct Accumulator
+	{
+		double held; ///< count since the last event
+		double shift; ///< count at the start of the interval
+		double sum, sumSq; ///< integrals of (held - shift) and its square
+		double min, max;
+	};
+	/// statistics of a completed interval
+	struct Record
+	{
+		double t;
+		std::vector<double> values; ///< mean, variance, min, max per count
+	};
+
+	void doObserve(double t);
+	void doOutput(double t);
+	void doWriteHeader();
+
+	/// integrate the held counts up to @p t
+	void advance(double t);
+	/// finish the current interval at @p t
+	void close(double t);
+	/// read the current counts
+	void hold();
+
+	const largenet::Graph& net_;
+	double interval_;
+	bool started_;
+	double last_; ///< time of the last event
+	double end_; ///< end of the current interval
+	double covered_; ///< integrated time in the current interval
+	std::vector<Accumulator> acc_;
+	std::deque<Record> pending_;
+};
+
+}
+}
+
+#endif /* TIMEAVERAGEOUTPUT_H_ */
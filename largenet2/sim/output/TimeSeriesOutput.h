@@ -7,9 +7,13 @@
 #ifndef TIMESERIESOUTPUT_H_
 #define TIMESERIESOUTPUT_H_
 
-#include <largenet2/sim/output/IntervalOutput.h>
+#include <largenet2/sim/output/RecordOutput.h>
 #include <largenet2/motifs/motifs.h>
+#include <largenet2/measures/TripleCounter.h>
 #include <iomanip>
+#include <sstream>
+#include <vector>
+#include <string>
 
 namespace sim
 {
@@ -18,35 +22,54 @@ namespace output {
 
 /**
  * Outputs numbers of nodes, links, and possibly triples in all states in the network.
+ *
+ * Triple counts are taken from a largenet::measures::TripleCounter, which
+ * maintains them incrementally, so that they can be written at every
+ * interval of large runs. The counts are sampled into a record, so that they
+ * can be written asynchronously (see Outputter::setAsync()).
  */
 template<class _Graph, class _LinkStateCalculator>
-class TimeSeriesOutput: public IntervalOutput
+class TimeSeriesOutput: public RecordOutput
 {
 public:
+	/**
+	 * Constructor
+	 * @param out output stream
+	 * @param net graph
+	 * @param lsc link state calculator
+	 * @param interval time between lines
+	 * @param directedMotifs count directed link motifs
+	 * @param triples if given, also output the counts of its undirected
+	 * triple motifs (must outlive the output)
+	 */
 	TimeSeriesOutput(std::ostream& out, const _Graph& net,
-			const _LinkStateCalculator& lsc, double interval, bool directedMotifs);
+			const _LinkStateCalculator& lsc, double interval, bool directedMotifs,
+			const largenet::measures::TripleCounter* triples = 0);
 	virtual ~TimeSeriesOutput();
 
+protected:
+	/// Names of the record columns, i.e., of the node, link, and triple motifs
+	std::vector<std::string> columnNames() const;
+
 private:
-	void doOutput(double t);
+	std::size_t doRecordSize() const;
+	void doSample(double* record);
 	void doWriteHeader();
-	void addTripleOutput(const char sep) {}
-	void addTripleHeader(const char sep) {}
 	const _Graph& net_;
 	const _LinkStateCalculator& lsc_;
 	const largenet::motifs::NodeMotifSet nodeMotifs_;
 	const largenet::motifs::LinkMotifSet linkMotifs_;
-	//	const largenet::motifs::TripleMotifSet tripleMotifs_;
+	const largenet::measures::TripleCounter* triples_;
 };
 
 template<class _Graph, class _LinkStateCalculator>
 TimeSeriesOutput<_Graph, _LinkStateCalculator>::TimeSeriesOutput(
 		std::ostream& out, const _Graph& net, const _LinkStateCalculator& lsc,
-		const double interval, const bool directedMotifs) :
-	IntervalOutput(out, interval), net_(net), lsc_(lsc), nodeMotifs_(
+		const double interval, const bool directedMotifs,
+		const largenet::measures::TripleCounter* triples) :
+	RecordOutput(out, interval), net_(net), lsc_(lsc), nodeMotifs_(
 			net.numberOfNodeStates(), directedMotifs), linkMotifs_(
-			net.numberOfNodeStates(), directedMotifs)
-//			, tripleMotifs_(net.numberOfNodeStates(), directedMotifs)
+			net.numberOfNodeStates(), directedMotifs), triples_(triples)
 {
 }
 
@@ -56,70 +79,65 @@ TimeSeriesOutput<_Graph, _LinkStateCalculator>::~TimeSeriesOutput()
 }
 
 template<class _Graph, class _LinkStateCalculator>
-void TimeSeriesOutput<_Graph, _LinkStateCalculator>::doOutput(const double t)
+std::size_t TimeSeriesOutput<_Graph, _LinkStateCalculator>::doRecordSize() const
+{
+	return nodeMotifs_.size() + linkMotifs_.size() + (triples_ == 0 ? 0
+			: triples_->motifs().size());
+}
+
+template<class _Graph, class _LinkStateCalculator>
+void TimeSeriesOutput<_Graph, _LinkStateCalculator>::doSample(double* record)
 {
-	const char sep = '\t';
-	stream() << std::setprecision(9) << t;
 	for (largenet::motifs::NodeMotifSet::const_iterator it =
 			nodeMotifs_.begin(); it != nodeMotifs_.end(); ++it)
-		stream() << sep << net_.numberOfNodes(*it);
+		*record++ = net_.numberOfNodes(*it);
 	for (largenet::motifs::LinkMotifSet::const_iterator it =
 			linkMotifs_.begin(); it != linkMotifs_.end(); ++it)
-		stream() << sep << net_.numberOfEdges(lsc_(it->source(), it->target()));
-
-	addTripleOutput(sep);
-	stream() << "\n";
+		*record++ = net_.numberOfEdges(lsc_(it->source(), it->target()));
+	if (triples_ == 0)
+		return;
+	for (largenet::motifs::TripleMotifSet::const_iterator it =
+			triples_->motifs().begin(); it != triples_->motifs().end(); ++it)
+		*record++ = triples_->count(*it);
 }
 
 template<class _Graph, class _LinkStateCalculator>
-void TimeSeriesOutput<_Graph, _LinkStateCalculator>::doWriteHeader()
+std::vector<std::string> TimeSeriesOutput<_Graph, _LinkStateCalculator>::columnNames() const
 {
-	const char tab = '\t';
-	stream() << commentChar() << "   t";
+	std::vector<std::string> names;
 	for (largenet::motifs::NodeMotifSet::const_iterator it =
 			nodeMotifs_.begin(); it != nodeMotifs_.end(); ++it)
-		stream() << tab << *it;
+	{
+		std::ostringstream s;
+		s << *it;
+		names.push_back(s.str());
+	}
 	for (largenet::motifs::LinkMotifSet::const_iterator it =
 			linkMotifs_.begin(); it != linkMotifs_.end(); ++it)
-		stream() << tab << *it;
+	{
+		std::ostringstream s;
+		s << *it;
+		names.push_back(s.str());
+	}
+	if (triples_ != 0)
+		for (largenet::motifs::TripleMotifSet::const_iterator it =
+				triples_->motifs().begin(); it != triples_->motifs().end(); ++it)
+			names.push_back(it->toStr());
+	return names;
+}
 
-	addTripleHeader(tab);
+template<class _Graph, class _LinkStateCalculator>
+void TimeSeriesOutput<_Graph, _LinkStateCalculator>::doWriteHeader()
+{
+	const char tab = '\t';
+	stream() << commentChar() << "   t";
+	const std::vector<std::string> names = columnNames();
+	for (std::vector<std::string>::const_iterator it = names.begin(); it
+			!= names.end(); ++it)
+		stream() << tab << *it;
 	stream() << "\n";
 }
-//
-//template<>
-//void TimeSeriesOutput<lnet::TripleMultiNetwork>::addTripleHeader(const char sep)
-//{
-//	for (largenet::motifs::TripleMotifSet::const_iterator it =
-//			tripleMotifs_.begin(); it != tripleMotifs_.end(); ++it)
-//		stream() << sep << *it;
-//}
-//
-//template<>
-//void TimeSeriesOutput<lnet::TripleNetwork>::addTripleHeader(const char sep)
-//{
-//	for (largenet::motifs::TripleMotifSet::const_iterator it =
-//			tripleMotifs_.begin(); it != tripleMotifs_.end(); ++it)
-//		stream() << sep << *it;
-//}
-//
-//template<>
-//void TimeSeriesOutput<lnet::TripleMultiNetwork>::addTripleOutput(const char sep)
-//{
-//	for (largenet::motifs::TripleMotifSet::const_iterator it =
-//			tripleMotifs_.begin(); it != tripleMotifs_.end(); ++it)
-//		stream() << sep << net_.numberOfTriples(
-//				net_.getTripleStateCalculator()(*it));
-//}
-//
-//template<>
-//void TimeSeriesOutput<lnet::TripleNetwork>::addTripleOutput(const char sep)
-//{
-//	for (largenet::motifs::TripleMotifSet::const_iterator it =
-//			tripleMotifs_.begin(); it != tripleMotifs_.end(); ++it)
-//		stream() << sep << net_.numberOfTriples(
-//				net_.getTripleStateCalculator()(*it));
-//}
+
 }
 }
 #endif /* TIMESERIESOUTPUT_H_ */
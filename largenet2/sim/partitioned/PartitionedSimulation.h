@@ -0,0 +1,565 @@
+/**
+ * @file PartitionedSimulation.h
+ * @date 18.10.2026
+ */
+
+#ifndef PARTITIONEDSIMULATION_H_
+#define PARTITIONEDSIMULATION_H_
+
+#include <largenet2/base/Graph.h>
+#include <largenet2/base/Node.h>
+#include <largenet2/base/Edge.h>
+#include <largenet2/sim/partitioned/partition.h>
+#include <largenet2/sim/seeds.h>
+#include <largenet2/sim/WorkerPool.h>
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace sim
+{
+namespace partitioned
+{
+
+namespace detail
+{
+
+/**
+ * Complete binary tree of partial sums over non-negative weights, for
+ * sampling an index with probability proportional to its weight in
+ * O(log n). Inner nodes are recomputed from their children on every update,
+ * so no rounding errors accumulate.
+ */
+class SumTree
+{
+public:
+	SumTree() :
+			size_(1), t_(2, 0.0)
+	{
+	}
+	void init(std::size_t n)
+	{
+		size_ = 1;
+		while (size_ < n)
+			size_ *= 2;
+		t_.assign(2 * size_, 0.0);
+	}
+	void set(std::size_t i, double w)
+	{
+		i += size_;
+		t_[i] = w;
+		for (i /= 2; i > 0; i /= 2)
+			t_[i] = t_[2 * i] + t_[2 * i + 1];
+	}
+	double total() const
+	{
+		return t_[1];
+	}
+	/// index i with sum of weights before i <= x < sum of weights up to i
+	std::size_t find(double x) const
+	{
+		std::size_t i = 1;
+		while (i < size_)
+		{
+			if (x < t_[2 * i] || t_[2 * i + 1] <= 0.0)
+				i = 2 * i;
+			else
+			{
+				x -= t_[2 * i];
+				i = 2 * i + 1;
+			}
+		}
+		return i - size_;
+	}
+private:
+	std::size_t size_;
+	std::vector<double> t_;
+};
+
+}
+
+/**
+ * Parallel exact stochastic simulation of node-state dynamics on a
+ * partitioned graph.
+ *
+ * The model is a continuous-time Markov process in which each node changes
+ * its state with a rate depending on its own state and on the number of
+ * neighbors in each state, as in SIS, SIR, voter or contact process models.
+ * Neighbors of a node are the sources of its incoming edges and its
+ * undirected neighbors. The model is given by a rule providing
+ * @code
+ * // total rate for a node in state s, where neighbors[k] is the number of
+ * // its neighbors in state k
+ * double rate(largenet::node_state_t s, const unsigned int* neighbors) const;
+ * // new state of a node in state s that undergoes a transition
+ * template<class RandomGen> largenet::node_state_t transition(
+ *		largenet::node_state_t s, const unsigned int* neighbors, RandomGen& rng) const;
+ * @endcode
+ *
+ * The graph is split into partitions (see partitionGraph()), each of which
+ * is simulated by its own thread using the direct method with a sum tree
+ * over its node rates. Partitions are synchronized optimistically in
+ * bounded time windows: within a window, each partition runs ahead using the
+ * boundary state changes it knows of. State changes of boundary nodes are
+ * sent as time-stamped messages to the neighboring partitions. At the end of
+ * the window, each partition compares the messages it now receives with
+ * those it used. If they differ, the partition is rolled back to the window
+ * start by undoing its state-change log and restoring its random number
+ * generator, and re-executes the window with the new messages. The messages
+ * it sends then replace its earlier ones (acting as anti-messages). This is
+ * repeated until no partition receives new messages, and the window is
+ * committed. Since re-executions reproduce all events before the first changed
+ * message, every iteration fixes at least one more event, and the result is an
+ * exact realization of the Markov process: between incoming messages each
+ * partition performs a direct-method simulation, and incoming state changes
+ * simply restart the (memoryless) waiting time. Results are therefore
+ * statistically equivalent to a sequential DirectMethod simulation, and, for
+ * a given seed and partitioning, independent of thread scheduling.
+ *
+ * The window length adapts to keep the number of re-executions low; it only
+ * affects performance. The graph topology must not change while the engine
+ * is in use. Node states are committed to the graph with
+ * Graph::setNodeStates() at the end of each advance() call; if states are
+ * changed by other code in between, call refresh().
+ *
+ * @tparam Rule transition rule
+ * @tparam RandomGen random number generator type, providing seed(unsigned long),
+ * Uniform01(), and Exponential(double mean), and copy assignment
+ */
+template<class Rule, class RandomGen>
+class PartitionedSimulation: public boost::noncopyable
+{
+public:
+	/**
+	 * Constructor
+	 * @param g graph
+	 * @param rule transition rule
+	 * @param partitions number of partitions, each simulated by one thread
+	 * @param seed random seed
+	 */
+	PartitionedSimulation(largenet::Graph& g, const Rule& rule,
+			unsigned int partitions, unsigned long seed = 0) :
+			g_(g), rule_(rule), t_(0), window_(1.0), windows_(0), rollbacks_(0)
+	{
+		std::vector<unsigned int> owner;
+		partitionGraph(g, partitions, owner);
+		init(owner, partitions, seed);
+	}
+	/**
+	 * Constructor using a given partition
+	 * @param g graph
+	 * @param rule transition rule
+	 * @param owner partition of each node, indexed by node ID
+	 * @param seed random seed
+	 */
+	PartitionedSimulation(largenet::Graph& g, const Rule& rule,
+			const std::vector<unsigned int>& owner, unsigned long seed = 0) :
+			g_(g), rule_(rule), t_(0), window_(1.0), windows_(0), rollbacks_(0)
+	{
+		unsigned int partitions = 0;
+		largenet::Graph::NodeIteratorRange nodes = g.nodes();
+		for (largenet::Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+			partitions = std::max(partitions, owner.at(n.id()) + 1);
+		init(owner, partitions, seed);
+	}
+
+	/**
+	 * Simulate up to time @p tmax and commit the node states to the graph.
+	 */
+	void advance(double tmax)
+	{
+		if (!(tmax > t_))
+			return;
+		tEnd_ = tmax;
+		pool_->run(boost::bind(&PartitionedSimulation::work, this, _1));
+		g_.setNodeStates(state_);
+	}
+
+	/**
+	 * Re-read the node states from the graph.
+	 */
+	void refresh()
+	{
+		g_.nodeStates(state_);
+		for (unsigned int p = 0; p < parts_.size(); ++p)
+		{
+			Partition& P = parts_[p];
+			std::fill(P.counts.begin(), P.counts.end(), 0);
+		}
+		largenet::Graph::NodeIteratorRange nodes = g_.nodes();
+		for (largenet::Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+			for (std::size_t j = outOff_[n.id()]; j < outOff_[n.id() + 1]; ++j)
+			{
+				const largenet::node_id_t m = outNb_[j];
+				++parts_[owner_[m]].counts[local_[m] * C_ + state_[n.id()]];
+			}
+		for (unsigned int p = 0; p < parts_.size(); ++p)
+		{
+			Partition& P = parts_[p];
+			for (std::size_t i = 0; i < P.nodes.size(); ++i)
+				updateRate(P, i);
+		}
+	}
+
+	/// current simulation time
+	double time() const
+	{
+		return t_;
+	}
+	/**
+	 * Check whether the absorbing state has been reached, i.e., all rates
+	 * vanish.
+	 */
+	bool stopped() const
+	{
+		for (unsigned int p = 0; p < parts_.size(); ++p)
+			if (parts_[p].tree.total() > 0)
+				return false;
+		return true;
+	}
+	unsigned int partitions() const
+	{
+		return parts_.size();
+	}
+	/// current synchronization window length
+	double window() const
+	{
+		return window_;
+	}
+	void setWindow(double w)
+	{
+		if (w <= 0)
+			throw std::invalid_argument("Window must be positive.");
+		window_ = w;
+	}
+	/// number of committed events
+	unsigned long events() const
+	{
+		unsigned long e = 0;
+		for (unsigned int p = 0; p < parts_.size(); ++p)
+			e += parts_[p].events;
+		return e;
+	}
+	/// number of committed time windows
+	unsigned long windows() const
+	{
+		return windows_;
+	}
+	/// number of partition re-executions caused by late messages
+	unsigned long rollbacks() const
+	{
+		return rollbacks_;
+	}
+
+private:
+	struct Message
+	{
+		double time;
+		largenet::node_id_t node;
+		largenet::node_state_t from, to;
+		bool operator<(const Message& m) const
+		{
+			return time < m.time || (time == m.time && node < m.node);
+		}
+		bool operator==(const Message& m) const
+		{
+			return time == m.time && node == m.node && from == m.from
+					&& to == m.to;
+		}
+	};
+	struct Change
+	{
+		largenet::node_id_t node;
+		largenet::node_state_t from, to;
+	};
+	struct Partition
+	{
+		std::vector<largenet::node_id_t> nodes; ///< node IDs by local index
+		std::vector<unsigned int> counts; ///< neighbor state counts per local node
+		detail::SumTree tree; ///< node rates
+		RandomGen rng, checkpoint; ///< generator and its state at window start
+		std::vector<Change> log; ///< state changes in current window
+		std::vector<std::vector<Message> > outbox; ///< messages per partition
+		std::vector<Message> inbox; ///< messages used in current window
+		std::vector<unsigned int> senders; ///< partitions sending to this one
+		std::vector<unsigned long> mark;
+		unsigned long stamp, events, windowEvents;
+		bool dirty;
+	};
+
+	void init(const std::vector<unsigned int>& owner, unsigned int partitions,
+			unsigned long seed)
+	{
+		if (partitions == 0)
+			throw std::invalid_argument("Need at least one partition.");
+		C_ = g_.numberOfNodeStates();
+		const std::size_t ids =
+				g_.numberOfNodes() > 0 ? g_.maxNodeID() + 1 : 0;
+		owner_.assign(ids, 0);
+		local_.assign(ids, 0);
+		for (unsigned int p = 0; p < partitions; ++p)
+		{
+			Partition* P = new Partition;
+			P->rng.seed(deriveSeed(seed, p));
+			P->checkpoint = P->rng;
+			P->outbox.resize(partitions);
+			P->mark.assign(partitions, 0);
+			P->stamp = 0;
+			P->events = 0;
+			P->windowEvents = 0;
+			P->dirty = false;
+			parts_.push_back(P);
+		}
+
+		// node ownership and influence lists (compressed sparse rows)
+		outOff_.assign(ids + 1, 0);
+		largenet::Graph::NodeIteratorRange nodes = g_.nodes();
+		for (largenet::Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+		{
+			const unsigned int p = owner.at(n.id());
+			if (p >= partitions)
+				throw std::invalid_argument("Invalid partition index.");
+			owner_[n.id()] = p;
+			local_[n.id()] = parts_[p].nodes.size();
+			parts_[p].nodes.push_back(n.id());
+			outOff_[n.id() + 1] = n->outDegree() + n->undirectedDegree();
+		}
+		for (std::size_t i = 0; i < ids; ++i)
+			outOff_[i + 1] += outOff_[i];
+		outNb_.resize(outOff_[ids]);
+		for (largenet::Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+		{
+			std::size_t j = outOff_[n.id()];
+			largenet::Node::edge_iterator_range out = n->outEdges();
+			for (largenet::Node::edge_iterator e = out.first; e != out.second; ++e)
+				outNb_[j++] = (*e)->target()->id();
+			largenet::Node::edge_iterator_range un = n->undirectedEdges();
+			for (largenet::Node::edge_iterator e = un.first; e != un.second; ++e)
+				outNb_[j++] = (*e)->opposite(*n)->id();
+		}
+
+		// which partitions send messages to which
+		std::vector<std::vector<bool> > sends(partitions,
+				std::vector<bool>(partitions, false));
+		for (largenet::Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+			for (std::size_t j = outOff_[n.id()]; j < outOff_[n.id() + 1]; ++j)
+				sends[owner_[n.id()]][owner_[outNb_[j]]] = true;
+		for (unsigned int p = 0; p < partitions; ++p)
+		{
+			Partition& P = parts_[p];
+			for (unsigned int q = 0; q < partitions; ++q)
+				if (q != p && sends[q][p])
+					P.senders.push_back(q);
+			P.counts.assign(P.nodes.size() * C_, 0);
+			P.tree.init(P.nodes.size());
+		}
+		pool_.reset(new WorkerPool(partitions));
+		refresh();
+	}
+
+	void updateRate(Partition& P, std::size_t i)
+	{
+		P.tree.set(i,
+				rule_.rate(state_[P.nodes[i]], &P.counts[i * C_]));
+	}
+
+	/// apply state change of node n as seen from partition p
+	void apply(Partition& P, unsigned int p, largenet::node_id_t n,
+			largenet::node_state_t from, largenet::node_state_t to)
+	{
+		if (owner_[n] == p)
+		{
+			state_[n] = to;
+			updateRate(P, local_[n]);
+		}
+		for (std::size_t j = outOff_[n]; j < outOff_[n + 1]; ++j)
+		{
+			const largenet::node_id_t m = outNb_[j];
+			if (owner_[m] != p)
+				continue;
+			const std::size_t i = local_[m];
+			--P.counts[i * C_ + from];
+			++P.counts[i * C_ + to];
+			updateRate(P, i);
+		}
+	}
+
+	void send(Partition& P, unsigned int p, const Message& msg)
+	{
+		++P.stamp;
+		for (std::size_t j = outOff_[msg.node]; j < outOff_[msg.node + 1]; ++j)
+		{
+			const unsigned int q = owner_[outNb_[j]];
+			if (q != p && P.mark[q] != P.stamp)
+			{
+				P.mark[q] = P.stamp;
+				P.outbox[q].push_back(msg);
+			}
+		}
+	}
+
+	void rollback(Partition& P, unsigned int p)
+	{
+		for (typename std::vector<Change>::reverse_iterator c = P.log.rbegin(); c
+				!= P.log.rend(); ++c)
+			apply(P, p, c->node, c->to, c->from);
+		P.log.clear();
+		P.rng = P.checkpoint;
+		for (unsigned int q = 0; q < P.outbox.size(); ++q)
+			P.outbox[q].clear();
+		P.windowEvents = 0;
+	}
+
+	/// direct-method simulation of partition p in [from, to)
+	void simulate(Partition& P, unsigned int p, const double from,
+			const double to)
+	{
+		double t = from;
+		std::size_t k = 0;
+		while (true)
+		{
+			const double a = P.tree.total();
+			const double next =
+					a > 0 ? t + P.rng.Exponential(1.0 / a) : std::numeric_limits<
+									double>::infinity();
+			if (k < P.inbox.size() && P.inbox[k].time < std::min(next, to))
+			{
+				// external state change; the waiting time is memoryless
+				const Message& m = P.inbox[k++];
+				apply(P, p, m.node, m.from, m.to);
+				const Change c = { m.node, m.from, m.to };
+				P.log.push_back(c);
+				t = m.time;
+				continue;
+			}
+			if (next >= to)
+				break;
+			t = next;
+			const std::size_t i = P.tree.find(P.rng.Uniform01() * a);
+			const largenet::node_id_t n = P.nodes[i];
+			const largenet::node_state_t s = state_[n];
+			const largenet::node_state_t s2 = rule_.transition(s,
+					&P.counts[i * C_], P.rng);
+			++P.windowEvents;
+			if (s2 == s)
+				continue;
+			apply(P, p, n, s, s2);
+			const Change c = { n, s, s2 };
+			P.log.push_back(c);
+			const Message m = { t, n, s, s2 };
+			send(P, p, m);
+		}
+	}
+
+	/// collect messages for partition p; return true if they changed
+	bool exchange(Partition& P, unsigned int p)
+	{
+		std::vector<Message> in;
+		for (std::vector<unsigned int>::const_iterator q = P.senders.begin(); q
+				!= P.senders.end(); ++q)
+		{
+			const std::vector<Message>& out = parts_[*q].outbox[p];
+			in.insert(in.end(), out.begin(), out.end());
+		}
+		std::sort(in.begin(), in.end());
+		if (in == P.inbox)
+			return false;
+		P.inbox.swap(in);
+		return true;
+	}
+
+	void commit(Partition& P)
+	{
+		P.log.clear();
+		P.inbox.clear();
+		for (unsigned int q = 0; q < P.outbox.size(); ++q)
+			P.outbox[q].clear();
+		P.checkpoint = P.rng;
+		P.events += P.windowEvents;
+		P.windowEvents = 0;
+	}
+
+	void sync()
+	{
+		if (parts_.size() > 1)
+			pool_->barrier().wait();
+	}
+
+	void work(unsigned int p)
+	{
+		Partition& P = parts_[p];
+		while (true)
+		{
+			if (p == 0)
+			{
+				finished_ = !(t_ < tEnd_);
+				windowEnd_ = std::min(t_ + window_, tEnd_);
+				runs_ = 0;
+			}
+			sync();
+			if (finished_)
+				break;
+			P.dirty = true;
+			while (true)
+			{
+				if (P.dirty)
+				{
+					rollback(P, p);
+					simulate(P, p, t_, windowEnd_);
+				}
+				sync();
+				P.dirty = exchange(P, p);
+				sync();
+				if (p == 0)
+				{
+					unsigned int dirty = 0;
+					for (unsigned int q = 0; q < parts_.size(); ++q)
+						dirty += parts_[q].dirty;
+					rollbacks_ += dirty;
+					anyDirty_ = dirty > 0;
+					++runs_;
+				}
+				sync();
+				if (!anyDirty_)
+					break;
+			}
+			commit(P);
+			if (p == 0)
+			{
+				t_ = windowEnd_;
+				++windows_;
+				// adapt the window to keep re-executions rare
+				if (runs_ <= 2)
+					window_ *= 1.25;
+				else if (runs_ > 3)
+					window_ *= 0.5;
+			}
+			sync();
+		}
+	}
+
+	largenet::Graph& g_;
+	Rule rule_;
+	largenet::node_state_size_t C_;
+	std::vector<largenet::node_state_t> state_; ///< node states by ID
+	std::vector<unsigned int> owner_; ///< partition by node ID
+	std::vector<std::size_t> local_; ///< index within partition by node ID
+	std::vector<std::size_t> outOff_; ///< start of influenced nodes by node ID
+	std::vector<largenet::node_id_t> outNb_; ///< influenced nodes
+	boost::ptr_vector<Partition> parts_;
+	boost::scoped_ptr<WorkerPool> pool_; ///< one worker per partition
+	double t_, tEnd_, windowEnd_, window_;
+	unsigned long windows_, rollbacks_;
+	unsigned int runs_;
+	bool finished_, anyDirty_;
+};
+
+}
+}
+
+#endif /* PARTITIONEDSIMULATION_H_ */
@@ -0,0 +1,79 @@
+/**
+ * @file partition.h
+ * @date 18.10.2026
+ */
+
+#ifndef PARTITION_H_
+#define PARTITION_H_
+
+#include <largenet2/base/Graph.h>
+#include <largenet2/base/Node.h>
+#include <largenet2/base/Edge.h>
+#include <vector>
+#include <deque>
+#include <stdexcept>
+
+namespace sim
+{
+namespace partitioned
+{
+
+/**
+ * Partition the nodes of a graph into connected regions of equal size.
+ *
+ * The nodes are ordered by a breadth-first search over all components
+ * (ignoring edge directions), and consecutive blocks of this order are
+ * assigned to the parts. This keeps neighboring nodes mostly in the same
+ * part and thus few edges between parts, which is what the parallel
+ * simulation engines need.
+ *
+ * @param g graph
+ * @param parts number of parts
+ * @param owner vector to store the part of each node in, indexed by node ID;
+ * entries for invalid node IDs are set to @p parts
+ */
+inline void partitionGraph(const largenet::Graph& g, const unsigned int parts,
+		std::vector<unsigned int>& owner)
+{
+	if (parts == 0)
+		throw std::invalid_argument("Need at least one part.");
+	owner.assign(g.numberOfNodes() > 0 ? g.maxNodeID() + 1 : 0, parts);
+	const largenet::node_size_t size = (g.numberOfNodes() + parts - 1) / parts;
+	largenet::node_size_t assigned = 0;
+	std::deque<const largenet::Node*> queue;
+	std::vector<bool> seen(owner.size(), false);
+
+	largenet::Graph::ConstNodeIteratorRange nodes = g.nodes();
+	for (largenet::Graph::ConstNodeIterator seed = nodes.first; seed
+			!= nodes.second; ++seed)
+	{
+		if (seen[seed.id()])
+			continue;
+		seen[seed.id()] = true;
+		queue.push_back(&*seed);
+		while (!queue.empty())
+		{
+			const largenet::Node* n = queue.front();
+			queue.pop_front();
+			owner[n->id()] = assigned++ / size;
+			largenet::Node::edge_iterator_range r[3] =
+			{ n->outEdges(), n->inEdges(), n->undirectedEdges() };
+			for (unsigned int k = 0; k < 3; ++k)
+				for (largenet::Node::edge_iterator e = r[k].first; e
+						!= r[k].second; ++e)
+				{
+					const largenet::Node* m = (*e)->opposite(*n);
+					if (!seen[m->id()])
+					{
+						seen[m->id()] = true;
+						queue.push_back(m);
+					}
+				}
+		}
+	}
+}
+
+}
+}
+
+#endif /* PARTITION_H_ */
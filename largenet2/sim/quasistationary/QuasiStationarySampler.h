@@ -0,0 +1,196 @@
+/**
+ * @file QuasiStationarySampler.h
+ * @date 18.10.2026
+ */
+
+#ifndef QUASISTATIONARYSAMPLER_H_
+#define QUASISTATIONARYSAMPLER_H_
+
+#include <largenet2/base/Graph.h>
+#include <largenet2/base/GraphSnapshot.h>
+#include <boost/function.hpp>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+namespace sim
+{
+namespace quasistationary
+{
+
+/**
+ * Quasi-stationary simulation of models with an absorbing state.
+ *
+ * Implements the method of de Oliveira and Dickman, Phys. Rev. E 71, 016129
+ * (2005): the sampler keeps a ring of recently visited, non-absorbing
+ * configurations of the graph. Whenever the model reaches its absorbing
+ * state, one of the stored configurations is chosen at random and written
+ * back into the graph in place (see GraphSnapshot), and the simulation
+ * continues from there. After relaxation, time averages over a single long
+ * run then sample the quasi-stationary distribution, i.e. the distribution
+ * conditioned on survival, instead of requiring many restarted runs.
+ *
+ * The model must provide
+ * @code
+ * double step(RandomGen& rng); // perform one step, return time increment
+ * bool stopped();              // true in the absorbing state
+ * @endcode
+ * and must read its state from the graph, as SISModel does. Models that cache
+ * state can be notified of reinjections through setRestoreCallback().
+ *
+ * Configurations are captured at regular time intervals, overwriting the
+ * oldest stored one. For models on adaptive networks, the topology must be
+ * captured as well.
+ */
+template<class Model, class RandomGen>
+class QuasiStationarySampler
+{
+public:
+	typedef boost::function<void()> RestoreCallback;
+
+	/**
+	 * Constructor
+	 * @param g graph the model acts on
+	 * @param model model
+	 * @param rng random number generator
+	 * @param capacity number of stored configurations
+	 * @param interval time between captured configurations
+	 * @param topology whether to capture the edges as well (needed for
+	 * adaptive networks)
+	 */
+	QuasiStationarySampler(largenet::Graph& g, Model& model, RandomGen& rng,
+			unsigned int capacity = 100, double interval = 1.0,
+			bool topology = false) :
+			g_(g), model_(model), rng_(rng), ring_(capacity), stored_(0),
+					next_(0), interval_(interval), topology_(topology), t_(0),
+					nextCapture_(0), reinjections_(0), avgTime_(0),
+					sums_(g.numberOfNodeStates(), 0.0),
+					counts_(g.numberOfNodeStates(), 0)
+	{
+		if (capacity == 0)
+			throw std::invalid_argument("Capacity must be positive.");
+		if (interval <= 0)
+			throw std::invalid_argument("Interval must be positive.");
+	}
+
+	void setRestoreCallback(const RestoreCallback& f)
+	{
+		restored_ = f;
+	}
+
+	/**
+	 * Perform one model step, reinjecting a stored configuration if the
+	 * absorbing state is reached.
+	 * @return time increment
+	 */
+	double step()
+	{
+		if (model_.stopped())
+			reinject();
+		if (t_ >= nextCapture_)
+		{
+			capture();
+			nextCapture_ = t_ + interval_;
+		}
+		// the configuration before the step persists for the time increment
+		for (largenet::node_state_t s = 0; s < counts_.size(); ++s)
+			counts_[s] = g_.numberOfNodes(s);
+		const double dt = model_.step(rng_);
+		for (largenet::node_state_t s = 0; s < sums_.size(); ++s)
+			sums_[s] += dt * counts_[s];
+		avgTime_ += dt;
+		t_ += dt;
+		if (model_.stopped())
+			reinject();
+		return dt;
+	}
+
+	/**
+	 * Simulate up to time @p tmax.
+	 */
+	void advance(double tmax)
+	{
+		while (t_ < tmax)
+			step();
+	}
+
+	/**
+	 * Discard the time averages accumulated so far, e.g. after relaxation.
+	 */
+	void resetAverages()
+	{
+		avgTime_ = 0;
+		std::fill(sums_.begin(), sums_.end(), 0.0);
+	}
+	/**
+	 * Time-averaged number of nodes in state @p s since the last call to
+	 * resetAverages() (quasi-stationary average after relaxation).
+	 */
+	double meanNodes(largenet::node_state_t s) const
+	{
+		return avgTime_ > 0 ? sums_.at(s) / avgTime_ : g_.numberOfNodes(s);
+	}
+
+	double time() const
+	{
+		return t_;
+	}
+	/// number of times the absorbing state was left by reinjection
+	unsigned long reinjections() const
+	{
+		return reinjections_;
+	}
+	/// number of currently stored configurations
+	unsigned int stored() const
+	{
+		return stored_;
+	}
+	unsigned int capacity() const
+	{
+		return ring_.size();
+	}
+
+private:
+	void capture()
+	{
+		if (model_.stopped())
+			return;
+		ring_[next_].capture(g_, topology_);
+		next_ = (next_ + 1) % ring_.size();
+		if (stored_ < ring_.size())
+			++stored_;
+	}
+
+	void reinject()
+	{
+		if (stored_ == 0)
+			throw std::logic_error(
+					"Absorbing state reached before any configuration was stored.");
+		unsigned int k = static_cast<unsigned int>(stored_ * rng_.Uniform01());
+		if (k >= stored_)
+			k = stored_ - 1;
+		ring_[k].restore(g_);
+		++reinjections_;
+		if (restored_)
+			restored_();
+	}
+
+	largenet::Graph& g_;
+	Model& model_;
+	RandomGen& rng_;
+	std::vector<largenet::GraphSnapshot> ring_;
+	unsigned int stored_, next_;
+	double interval_;
+	bool topology_;
+	double t_, nextCapture_;
+	unsigned long reinjections_;
+	double avgTime_;
+	std::vector<double> sums_; ///< time-integrated node counts per state
+	std::vector<largenet::node_size_t> counts_;
+	RestoreCallback restored_;
+};
+
+}
+}
+
+#endif /* QUASISTATIONARYSAMPLER_H_ */
@@ -0,0 +1,122 @@
+/**
+ * @file AliasTable.h
+ * @date 18.10.2026
+ */
+
+#ifndef ALIASTABLE_H_
+#define ALIASTABLE_H_
+
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+namespace sim
+{
+namespace random
+{
+
+/**
+ * Walker's alias table for sampling from a fixed discrete distribution in
+ * O(1) time.
+ *
+ * The table is built in O(n) time with Vose's method (M. D. Vose, "A linear
+ * algorithm for generating random numbers with a given distribution", IEEE
+ * Trans. Softw. Eng. 17, 972 (1991)). Each sample needs a single uniform
+ * variate. Use it whenever the same distribution is sampled many times, e.g.
+ * for initial state assignment or rewiring targets; for distributions that
+ * change after every draw, use a binary sum tree instead.
+ */
+class AliasTable
+{
+public:
+	AliasTable()
+	{
+	}
+	/**
+	 * Constructor
+	 * @param weights non-negative, not necessarily normalized weights
+	 */
+	explicit AliasTable(const std::vector<double>& weights)
+	{
+		assign(weights);
+	}
+
+	/**
+	 * Rebuild the table for @p weights.
+	 * @throw std::invalid_argument if a weight is negative or all are zero
+	 */
+	void assign(const std::vector<double>& weights)
+	{
+		const std::size_t n = weights.size();
+		double total = 0;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			if (weights[i] < 0)
+				throw std::invalid_argument("Weights must be non-negative.");
+			total += weights[i];
+		}
+		if (!(total > 0))
+			throw std::invalid_argument("Total weight must be positive.");
+
+		prob_.resize(n);
+		alias_.resize(n);
+		std::vector<std::size_t> small, large;
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			prob_[i] = weights[i] * n / total;
+			alias_[i] = i;
+			(prob_[i] < 1 ? small : large).push_back(i);
+		}
+		while (!small.empty() && !large.empty())
+		{
+			const std::size_t s = small.back(), l = large.back();
+			small.pop_back();
+			alias_[s] = l;
+			prob_[l] -= 1 - prob_[s];
+			if (prob_[l] < 1)
+			{
+				large.pop_back();
+				small.push_back(l);
+			}
+		}
+		// the remaining columns are full up to rounding errors
+		for (std::size_t i = 0; i < large.size(); ++i)
+			prob_[large[i]] = 1;
+		for (std::size_t i = 0; i < small.size(); ++i)
+			prob_[small[i]] = 1;
+	}
+
+	/// Number of outcomes
+	std::size_t size() const
+	{
+		return prob_.size();
+	}
+	bool empty() const
+	{
+		return prob_.empty();
+	}
+
+	/**
+	 * Draw an outcome in [0, size()).
+	 * @param rng random number generator providing Uniform01()
+	 */
+	template<class RandomGen>
+	std::size_t sample(RandomGen& rng) const
+	{
+		const std::size_t n = prob_.size();
+		const double u = n * rng.Uniform01();
+		std::size_t i = static_cast<std::size_t> (u);
+		if (i >= n)
+			i = n - 1;
+		return u - i < prob_[i] ? i : alias_[i];
+	}
+
+private:
+	std::vector<double> prob_; ///< probability of keeping column i
+	std::vector<std::size_t> alias_; ///< outcome sharing column i
+};
+
+}
+}
+
+#endif /* ALIASTABLE_H_ */
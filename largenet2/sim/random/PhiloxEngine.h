@@ -0,0 +1,271 @@
+/**
+ * @file PhiloxEngine.h
+ * @date 18.10.2026
+ */
+
+#ifndef PHILOXENGINE_H_
+#define PHILOXENGINE_H_
+
+#include <boost/cstdint.hpp>
+
+namespace sim
+{
+namespace random
+{
+
+/**
+ * The Philox4x32-10 counter-based random number generator.
+ *
+ * Philox (Salmon, Moraes, Dror, and Shaw, "Parallel random numbers: as easy
+ * as 1, 2, 3", SC'11) computes each block of four 32-bit outputs by applying
+ * a keyed bijection (ten rounds of multiply-and-xor) to a 128-bit counter.
+ * The generator has no state besides key and counter, so that
+ * - every stream (selected by setStream()) is a disjoint range of 2^64
+ *   counter blocks under the same key, and streams of the same seed are
+ *   therefore independent by construction;
+ * - setting up a stream, and jumping ahead with discard(), take O(1) time.
+ *
+ * Different seeds select different keys; combined with sim::deriveSeed(),
+ * which maps distinct stream indices to distinct seeds, this also gives
+ * independent generators to the threads of the parallel engines that seed
+ * their generators individually.
+ *
+ * PhiloxEngine satisfies the engine interface of myrng::RandomVariates and
+ * can thus be used wherever a RandomVariates<WELLEngine> is used, including
+ * Graph::randomNode() and Graph::randomEdge():
+ * @code
+ * myrng::RandomVariates<sim::random::PhiloxEngine> rng;
+ * rng.seed(42);
+ * rng.setStream(replica);
+ * @endcode
+ */
+class PhiloxEngine
+{
+public:
+	typedef boost::uint32_t result_type;
+
+	PhiloxEngine()
+	{
+		seed(0);
+	}
+	explicit PhiloxEngine(unsigned long s, boost::uint64_t stream = 0)
+	{
+		seed(s);
+		setStream(stream);
+	}
+
+	/// Set the seed (the key) and restart stream 0 from the beginning.
+	void seed(unsigned long s)
+	{
+		seed_ = s;
+		const boost::uint64_t k = s;
+		key_[0] = static_cast<boost::uint32_t>(k);
+		key_[1] = static_cast<boost::uint32_t>(k >> 32);
+		ctr_[0] = ctr_[1] = ctr_[2] = ctr_[3] = 0;
+		used_ = 4;
+	}
+	/// Returns the seed.
+	unsigned long getSeed() const
+	{
+		return seed_;
+	}
+	/// Returns the name of the random number generator engine.
+	const char* getName() const
+	{
+		return "Philox4x32-10";
+	}
+
+	/**
+	 * Select stream @p stream and restart it from the beginning. Each stream
+	 * has a period of 2^66 32-bit outputs.
+	 */
+	void setStream(boost::uint64_t stream)
+	{
+		ctr_[0] = ctr_[1] = 0;
+		ctr_[2] = static_cast<boost::uint32_t>(stream);
+		ctr_[3] = static_cast<boost::uint32_t>(stream >> 32);
+		used_ = 4;
+	}
+	boost::uint64_t stream() const
+	{
+		return (static_cast<boost::uint64_t>(ctr_[3]) << 32) | ctr_[2];
+	}
+
+	/**
+	 * Skip @p n 32-bit outputs in O(1) time. Each call to operator()()
+	 * consumes two outputs.
+	 */
+	void discard(boost::uint64_t n)
+	{
+		// position of the next output within the stream
+		boost::uint64_t pos = position() + n;
+		boost::uint64_t block = pos / 4;
+		used_ = static_cast<unsigned int>(pos % 4);
+		if (used_ == 0)
+		{
+			used_ = 4;
+			setBlock(block);
+		}
+		else
+		{
+			setBlock(block);
+			generate();
+			increment();
+		}
+	}
+
+	/// Produce a random 32-bit integer.
+	result_type next()
+	{
+		if (used_ == 4)
+		{
+			generate();
+			increment();
+			used_ = 0;
+		}
+		return out_[used_++];
+	}
+
+	/**
+	 * Produce a random number uniformly distributed in (0,1), with 53 bits of
+	 * resolution.
+	 */
+	double operator()()
+	{
+		const result_type a = next();
+		return toDouble(a, next());
+	}
+
+	/**
+	 * Produce @p n random numbers, the same as @p n calls to operator()().
+	 *
+	 * Whole blocks are computed for several counters side by side, in loops
+	 * over independent lanes that the compiler can vectorise.
+	 */
+	void fill(double* out, std::size_t n)
+	{
+		std::size_t i = 0;
+		// finish the current block
+		while (i < n && used_ != 4)
+			out[i++] = (*this)();
+		const unsigned int lanes = 16;
+		while (n - i >= 2 * lanes)
+		{
+			boost::uint32_t c0[lanes], c1[lanes], c2[lanes], c3[lanes];
+			for (unsigned int l = 0; l < lanes; ++l)
+			{
+				c0[l] = ctr_[0] + l;
+				c1[l] = ctr_[1] + (c0[l] < ctr_[0]);
+				c2[l] = ctr_[2];
+				c3[l] = ctr_[3];
+			}
+			boost::uint32_t k0 = key_[0], k1 = key_[1];
+			for (unsigned int r = 0; r < 10; ++r)
+			{
+				if (r > 0)
+				{
+					k0 += 0x9E3779B9U;
+					k1 += 0xBB67AE85U;
+				}
+				for (unsigned int l = 0; l < lanes; ++l)
+				{
+					const boost::uint64_t p0 = static_cast<boost::uint64_t>(
+							0xD2511F53U) * c0[l];
+					const boost::uint64_t p1 = static_cast<boost::uint64_t>(
+							0xCD9E8D57U) * c2[l];
+					c0[l] = static_cast<boost::uint32_t>(p1 >> 32) ^ c1[l] ^ k0;
+					c1[l] = static_cast<boost::uint32_t>(p1);
+					c2[l] = static_cast<boost::uint32_t>(p0 >> 32) ^ c3[l] ^ k1;
+					c3[l] = static_cast<boost::uint32_t>(p0);
+				}
+			}
+			for (unsigned int l = 0; l < lanes; ++l)
+			{
+				out[i + 2 * l] = toDouble(c0[l], c1[l]);
+				out[i + 2 * l + 1] = toDouble(c2[l], c3[l]);
+			}
+			i += 2 * lanes;
+			if ((ctr_[0] += lanes) < lanes)
+				++ctr_[1];
+		}
+		while (i < n)
+			out[i++] = (*this)();
+	}
+
+	/**
+	 * Compute the Philox4x32-10 block for counter @p ctr and key @p key
+	 * (for testing against known answers).
+	 */
+	static void block(const boost::uint32_t ctr[4], const boost::uint32_t key[2],
+			boost::uint32_t out[4])
+	{
+		boost::uint32_t c[4] = { ctr[0], ctr[1], ctr[2], ctr[3] };
+		boost::uint32_t k[2] = { key[0], key[1] };
+		for (unsigned int r = 0; r < 10; ++r)
+		{
+			if (r > 0)
+			{
+				k[0] += 0x9E3779B9U;
+				k[1] += 0xBB67AE85U;
+			}
+			const boost::uint64_t p0 = static_cast<boost::uint64_t>(0xD2511F53U)
+					* c[0];
+			const boost::uint64_t p1 = static_cast<boost::uint64_t>(0xCD9E8D57U)
+					* c[2];
+			const boost::uint32_t hi0 = static_cast<boost::uint32_t>(p0 >> 32),
+					lo0 = static_cast<boost::uint32_t>(p0);
+			const boost::uint32_t hi1 = static_cast<boost::uint32_t>(p1 >> 32),
+					lo1 = static_cast<boost::uint32_t>(p1);
+			c[0] = hi1 ^ c[1] ^ k[0];
+			c[1] = lo1;
+			c[2] = hi0 ^ c[3] ^ k[1];
+			c[3] = lo0;
+		}
+		out[0] = c[0];
+		out[1] = c[1];
+		out[2] = c[2];
+		out[3] = c[3];
+	}
+
+private:
+	/// combine two outputs into a double in (0,1)
+	static double toDouble(const result_type a, const result_type b)
+	{
+		return ((static_cast<boost::uint64_t>(a >> 5) << 26) + (b >> 6) + 0.5)
+				* (1.0 / 9007199254740992.0);
+	}
+	void generate()
+	{
+		block(ctr_, key_, out_);
+	}
+	/// advance the block counter (low 64 bits of the counter)
+	void increment()
+	{
+		if (++ctr_[0] == 0)
+			++ctr_[1];
+	}
+	void setBlock(boost::uint64_t block)
+	{
+		ctr_[0] = static_cast<boost::uint32_t>(block);
+		ctr_[1] = static_cast<boost::uint32_t>(block >> 32);
+	}
+	/// number of outputs consumed in the current stream
+	boost::uint64_t position() const
+	{
+		const boost::uint64_t next = (static_cast<boost::uint64_t>(ctr_[1])
+				<< 32) | ctr_[0];
+		// out_ holds block next - 1 unless nothing has been generated yet
+		return used_ == 4 ? next * 4 : (next - 1) * 4 + used_;
+	}
+
+	unsigned long seed_;
+	boost::uint32_t key_[2];
+	boost::uint32_t ctr_[4]; ///< counter of the next block to generate
+	boost::uint32_t out_[4]; ///< current output block
+	unsigned int used_; ///< number of outputs used from out_
+};
+
+}
+}
+
+#endif /* PHILOXENGINE_H_ */
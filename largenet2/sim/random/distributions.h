@@ -0,0 +1,198 @@
+/**
+ * @file distributions.h
+ * @date 18.10.2026
+ */
+
+#ifndef DISTRIBUTIONS_H_
+#define DISTRIBUTIONS_H_
+
+#include <cmath>
+
+namespace sim
+{
+namespace random
+{
+
+namespace detail
+{
+
+/// log(k!)
+inline double logFactorial(const double k)
+{
+	if (k < 10)
+	{
+		double f = 0;
+		for (double i = 2; i <= k; ++i)
+			f += std::log(i);
+		return f;
+	}
+	// Stirling series
+	const double x = k + 1, x2 = x * x;
+	return (x - 0.5) * std::log(x) - x + 0.918938533204672742
+			+ (1.0 / 12 - (1.0 / 360 - (1.0 / 1260 - 1.0 / (1680 * x2)) / x2)
+					/ x2) / x;
+}
+
+/// Stirling correction log(k!) - [(k + 1/2) log(k + 1) - (k + 1) + log(2 pi)/2]
+inline double stirlingCorrection(const double k)
+{
+	return logFactorial(k) - ((k + 0.5) * std::log(k + 1) - (k + 1)
+			+ 0.918938533204672742);
+}
+
+}
+
+/**
+ * Draw a Poisson-distributed number with mean @p mean.
+ *
+ * Uses inversion for small means and the transformed rejection method PTRS
+ * (W. Hoermann, "The transformed rejection method for generating Poisson
+ * random variables", Insurance Math. Econom. 12, 39 (1993)) for
+ * @p mean >= 10, which needs about 1.2 pairs of uniform variates per draw
+ * independent of the mean.
+ *
+ * @p rng must provide Uniform01().
+ */
+template<class RandomGen>
+unsigned long poisson(RandomGen& rng, const double mean)
+{
+	if (mean <= 0)
+		return 0;
+	if (mean < 10)
+	{
+		double p = std::exp(-mean), u = rng.Uniform01();
+		unsigned long k = 0;
+		while (u > p && p > 0)
+		{
+			u -= p;
+			++k;
+			p *= mean / k;
+		}
+		return k;
+	}
+	const double slam = std::sqrt(mean), loglam = std::log(mean);
+	const double b = 0.931 + 2.53 * slam, a = -0.059 + 0.02483 * b;
+	const double invalpha = 1.1239 + 1.1328 / (b - 3.4);
+	const double vr = 0.9277 - 3.6224 / (b - 2);
+	while (true)
+	{
+		const double u = rng.Uniform01() - 0.5, v = rng.Uniform01();
+		const double us = 0.5 - std::fabs(u);
+		const double k = std::floor((2 * a / us + b) * u + mean + 0.43);
+		if (us >= 0.07 && v <= vr)
+			return static_cast<unsigned long> (k);
+		if (k < 0 || (us < 0.013 && v > us))
+			continue;
+		if (std::log(v * invalpha / (a / (us * us) + b)) <= -mean + k * loglam
+				- detail::logFactorial(k))
+			return static_cast<unsigned long> (k);
+	}
+}
+
+/**
+ * Draw a binomially distributed number of successes in @p n trials with
+ * success probability @p p.
+ *
+ * Uses inversion if the smaller of @f$np@f$ and @f$n(1-p)@f$ is below 10,
+ * and the transformed rejection method BTRD (W. Hoermann, "The generation of
+ * binomial random variates", J. Statist. Comput. Simul. 46, 101 (1993))
+ * otherwise.
+ *
+ * @p rng must provide Uniform01().
+ */
+template<class RandomGen>
+unsigned long binomial(RandomGen& rng, const unsigned long n, const double p)
+{
+	if (p <= 0 || n == 0)
+		return 0;
+	if (p >= 1)
+		return n;
+	if (p > 0.5)
+		return n - binomial(rng, n, 1 - p);
+
+	const double q = 1 - p, r = p / q;
+	if (n * p < 10)
+	{
+		const double a = (n + 1) * r, f0 = std::pow(q, static_cast<double> (n));
+		while (true)
+		{
+			double f = f0, u = rng.Uniform01();
+			unsigned long k = 0;
+			while (u > f && k < n)
+			{
+				u -= f;
+				++k;
+				f *= a / k - r;
+			}
+			if (u <= f)
+				return k;
+			// u exceeded the total probability due to rounding
+		}
+	}
+
+	const double m = std::floor((n + 1) * p), nr = (n + 1) * r;
+	const double npq = n * p * q, spq = std::sqrt(npq);
+	const double b = 1.15 + 2.53 * spq, a = -0.0873 + 0.0248 * b + 0.01 * p;
+	const double c = n * p + 0.5, alpha = (2.83 + 5.1 / b) * spq;
+	const double vr = 0.92 - 4.2 / b, urvr = 0.86 * vr;
+	while (true)
+	{
+		double v = rng.Uniform01(), u;
+		if (v <= urvr)
+		{
+			u = v / vr - 0.43;
+			return static_cast<unsigned long> (std::floor((2 * a / (0.5
+					- std::fabs(u)) + b) * u + c));
+		}
+		if (v >= vr)
+			u = rng.Uniform01() - 0.5;
+		else
+		{
+			u = v / vr - 0.93;
+			u = (u < 0 ? -0.5 : 0.5) - u;
+			v = rng.Uniform01() * vr;
+		}
+		const double us = 0.5 - std::fabs(u);
+		const double k = std::floor((2 * a / us + b) * u + c);
+		if (k < 0 || k > n)
+			continue;
+		v *= alpha / (a / (us * us) + b);
+		const double km = std::fabs(k - m);
+		if (km <= 15)
+		{
+			// recursive evaluation of f(k)/f(m)
+			double f = 1;
+			if (m < k)
+				for (double i = m + 1; i <= k; ++i)
+					f *= nr / i - r;
+			else
+				for (double i = k + 1; i <= m; ++i)
+					v *= nr / i - r;
+			if (v <= f)
+				return static_cast<unsigned long> (k);
+			continue;
+		}
+		// squeeze with the normal approximation, then the exact test
+		v = std::log(v);
+		const double rho = km / npq * (((km / 3 + 0.625) * km + 1.0 / 6) / npq
+				+ 0.5);
+		const double t = -km * km / (2 * npq);
+		if (v < t - rho)
+			return static_cast<unsigned long> (k);
+		if (v > t + rho)
+			continue;
+		const double nm = n - m + 1, nk = n - k + 1;
+		const double h = (m + 0.5) * std::log((m + 1) / (r * nm))
+				+ detail::stirlingCorrection(m) + detail::stirlingCorrection(n
+				- m);
+		if (v <= h + (n + 1) * std::log(nm / nk) + (k + 0.5) * std::log(nk * r
+				/ (k + 1)) - detail::stirlingCorrection(k)
+				- detail::stirlingCorrection(n - k))
+			return static_cast<unsigned long> (k);
+	}
+}
+
+}
+}
+
+#endif /* DISTRIBUTIONS_H_ */
@@ -0,0 +1,234 @@
+/**
+ * @file ForwardFluxSampling.h
+ * @date 18.10.2026
+ */
+
+#ifndef FORWARDFLUXSAMPLING_H_
+#define FORWARDFLUXSAMPLING_H_
+
+#include <largenet2/base/Graph.h>
+#include <largenet2/base/GraphSnapshot.h>
+#include <boost/function.hpp>
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+
+namespace sim
+{
+namespace rare
+{
+
+/**
+ * Rare event sampling by forward flux sampling (FFS).
+ *
+ * Estimates the rate of, and the probability of reaching, a rare target
+ * region B from a basin A, following Allen, Warren, and ten Wolde,
+ * Phys. Rev. Lett. 94, 018104 (2005). Regions are defined by a reaction
+ * coordinate @f$\lambda@f$ (e.g. the number of infected nodes) and a sequence
+ * of interfaces @f$\lambda_0 < \lambda_1 < \dots < \lambda_n@f$: A is
+ * @f$\lambda < \lambda_0@f$ and B is @f$\lambda \ge \lambda_n@f$. For events
+ * in which the coordinate decreases, such as extinction, use its negative.
+ *
+ * - Stage 0: starting from the graph's current configuration in A, the model
+ *   is simulated until it has left A a given number of times. The
+ *   configuration at each exit is stored, and the flux @f$\Phi@f$ is the
+ *   number of exits per unit time spent in A. If the model stops (reaches an
+ *   absorbing state) or enters B, it is reset to the initial configuration.
+ * - Stage i: trials are started from randomly chosen configurations stored
+ *   at interface @f$\lambda_{i-1}@f$, and run until they either reach
+ *   @f$\lambda_i@f$ (success; the configuration is stored) or return to A or
+ *   stop (failure). The fraction of successes estimates the conditional
+ *   probability @f$p_i@f$.
+ *
+ * The probability of reaching B after leaving A is @f$P = \prod_i p_i@f$, and
+ * the rate of A-to-B transitions is @f$k = \Phi P@f$. Standard errors are
+ * computed from binomial statistics for each stage, neglecting correlations
+ * between trials started from the same configuration.
+ *
+ * Configurations are stored as GraphSnapshot objects and restored into the
+ * simulated graph in place; the random number generator is not rewound, so
+ * that trials started from the same configuration diverge. The model must
+ * provide
+ * @code
+ * double step(RandomGen& rng); // perform one step, return time increment
+ * bool stopped();              // true in an absorbing state
+ * @endcode
+ * and must read its state from the graph, as SISModel does. Models that cache
+ * state can be notified of restored configurations through
+ * setRestoreCallback().
+ */
+template<class Model, class RandomGen>
+class ForwardFluxSampling
+{
+public:
+	typedef boost::function<double()> Coordinate;
+	typedef boost::function<void()> RestoreCallback;
+
+	/// Result of a forward flux sampling run
+	struct Result
+	{
+		double flux, fluxError; ///< flux out of A per unit time
+		double time; ///< time spent in A in stage 0
+		std::vector<unsigned long> trials, successes; ///< per stage i >= 1
+		std::vector<double> probabilities; ///< conditional probabilities per stage
+		double probability, probabilityError; ///< probability of reaching B
+		double rate, rateError; ///< rate of A-to-B transitions
+	};
+
+	/**
+	 * Constructor
+	 * @param g graph the model acts on
+	 * @param model model
+	 * @param rng random number generator
+	 * @param lambda reaction coordinate
+	 * @param interfaces strictly increasing interface positions
+	 * @param topology whether configurations include the edges (needed for
+	 * adaptive networks)
+	 */
+	ForwardFluxSampling(largenet::Graph& g, Model& model, RandomGen& rng,
+			const Coordinate& lambda, const std::vector<double>& interfaces,
+			bool topology = false) :
+			g_(g), model_(model), rng_(rng), lambda_(lambda),
+					interfaces_(interfaces), topology_(topology), crossings_(
+							100), trials_(1000)
+	{
+		if (interfaces.size() < 2)
+			throw std::invalid_argument("Need at least two interfaces.");
+		for (unsigned int i = 1; i < interfaces.size(); ++i)
+			if (!(interfaces[i] > interfaces[i - 1]))
+				throw std::invalid_argument(
+						"Interfaces must be strictly increasing.");
+	}
+
+	void setRestoreCallback(const RestoreCallback& f)
+	{
+		restored_ = f;
+	}
+	/// number of configurations to collect at the first interface
+	void setInitialCrossings(unsigned int n)
+	{
+		crossings_ = n;
+	}
+	/// number of trials per stage
+	void setTrials(unsigned int n)
+	{
+		trials_ = n;
+	}
+
+	/**
+	 * Perform forward flux sampling. The graph is left in the last simulated
+	 * configuration.
+	 * @throw std::invalid_argument if the initial configuration is not in A
+	 */
+	Result run()
+	{
+		if (crossings_ == 0 || trials_ == 0)
+			throw std::invalid_argument("Need at least one crossing and trial.");
+		if (!(lambda_() < interfaces_[0]) || model_.stopped())
+			throw std::invalid_argument(
+					"Initial configuration must be in A and not absorbing.");
+		Result r;
+		const largenet::GraphSnapshot initial(g_, topology_);
+		std::vector<largenet::GraphSnapshot> current, next;
+
+		// stage 0: flux through the first interface
+		current.reserve(crossings_);
+		r.time = 0;
+		bool inA = true;
+		while (current.size() < crossings_)
+		{
+			const double dt = model_.step(rng_);
+			if (inA)
+				r.time += dt;
+			const double x = lambda_();
+			if (model_.stopped() || x >= interfaces_.back())
+			{
+				restore(initial);
+				inA = true;
+			}
+			else if (x < interfaces_[0])
+				inA = true;
+			else if (inA)
+			{
+				current.push_back(largenet::GraphSnapshot(g_, topology_));
+				inA = false;
+			}
+		}
+		const double n0 = current.size();
+		r.flux = n0 / r.time;
+		r.fluxError = r.flux / std::sqrt(n0);
+
+		// stages 1..n: conditional probabilities
+		r.probability = 1;
+		double relVar = 0;
+		for (unsigned int i = 1; i < interfaces_.size(); ++i)
+		{
+			next.clear();
+			unsigned long success = 0;
+			for (unsigned int k = 0; k < trials_; ++k)
+			{
+				unsigned int j = static_cast<unsigned int>(current.size()
+						* rng_.Uniform01());
+				if (j >= current.size())
+					j = current.size() - 1;
+				restore(current[j]);
+				if (trial(interfaces_[i]))
+				{
+					++success;
+					next.push_back(largenet::GraphSnapshot(g_, topology_));
+				}
+			}
+			const double p = static_cast<double>(success) / trials_;
+			r.trials.push_back(trials_);
+			r.successes.push_back(success);
+			r.probabilities.push_back(p);
+			r.probability *= p;
+			if (success == 0)
+				break;
+			relVar += (1 - p) / (p * trials_);
+			current.swap(next);
+		}
+		r.probabilityError = r.probability * std::sqrt(relVar);
+		r.rate = r.flux * r.probability;
+		r.rateError = r.rate * std::sqrt(relVar + 1.0 / n0);
+		return r;
+	}
+
+private:
+	/// simulate until @p target is reached (true) or the model returns to A
+	bool trial(const double target)
+	{
+		while (true)
+		{
+			if (model_.stopped())
+				return false;
+			model_.step(rng_);
+			const double x = lambda_();
+			if (x >= target)
+				return true;
+			if (x < interfaces_[0])
+				return false;
+		}
+	}
+
+	void restore(const largenet::GraphSnapshot& s)
+	{
+		s.restore(g_);
+		if (restored_)
+			restored_();
+	}
+
+	largenet::Graph& g_;
+	Model& model_;
+	RandomGen& rng_;
+	Coordinate lambda_;
+	std::vector<double> interfaces_;
+	bool topology_;
+	unsigned int crossings_, trials_;
+	RestoreCallback restored_;
+};
+
+}
+}
+
+#endif /* FORWARDFLUXSAMPLING_H_ */
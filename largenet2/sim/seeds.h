@@ -0,0 +1,33 @@
+/**
+ * @file seeds.h
+ * @date 18.10.2026
+ */
+
+#ifndef SEEDS_H_
+#define SEEDS_H_
+
+#include <boost/cstdint.hpp>
+
+namespace sim
+{
+
+/**
+ * Derive the seed of random number stream @p stream from a master seed.
+ *
+ * Uses the SplitMix64 mixing function, so that seeds of neighboring streams
+ * (and of neighboring master seeds) are statistically unrelated. This is
+ * used to give each replica, partition or thread of a parallel simulation
+ * its own random number generator.
+ */
+inline unsigned long deriveSeed(unsigned long seed, unsigned int stream)
+{
+	boost::uint64_t z = static_cast<boost::uint64_t>(seed)
+			+ (static_cast<boost::uint64_t>(stream) + 1) * 0x9E3779B97F4A7C15ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return static_cast<unsigned long>(z ^ (z >> 31));
+}
+
+}
+
+#endif /* SEEDS_H_ */
@@ -0,0 +1,126 @@
+/**
+ * @file statistics.h
+ * @date 18.10.2026
+ */
+
+#ifndef STATISTICS_H_
+#define STATISTICS_H_
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace sim
+{
+
+/**
+ * Mean and standard error of @p x[begin, end) by the method of batch means,
+ * which accounts for autocorrelation within the series.
+ *
+ * The series is split into @p batches batches of equal size, dropping the
+ * remainder at the end, and the mean and its standard error are estimated
+ * from the batch means. With fewer than two batches, @p mean is that of all
+ * values and @p error is 0.
+ */
+inline void batchMeans(const std::vector<double>& x, const std::size_t begin,
+		const std::size_t end, unsigned int batches, double& mean,
+		double& error)
+{
+	const std::size_t n = end - begin;
+	mean = 0;
+	error = 0;
+	if (n == 0)
+		return;
+	batches = std::min<std::size_t>(batches, n);
+	if (batches < 2)
+	{
+		for (std::size_t i = begin; i < end; ++i)
+			mean += x[i];
+		mean /= n;
+		return;
+	}
+	const std::size_t size = n / batches;
+	std::vector<double> m(batches, 0);
+	for (unsigned int b = 0; b < batches; ++b)
+	{
+		for (std::size_t i = begin + b * size; i < begin + (b + 1) * size; ++i)
+			m[b] += x[i];
+		m[b] /= size;
+		mean += m[b];
+	}
+	mean /= batches;
+	double var = 0;
+	for (unsigned int b = 0; b < batches; ++b)
+		var += (m[b] - mean) * (m[b] - mean);
+	error = std::sqrt(var / (batches - 1) / batches);
+}
+
+/**
+ * 97.5% quantile of Student's t distribution with @p dof degrees of freedom,
+ * i.e. the factor of the standard error giving a 95% confidence interval.
+ *
+ * Tabulated up to 30 degrees of freedom, beyond that from the Cornish-Fisher
+ * expansion, which is accurate to better than 1e-3.
+ */
+inline double tQuantile975(const unsigned int dof)
+{
+	static const double table[] = { 0, 12.706, 4.303, 3.182, 2.776, 2.571,
+			2.447, 2.365, 2.306, 2.262, 2.228, 2.201, 2.179, 2.160, 2.145, 2.131,
+			2.120, 2.110, 2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064, 2.060,
+			2.056, 2.052, 2.048, 2.045, 2.042 };
+	if (dof < sizeof(table) / sizeof(table[0]))
+		return table[dof];
+	const double z = 1.959964, z2 = z * z, n = dof;
+	return z + (z2 + 1) * z / (4 * n) + ((5 * z2 + 16) * z2 + 3) * z / (96 * n
+			* n);
+}
+
+/**
+ * Batch means estimate of the mean of @p x[begin, end) with the half width
+ * of its 95% confidence interval.
+ * @see batchMeans()
+ */
+inline void batchMeansInterval(const std::vector<double>& x,
+		const std::size_t begin, const std::size_t end,
+		const unsigned int batches, double& mean, double& halfWidth)
+{
+	double error;
+	batchMeans(x, begin, end, batches, mean, error);
+	const std::size_t b = std::min<std::size_t>(batches, end - begin);
+	halfWidth = b < 2 ? 0 : tQuantile975(b - 1) * error;
+}
+
+/**
+ * End of the initial transient of @p y by the MSER rule (White, Simulation
+ * 69, 323 (1997)): the truncation point @f$d@f$ minimizing the squared
+ * standard error @f$\sum_{i\ge d} (y_i - \bar y_d)^2 / (n - d)^2@f$ of the
+ * remaining mean, searched over the first half of the data.
+ */
+inline std::size_t mserTruncation(const std::vector<double>& y)
+{
+	// computed from suffix sums
+	const std::size_t n = y.size();
+	double s1 = 0, s2 = 0, best = 0;
+	std::size_t d = n;
+	for (std::size_t k = n; k > 0; --k)
+	{
+		const std::size_t i = k - 1;
+		s1 += y[i];
+		s2 += y[i] * y[i];
+		if (i > n / 2)
+			continue;
+		const double m = n - i;
+		const double mser = std::max(s2 - s1 * s1 / m, 0.0) / (m * m);
+		if (d == n || mser <= best)
+		{
+			best = mser;
+			d = i;
+		}
+	}
+	return d;
+}
+
+}
+
+#endif /* STATISTICS_H_ */
@@ -0,0 +1,395 @@
+/**
+ * @file ParameterSweep.h
+ * @date 18.10.2026
+ */
+
+#ifndef PARAMETERSWEEP_H_
+#define PARAMETERSWEEP_H_
+
+#include <largenet2/sim/sweep/SweepReplica.h>
+#include <largenet2/sim/seeds.h>
+#include <largenet2/sim/statistics.h>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <iostream>
+#include <string>
+#include <memory>
+#include <cmath>
+#include <stdexcept>
+
+namespace sim
+{
+namespace sweep
+{
+
+namespace detail
+{
+
+/**
+ * Observes a replica on a regular time grid: values hold the state that was
+ * valid at the requested time.
+ */
+class Observer
+{
+public:
+	Observer(SweepReplica& rep, unsigned int observables) :
+			rep_(rep), values_(observables), next_(0)
+	{
+	}
+	/// start observing at time 0 with the replica's current state
+	void restart()
+	{
+		rep_.observe(values_);
+		next_ = rep_.stopped() ? std::numeric_limits<double>::infinity() :
+				rep_.step();
+	}
+	/// observables at time @p t (non-decreasing between calls)
+	const std::vector<double>& at(const double t)
+	{
+		// the replica is already in the state starting at next_
+		while (next_ <= t)
+		{
+			rep_.observe(values_);
+			if (rep_.stopped())
+				next_ = std::numeric_limits<double>::infinity();
+			else
+				next_ += rep_.step();
+		}
+		return values_;
+	}
+private:
+	SweepReplica& rep_;
+	std::vector<double> values_;
+	double next_; ///< time at which the replica's current state began
+};
+
+}
+
+/// Result of a single sweep point
+struct SweepPoint
+{
+	double parameter;
+	bool upward; ///< point belongs to the branch of increasing index
+	bool stationary; ///< stationarity was detected within the time limit
+	double equilibrationTime; ///< time until stationarity was detected
+	std::vector<double> mean, error; ///< observable means and standard errors
+};
+
+/**
+ * Parameter sweep with warm starts.
+ *
+ * The swept parameter takes the given values one after another, and at each
+ * value the simulation is continued from the final configuration of the
+ * previous value instead of starting from scratch. Transients are thus
+ * short, and metastable branches are followed, so that sweeping up and down
+ * (setDirection()) reveals hysteresis.
+ *
+ * At each point, the observables are recorded every @p interval time units.
+ * Stationarity is detected by comparing the first and second halves of a
+ * sliding window of observations: the point is stationary once the means of
+ * all observables in both halves agree within tolerance() standard errors
+ * (estimated by batch means). Then samples() observations are taken, and
+ * their mean and batch-means standard error are stored.
+ *
+ * Each branch can be split into several segments (setSegments()) that run
+ * concurrently, each starting from a fresh replica; only the first point of a
+ * segment then needs a full transient. Segments of both branches are
+ * distributed over the worker threads. For hysteresis studies, use one
+ * segment per branch, so that both branches still run in parallel.
+ *
+ * Replicas are created by a factory, which is called with the segment index
+ * and a seed derived from the sweep seed, so results are independent of the
+ * number of threads.
+ */
+class ParameterSweep: public boost::noncopyable
+{
+public:
+	typedef boost::function<SweepReplica*(unsigned int, unsigned long)> ReplicaFactory;
+
+	/// Sweep directions
+	enum Direction
+	{
+		Up = 1, ///< in the given order of parameter values
+		Down = 2, ///< in reverse order
+		Both = Up | Down
+	};
+
+	/**
+	 * Constructor
+	 * @param factory creates replica @p i using random seed @p seed
+	 * @param observables number of observables
+	 * @param values parameter values, in the order of the upward branch
+	 * @param interval time between observations
+	 */
+	ParameterSweep(const ReplicaFactory& factory, unsigned int observables,
+			const std::vector<double>& values, double interval) :
+			factory_(factory), observables_(observables), values_(values),
+					interval_(interval), threads_(
+							boost::thread::hardware_concurrency()), seed_(0),
+					direction_(Up), segments_(1), samples_(1000), window_(
+							100), maxTime_(
+							std::numeric_limits<double>::infinity()),
+					tolerance_(2.0)
+	{
+		if (interval <= 0)
+			throw std::invalid_argument("Interval must be positive.");
+		if (values.empty() || observables == 0)
+			throw std::invalid_argument(
+					"Need parameter values and at least one observable.");
+		if (threads_ == 0)
+			threads_ = 1;
+	}
+
+	void setThreads(unsigned int n)
+	{
+		threads_ = n > 0 ? n : 1;
+	}
+	void setSeed(unsigned long seed)
+	{
+		seed_ = seed;
+	}
+	void setDirection(Direction d)
+	{
+		direction_ = d;
+	}
+	/// number of independently started segments per branch
+	void setSegments(unsigned int n)
+	{
+		segments_ = std::max(1u,
+				std::min(n, static_cast<unsigned int>(values_.size())));
+	}
+	/// number of observations per sweep point after stationarity
+	void setSamples(unsigned int n)
+	{
+		samples_ = std::max(n, 1u);
+	}
+	/// number of observations in each half of the stationarity test window
+	void setWindow(unsigned int n)
+	{
+		window_ = std::max(n, 10u);
+	}
+	/// maximum equilibration time per sweep point
+	void setMaxEquilibrationTime(double t)
+	{
+		maxTime_ = t;
+	}
+	/// number of standard errors by which window halves may differ
+	void setTolerance(double z)
+	{
+		tolerance_ = z;
+	}
+	double tolerance() const
+	{
+		return tolerance_;
+	}
+	unsigned int samples() const
+	{
+		return samples_;
+	}
+
+	/**
+	 * Run the sweep.
+	 * @return sweep points, the upward branch (if any) first, each branch in
+	 * the order in which it was swept
+	 */
+	const std::vector<SweepPoint>& run()
+	{
+		std::vector<bool> up;
+		if (direction_ & Up)
+			up.push_back(true);
+		if (direction_ & Down)
+			up.push_back(false);
+		if (up.empty())
+			throw std::invalid_argument("No sweep direction selected.");
+
+		const std::size_t n = values_.size();
+		results_.assign(up.size() * n, SweepPoint());
+		tasks_.clear();
+		for (unsigned int b = 0; b < up.size(); ++b)
+			for (unsigned int s = 0; s < segments_; ++s)
+			{
+				Task t;
+				t.upward = up[b];
+				t.begin = b * n + n * s / segments_;
+				t.end = b * n + n * (s + 1) / segments_;
+				tasks_.push_back(t);
+			}
+		nextTask_ = 0;
+		error_.clear();
+		const unsigned int workers = std::min<std::size_t>(threads_,
+				tasks_.size());
+		if (workers == 1)
+			work();
+		else
+		{
+			boost::thread_group pool;
+			for (unsigned int w = 0; w < workers; ++w)
+				pool.create_thread(boost::bind(&ParameterSweep::work, this));
+			pool.join_all();
+		}
+		if (!error_.empty())
+			throw std::runtime_error("Sweep failed: " + error_);
+		return results_;
+	}
+
+	const std::vector<SweepPoint>& results() const
+	{
+		return results_;
+	}
+
+	/**
+	 * Write the results as tab-separated columns, one sweep point per line:
+	 * parameter, direction (1 up, -1 down), stationarity flag, equilibration
+	 * time, and mean and standard error of each observable.
+	 */
+	void write(std::ostream& out, const std::string& commentChar = "#") const
+	{
+		out << commentChar << " p\tdir\tstationary\tteq";
+		for (unsigned int o = 0; o < observables_; ++o)
+			out << "\tmean" << o << "\terr" << o;
+		out << "\n";
+		for (std::vector<SweepPoint>::const_iterator p = results_.begin(); p
+				!= results_.end(); ++p)
+		{
+			out << p->parameter << "\t" << (p->upward ? 1 : -1) << "\t"
+					<< p->stationary << "\t" << p->equilibrationTime;
+			for (unsigned int o = 0; o < observables_; ++o)
+				out << "\t" << p->mean[o] << "\t" << p->error[o];
+			out << "\n";
+		}
+	}
+
+private:
+	/// contiguous range of result slots swept by one replica
+	struct Task
+	{
+		bool upward;
+		std::size_t begin, end;
+	};
+
+	void work()
+	{
+		while (true)
+		{
+			unsigned int k;
+			{
+				boost::mutex::scoped_lock lock(mutex_);
+				if (nextTask_ == tasks_.size() || !error_.empty())
+					return;
+				k = nextTask_++;
+			}
+			try
+			{
+				runTask(k);
+			} catch (std::exception& e)
+			{
+				boost::mutex::scoped_lock lock(mutex_);
+				if (error_.empty())
+					error_ = e.what();
+				return;
+			}
+		}
+	}
+
+	void runTask(const unsigned int k)
+	{
+		const Task& task = tasks_[k];
+		std::auto_ptr<SweepReplica> rep(factory_(k, deriveSeed(seed_, k)));
+		if (rep.get() == 0)
+			throw std::runtime_error("Replica factory returned null");
+		detail::Observer obs(*rep, observables_);
+		const std::size_t n = values_.size();
+		for (std::size_t i = task.begin; i < task.end; ++i)
+		{
+			const std::size_t j = i % n;
+			SweepPoint& p = results_[i];
+			p.parameter = values_[task.upward ? j : n - 1 - j];
+			p.upward = task.upward;
+			rep->setParameter(p.parameter);
+			obs.restart();
+			runPoint(obs, p);
+		}
+	}
+
+	void runPoint(detail::Observer& obs, SweepPoint& p) const
+	{
+		// observation series per observable
+		std::vector<std::vector<double> > x(observables_);
+		unsigned long g = 0;
+		p.stationary = false;
+		while (true)
+		{
+			record(obs.at(g * interval_), x);
+			++g;
+			if (x[0].size() == 2 * window_)
+			{
+				if (halvesAgree(x))
+				{
+					p.stationary = true;
+					break;
+				}
+				// slide the window by one half
+				for (unsigned int o = 0; o < observables_; ++o)
+					x[o].erase(x[o].begin(), x[o].begin() + window_);
+			}
+			if (g * interval_ > maxTime_)
+				break;
+		}
+		p.equilibrationTime = (g - 1) * interval_;
+
+		for (unsigned int o = 0; o < observables_; ++o)
+			x[o].clear();
+		for (unsigned int s = 0; s < samples_; ++s)
+			record(obs.at((g + s) * interval_), x);
+		p.mean.resize(observables_);
+		p.error.resize(observables_);
+		for (unsigned int o = 0; o < observables_; ++o)
+			batchMeans(x[o], 0, samples_, 10, p.mean[o], p.error[o]);
+	}
+
+	void record(const std::vector<double>& values,
+			std::vector<std::vector<double> >& x) const
+	{
+		for (unsigned int o = 0; o < observables_; ++o)
+			x[o].push_back(values[o]);
+	}
+
+	bool halvesAgree(const std::vector<std::vector<double> >& x) const
+	{
+		for (unsigned int o = 0; o < observables_; ++o)
+		{
+			double m1, e1, m2, e2;
+			batchMeans(x[o], 0, window_, 5, m1, e1);
+			batchMeans(x[o], window_, 2 * window_, 5, m2, e2);
+			if (std::fabs(m1 - m2) > tolerance_ * std::sqrt(e1 * e1 + e2 * e2))
+				return false;
+		}
+		return true;
+	}
+
+	ReplicaFactory factory_;
+	unsigned int observables_;
+	std::vector<double> values_;
+	double interval_;
+	unsigned int threads_;
+	unsigned long seed_;
+	Direction direction_;
+	unsigned int segments_, samples_, window_;
+	double maxTime_, tolerance_;
+	std::vector<Task> tasks_;
+	std::vector<SweepPoint> results_;
+	unsigned int nextTask_;
+	boost::mutex mutex_;
+	std::string error_;
+};
+
+}
+}
+
+#endif /* PARAMETERSWEEP_H_ */
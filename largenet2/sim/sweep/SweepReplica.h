@@ -0,0 +1,84 @@
+/**
+ * @file SweepReplica.h
+ * @date 18.10.2026
+ */
+
+#ifndef SWEEPREPLICA_H_
+#define SWEEPREPLICA_H_
+
+#include <boost/noncopyable.hpp>
+#include <vector>
+
+namespace sim
+{
+namespace sweep
+{
+
+/**
+ * A simulation whose parameter is changed while it runs, for use in a
+ * ParameterSweep.
+ *
+ * A SweepReplica owns its Graph, model, and random number generator, like an
+ * ensemble::Replica. The sweep calls setParameter() before each sweep point
+ * and then simply continues the simulation, so that each point starts from
+ * the final configuration of the previous one.
+ *
+ * Derived classes implement
+ * @code
+ * void doSetParameter(double p);             // change the swept parameter
+ * double doStep();                           // one model step, returns time increment
+ * bool doStopped() const;                    // true if no further change is possible
+ * void doObserve(std::vector<double>& values) const; // current observables
+ * @endcode
+ */
+class SweepReplica: public boost::noncopyable
+{
+public:
+	virtual ~SweepReplica()
+	{
+	}
+	/**
+	 * Set the swept parameter.
+	 */
+	void setParameter(double p)
+	{
+		doSetParameter(p);
+	}
+	/**
+	 * Perform one simulation step.
+	 * @return time increment
+	 */
+	double step()
+	{
+		return doStep();
+	}
+	/**
+	 * Check whether the simulation has stopped, i.e., has reached an
+	 * absorbing state.
+	 */
+	bool stopped() const
+	{
+		return doStopped();
+	}
+	/**
+	 * Write the current values of the observables into @p values.
+	 */
+	void observe(std::vector<double>& values) const
+	{
+		doObserve(values);
+	}
+
+private:
+	virtual void doSetParameter(double p) = 0;
+	virtual double doStep() = 0;
+	virtual bool doStopped() const
+	{
+		return false;
+	}
+	virtual void doObserve(std::vector<double>& values) const = 0;
+};
+
+}
+}
+
+#endif /* SWEEPREPLICA_H_ */
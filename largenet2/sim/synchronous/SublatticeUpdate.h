@@ -0,0 +1,299 @@
+/**
+ * @file SublatticeUpdate.h
+ * @date 18.10.2026
+ */
+
+#ifndef SUBLATTICEUPDATE_H_
+#define SUBLATTICEUPDATE_H_
+
+#include <largenet2/base/Graph.h>
+#include <largenet2/sim/seeds.h>
+#include <largenet2/sim/WorkerPool.h>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+namespace sim
+{
+namespace synchronous
+{
+
+/// Neighborhood of a site on a square lattice
+enum Neighborhood
+{
+	VonNeumann, ///< four nearest neighbors
+	Moore ///< eight nearest and next-nearest neighbors
+};
+
+/**
+ * Parallel asynchronous update of node states on a square lattice.
+ *
+ * The graph must have been created by one of the lattice generators in
+ * largenet2/generators/lattice.h (or equivalently), i.e. its nodes are the
+ * sites of a @p rows x @p cols lattice with the ID of site (i, j) being
+ * i * cols + j. Neighbors are computed from the lattice geometry instead of
+ * the graph's edges.
+ *
+ * The sites are colored such that no two neighbors share a color: a
+ * checkerboard (two colors) for the von Neumann neighborhood and a 2x2 block
+ * pattern (four colors) for the Moore neighborhood. A sweep updates the color
+ * classes one after another in random order, and each class in parallel.
+ * Since sites of one color do not influence each other, this is exactly
+ * equivalent to a sequential asynchronous (in-place) update in which every
+ * site is updated once per sweep, each update seeing the current states of
+ * all its neighbors. Each thread draws from its own random number stream.
+ * For a given seed, results are reproducible for a fixed number of threads.
+ *
+ * On periodic lattices, the coloring requires even numbers of rows and
+ * columns.
+ *
+ * The update rule is a functor with signature
+ * @code
+ * template<class RandomGen>
+ * largenet::node_state_t rule(largenet::node_id_t n,
+ *		SublatticeUpdate<Rule, RandomGen>::NeighborRange neighbors,
+ *		const std::vector<largenet::node_state_t>& states,
+ *		RandomGen& rng) const;
+ * @endcode
+ * returning the new state of site @p n. It is called concurrently from
+ * several threads and must not modify shared state.
+ *
+ * Example (voter model):
+ * @code
+ * struct Voter
+ * {
+ * 	template<class Range, class RandomGen>
+ * 	node_state_t operator()(node_id_t n, Range nb,
+ * 			const std::vector<node_state_t>& s, RandomGen& rng) const
+ * 	{
+ * 		return s[nb.first[rng.IntFromTo(0, int(nb.second - nb.first) - 1)]];
+ * 	}
+ * };
+ * vonNeumannLattice2DPeriodic(graph, 4096, 4096);
+ * SublatticeUpdate<Voter, RandomVariates<WELLEngine> > sim(graph, 4096, 4096,
+ *		VonNeumann, true, Voter());
+ * sim.sweep(100);
+ * @endcode
+ *
+ * @tparam Rule update rule
+ * @tparam RandomGen random number generator type, providing
+ * seed(unsigned long) and Uniform01()
+ */
+template<class Rule, class RandomGen>
+class SublatticeUpdate: public boost::noncopyable
+{
+public:
+	typedef std::pair<const largenet::node_id_t*, const largenet::node_id_t*> NeighborRange;
+
+	/**
+	 * Constructor
+	 * @param g lattice graph
+	 * @param rows number of lattice rows
+	 * @param cols number of lattice columns
+	 * @param nb neighborhood
+	 * @param periodic whether the lattice has periodic boundaries
+	 * @param rule update rule
+	 * @param threads number of worker threads (0 selects the number of
+	 * hardware threads)
+	 * @param seed random seed
+	 */
+	SublatticeUpdate(largenet::Graph& g, largenet::node_size_t rows,
+			largenet::node_size_t cols, Neighborhood nb, bool periodic,
+			const Rule& rule, unsigned int threads = 0, unsigned long seed = 0) :
+			g_(g), rule_(rule), rows_(rows), cols_(cols), nb_(nb),
+					periodic_(periodic), threads_(1), seed_(seed), sweeps_(0)
+	{
+		if (rows == 0 || cols == 0 || g.numberOfNodes() != rows * cols
+				|| g.maxNodeID() != rows * cols - 1)
+			throw std::invalid_argument(
+					"Graph is not a lattice of the given size.");
+		if (periodic && (rows % 2 != 0 || cols % 2 != 0))
+			throw std::invalid_argument(
+					"Periodic lattice needs even numbers of rows and columns.");
+		order_.seed(deriveSeed(seed_, 0));
+		setThreads(threads);
+		refresh();
+	}
+
+	/**
+	 * Set the number of worker threads. This re-seeds the per-thread random
+	 * number streams.
+	 */
+	void setThreads(unsigned int n)
+	{
+		if (n == 0)
+			n = boost::thread::hardware_concurrency();
+		threads_ = std::max(1u,
+				std::min(n > 0 ? n : 1, static_cast<unsigned int>(rows_)));
+		rngs_.resize(threads_);
+		for (unsigned int w = 0; w < threads_; ++w)
+			rngs_[w].seed(deriveSeed(seed_, w + 1));
+		if (!pool_ || pool_->size() != threads_)
+			pool_.reset(new WorkerPool(threads_));
+		changed_.assign(threads_, 0);
+	}
+	unsigned int threads() const
+	{
+		return threads_;
+	}
+
+	Rule& rule()
+	{
+		return rule_;
+	}
+
+	/// number of colors (independent sublattices)
+	unsigned int colors() const
+	{
+		return nb_ == VonNeumann ? 2 : 4;
+	}
+	/// color of site @p n
+	unsigned int color(largenet::node_id_t n) const
+	{
+		const largenet::node_size_t i = n / cols_, j = n % cols_;
+		return nb_ == VonNeumann ? (i + j) % 2 : 2 * (i % 2) + j % 2;
+	}
+
+	/**
+	 * Re-read the node states from the graph.
+	 */
+	void refresh()
+	{
+		g_.nodeStates(states_);
+	}
+
+	/**
+	 * Perform @p n sweeps and commit the new states to the graph.
+	 * @return number of site updates that changed the state
+	 */
+	largenet::node_size_t sweep(unsigned int n = 1)
+	{
+		colorOrder_.clear();
+		for (unsigned int k = 0; k < n; ++k)
+		{
+			const std::size_t first = colorOrder_.size();
+			for (unsigned int c = 0; c < colors(); ++c)
+				colorOrder_.push_back(c);
+			// random order of color classes (Fisher-Yates)
+			for (unsigned int c = colors() - 1; c > 0; --c)
+			{
+				const unsigned int r = static_cast<unsigned int>((c + 1)
+						* order_.Uniform01());
+				std::swap(colorOrder_[first + c],
+						colorOrder_[first + std::min(r, c)]);
+			}
+		}
+
+		pool_->run(boost::bind(&SublatticeUpdate::work, this, _1));
+		sweeps_ += n;
+		largenet::node_size_t total = 0;
+		for (unsigned int w = 0; w < threads_; ++w)
+			total += changed_[w];
+		if (total > 0)
+			g_.setNodeStates(states_);
+		return total;
+	}
+
+	/// number of sweeps performed
+	unsigned long sweeps() const
+	{
+		return sweeps_;
+	}
+
+	/**
+	 * Current node states, indexed by node ID.
+	 */
+	const std::vector<largenet::node_state_t>& states() const
+	{
+		return states_;
+	}
+
+private:
+	void work(unsigned int w)
+	{
+		const largenet::node_size_t rowBegin = rows_ * w / threads_,
+				rowEnd = rows_ * (w + 1) / threads_;
+		RandomGen& rng = rngs_[w];
+		largenet::node_id_t nb[8];
+		largenet::node_size_t c = 0;
+		for (std::size_t k = 0; k < colorOrder_.size(); ++k)
+		{
+			const unsigned int color = colorOrder_[k];
+			for (largenet::node_size_t i = rowBegin; i < rowEnd; ++i)
+			{
+				largenet::node_size_t j0;
+				if (nb_ == VonNeumann)
+					j0 = (i + color) % 2;
+				else if (i % 2 == color / 2)
+					j0 = color % 2;
+				else
+					continue;
+				for (largenet::node_size_t j = j0; j < cols_; j += 2)
+				{
+					const largenet::node_id_t n = i * cols_ + j;
+					const unsigned int deg = neighbors(i, j, nb);
+					const largenet::node_state_t s = rule_(n,
+							NeighborRange(nb, nb + deg), states_, rng);
+					if (s != states_[n])
+					{
+						states_[n] = s;
+						++c;
+					}
+				}
+			}
+			// all sites of this color must be done before the next color
+			if (threads_ > 1)
+				pool_->barrier().wait();
+		}
+		changed_[w] = c;
+	}
+
+	/// collect the neighbors of site (i, j) in @p nb, return their number
+	unsigned int neighbors(const largenet::node_size_t i,
+			const largenet::node_size_t j, largenet::node_id_t* nb) const
+	{
+		static const int di[8] = { 0, 0, -1, 1, -1, -1, 1, 1 };
+		static const int dj[8] = { -1, 1, 0, 0, -1, 1, -1, 1 };
+		const unsigned int m = nb_ == VonNeumann ? 4 : 8;
+		unsigned int deg = 0;
+		for (unsigned int k = 0; k < m; ++k)
+		{
+			long r = static_cast<long>(i) + di[k], c = static_cast<long>(j)
+					+ dj[k];
+			if (periodic_)
+			{
+				r = (r + rows_) % rows_;
+				c = (c + cols_) % cols_;
+			}
+			else if (r < 0 || c < 0 || r >= static_cast<long>(rows_) || c
+					>= static_cast<long>(cols_))
+				continue;
+			nb[deg++] = r * cols_ + c;
+		}
+		return deg;
+	}
+
+	largenet::Graph& g_;
+	Rule rule_;
+	largenet::node_size_t rows_, cols_;
+	Neighborhood nb_;
+	bool periodic_;
+	unsigned int threads_;
+	unsigned long seed_, sweeps_;
+	RandomGen order_; ///< generator for the order of color classes
+	std::vector<RandomGen> rngs_; ///< per-thread generators
+	std::vector<unsigned int> colorOrder_; ///< color classes to update in turn
+	std::vector<largenet::node_state_t> states_;
+	boost::scoped_ptr<WorkerPool> pool_; ///< one worker per band of rows
+	std::vector<largenet::node_size_t> changed_; ///< state changes per worker
+};
+
+}
+}
+
+#endif /* SUBLATTICEUPDATE_H_ */
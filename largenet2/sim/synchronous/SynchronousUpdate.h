@@ -0,0 +1,229 @@
+/**
+ * @file SynchronousUpdate.h
+ * @date 18.10.2026
+ */
+
+#ifndef SYNCHRONOUSUPDATE_H_
+#define SYNCHRONOUSUPDATE_H_
+
+#include <largenet2/base/Graph.h>
+#include <largenet2/base/Node.h>
+#include <largenet2/base/Edge.h>
+#include <largenet2/sim/WorkerPool.h>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace sim
+{
+namespace synchronous
+{
+
+/**
+ * Synchronous (cellular automaton-like) update of all node states.
+ *
+ * In each step, every node computes its new state from the previous states
+ * of itself and its neighbors. The previous and new states are kept in two
+ * buffers indexed by node ID, outside the Graph's state bookkeeping, and the
+ * update rule is evaluated in parallel on chunks of nodes by a WorkerPool
+ * that persists across steps. Afterwards, the
+ * new states are committed to the Graph in a single Graph::setNodeStates()
+ * call, which rebuilds the node state categories at once instead of moving
+ * nodes one by one.
+ *
+ * The neighbors of a node are those whose state can influence it: the
+ * sources of its incoming directed edges and its undirected neighbors. They
+ * are cached in a compact array on construction, so the topology must not
+ * change while the engine is in use (call rebuild() otherwise). Node states
+ * changed outside the engine must be announced by calling refresh().
+ *
+ * The update rule is a functor with signature
+ * @code
+ * largenet::node_state_t rule(largenet::node_id_t n,
+ *		SynchronousUpdate<Rule>::NeighborRange neighbors,
+ *		const std::vector<largenet::node_state_t>& states,
+ *		unsigned int worker) const;
+ * @endcode
+ * where @p states are the previous states and @p worker is the index of the
+ * calling thread (e.g. to select a per-thread random number generator). The
+ * rule is called concurrently from several threads and must therefore not
+ * modify shared state except per worker.
+ *
+ * Example (majority rule on a graph with two node states):
+ * @code
+ * struct Majority
+ * {
+ * 	node_state_t operator()(node_id_t n, NeighborRange nb,
+ * 			const std::vector<node_state_t>& s, unsigned int) const
+ * 	{
+ * 		int up = 0;
+ * 		for (const node_id_t* i = nb.first; i != nb.second; ++i)
+ * 			up += s[*i] == 1 ? 1 : -1;
+ * 		return up > 0 ? 1 : (up < 0 ? 0 : s[n]);
+ * 	}
+ * };
+ * SynchronousUpdate<Majority> sync(graph, Majority(), 4);
+ * sync.step();
+ * @endcode
+ */
+template<class Rule>
+class SynchronousUpdate: public boost::noncopyable
+{
+public:
+	typedef std::pair<const largenet::node_id_t*, const largenet::node_id_t*> NeighborRange;
+
+	/**
+	 * Constructor
+	 * @param g graph to update
+	 * @param rule update rule
+	 * @param threads number of worker threads (0 selects the number of
+	 * hardware threads)
+	 */
+	SynchronousUpdate(largenet::Graph& g, const Rule& rule,
+			unsigned int threads = 0) :
+			g_(g), rule_(rule), threads_(1)
+	{
+		setThreads(threads);
+		rebuild();
+	}
+
+	void setThreads(unsigned int n)
+	{
+		if (n == 0)
+			n = boost::thread::hardware_concurrency();
+		threads_ = n > 0 ? n : 1;
+		makeChunks();
+	}
+	unsigned int threads() const
+	{
+		return threads_;
+	}
+
+	Rule& rule()
+	{
+		return rule_;
+	}
+
+	/**
+	 * Re-read the network topology and node states from the graph.
+	 */
+	void rebuild()
+	{
+		ids_.clear();
+		offsets_.clear();
+		neighbors_.clear();
+		largenet::Graph::NodeIteratorRange nodes = g_.nodes();
+		for (largenet::Graph::NodeIterator n = nodes.first; n != nodes.second; ++n)
+		{
+			ids_.push_back(n.id());
+			offsets_.push_back(neighbors_.size());
+			largenet::Node::edge_iterator_range in = n->inEdges();
+			for (largenet::Node::edge_iterator e = in.first; e != in.second; ++e)
+				neighbors_.push_back((*e)->source()->id());
+			largenet::Node::edge_iterator_range un = n->undirectedEdges();
+			for (largenet::Node::edge_iterator e = un.first; e != un.second; ++e)
+				neighbors_.push_back((*e)->opposite(*n)->id());
+		}
+		offsets_.push_back(neighbors_.size());
+		makeChunks();
+		refresh();
+	}
+
+	/**
+	 * Re-read the node states from the graph.
+	 */
+	void refresh()
+	{
+		g_.nodeStates(states_);
+		next_ = states_;
+	}
+
+	/**
+	 * Update all nodes synchronously and commit the new states to the graph.
+	 * @return number of nodes that changed their state
+	 */
+	largenet::node_size_t step()
+	{
+		pool_->run(boost::bind(&SynchronousUpdate::update, this, _1));
+		largenet::node_size_t total = 0;
+		for (unsigned int w = 0; w < changed_.size(); ++w)
+			total += changed_[w];
+		if (total > 0)
+		{
+			// next_ keeps the previous states, all of which are overwritten
+			// in the next step
+			states_.swap(next_);
+			g_.setNodeStates(states_);
+		}
+		return total;
+	}
+
+	/**
+	 * Current node states, indexed by node ID.
+	 */
+	const std::vector<largenet::node_state_t>& states() const
+	{
+		return states_;
+	}
+
+private:
+	void update(unsigned int worker)
+	{
+		largenet::node_size_t c = 0;
+		for (std::size_t i = chunks_[worker]; i < chunks_[worker + 1]; ++i)
+		{
+			const largenet::node_id_t n = ids_[i];
+			const largenet::node_id_t* nb =
+					neighbors_.empty() ? 0 : &neighbors_[0];
+			const largenet::node_state_t s = rule_(n,
+					NeighborRange(nb + offsets_[i], nb + offsets_[i + 1]),
+					states_, worker);
+			if (s != states_[n])
+				++c;
+			next_[n] = s;
+		}
+		changed_[worker] = c;
+	}
+
+	/// split nodes into chunks of roughly equal work (nodes plus neighbors)
+	void makeChunks()
+	{
+		chunks_.assign(1, 0);
+		const std::size_t n = ids_.size();
+		const unsigned int parts = std::max(1u,
+				std::min(threads_, static_cast<unsigned int>(n)));
+		const double work = n + static_cast<double>(neighbors_.size());
+		std::size_t i = 0;
+		for (unsigned int p = 1; p < parts; ++p)
+		{
+			const double target = work * p / parts;
+			while (i < n && i + static_cast<double>(offsets_[i]) < target)
+				++i;
+			chunks_.push_back(i);
+		}
+		chunks_.push_back(n);
+		if (!pool_ || pool_->size() != parts)
+			pool_.reset(new WorkerPool(parts));
+		changed_.assign(parts, 0);
+	}
+
+	largenet::Graph& g_;
+	Rule rule_;
+	unsigned int threads_;
+	std::vector<largenet::node_id_t> ids_; ///< node IDs in update order
+	std::vector<std::size_t> offsets_; ///< start of each node's neighbors in neighbors_
+	std::vector<largenet::node_id_t> neighbors_;
+	std::vector<std::size_t> chunks_; ///< chunk boundaries in ids_
+	std::vector<largenet::node_state_t> states_, next_;
+	boost::scoped_ptr<WorkerPool> pool_; ///< one worker per chunk
+	std::vector<largenet::node_size_t> changed_; ///< state changes per chunk
+};
+
+}
+}
+
+#endif /* SYNCHRONOUSUPDATE_H_ */
@@ -0,0 +1,133 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2.h>
+#include <largenet2/measures/DegreeHistogram.h>
+#include <largenet2/sim/output/DegDistOutput.h>
+#include <sstream>
+#include <string>
+#include "../sim/test_rng.h"
+
+using namespace largenet;
+
+namespace
+{
+
+template<class _Dist>
+void checkDistribution(const measures::degree_dist_t& h, const _Dist& d)
+{
+	BOOST_CHECK_EQUAL(h.size() - 1, d.maxDegree());
+	for (degree_t k = 0; k < h.size(); ++k)
+		BOOST_CHECK_EQUAL(h[k], d[k]);
+}
+
+void checkHistogram(const Graph& g, const measures::DegreeHistogram& h)
+{
+	typedef measures::DegreeHistogram H;
+	checkDistribution(h.distribution(H::IN_DEGREE),
+			measures::InDegreeDistribution(g));
+	checkDistribution(h.distribution(H::OUT_DEGREE),
+			measures::OutDegreeDistribution(g));
+	checkDistribution(h.distribution(H::UNDIRECTED_DEGREE),
+			measures::UndirectedDegreeDistribution(g));
+	for (node_state_t s = 0; s < g.numberOfNodeStates(); ++s)
+	{
+		if (g.numberOfNodes(s) == 0)
+		{
+			// a scanned distribution is empty, the histogram keeps bin 0
+			BOOST_CHECK_EQUAL(h.count(H::IN_DEGREE, s, 0), 0);
+			continue;
+		}
+		checkDistribution(h.distribution(H::IN_DEGREE, s),
+				measures::InDegreeDistribution(g, s));
+		checkDistribution(h.distribution(H::OUT_DEGREE, s),
+				measures::OutDegreeDistribution(g, s));
+		checkDistribution(h.distribution(H::UNDIRECTED_DEGREE, s),
+				measures::UndirectedDegreeDistribution(g, s));
+	}
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( degree_histogram )
+
+BOOST_AUTO_TEST_CASE( random_changes )
+{
+	TestRng rng(8);
+	const unsigned int N = 30;
+	Graph g(3, 1);
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(rng.IntFromTo(0u, 2u));
+	measures::DegreeHistogram h(g);
+	for (unsigned int step = 0; step < 2000; ++step)
+	{
+		const node_id_t u = rng.IntFromTo<node_id_t>(0, N - 1), v =
+				rng.IntFromTo<node_id_t>(0, N - 1);
+		const double r = rng.Uniform01();
+		if (r < 0.3)
+		{
+			if (!g.adjacent(u, v))
+				g.addEdge(u, v, false);
+		}
+		else if (r < 0.6)
+		{
+			if (!g.adjacent(u, v))
+				g.addEdge(u, v, true);
+		}
+		else if (r < 0.8)
+		{
+			if (g.numberOfEdges() > 0)
+				g.removeEdge(g.randomEdge(rng)->id());
+		}
+		else
+			g.setNodeState(u, rng.IntFromTo(0u, 2u));
+		if (step % 100 == 0)
+			checkHistogram(g, h);
+	}
+	checkHistogram(g, h);
+
+	g.removeNode(5);
+	g.removeNode(7);
+	checkHistogram(g, h);
+	g.addNode(1);
+	g.addEdge(g.maxNodeID(), 0, true);
+	checkHistogram(g, h);
+
+	std::vector<node_state_t> states;
+	g.nodeStates(states);
+	for (unsigned int i = 0; i < states.size(); ++i)
+		states[i] = (states[i] + 2) % 3;
+	g.setNodeStates(states);
+	checkHistogram(g, h);
+
+	g.clear();
+	checkHistogram(g, h);
+}
+
+BOOST_AUTO_TEST_CASE( output_matches_scan )
+{
+	TestRng rng(4);
+	Graph g(2, 1);
+	for (unsigned int i = 0; i < 20; ++i)
+		g.addNode(i % 2);
+	for (unsigned int i = 0; i < 40; ++i)
+	{
+		const node_id_t u = rng.IntFromTo<node_id_t>(0, 19), v =
+				rng.IntFromTo<node_id_t>(0, 19);
+		if (u != v && !g.adjacent(u, v))
+			g.addEdge(u, v, i % 2 == 0);
+	}
+	measures::DegreeHistogram h(g);
+	std::ostringstream a, b, c, d, e, f;
+	sim::output::DegDistOutput<Graph>(a, g, 1.0).output(0);
+	sim::output::DegDistOutput<Graph>(b, g, 1.0, &h).output(0);
+	BOOST_CHECK_EQUAL(a.str(), b.str());
+	sim::output::StatelessDegDistOutput<Graph>(c, g, 1.0).output(0);
+	sim::output::StatelessDegDistOutput<Graph>(d, g, 1.0, &h).output(0);
+	BOOST_CHECK_EQUAL(c.str(), d.str());
+	sim::output::UndirectedDegDistOutput<Graph>(e, g, 1.0).output(0);
+	sim::output::UndirectedDegDistOutput<Graph>(f, g, 1.0, &h).output(0);
+	BOOST_CHECK_EQUAL(e.str(), f.str());
+	BOOST_CHECK(!a.str().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,81 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2.h>
+#include <largenet2/base/GraphSnapshot.h>
+#include <largenet2/StateConsistencyListener.h>
+#include <memory>
+#include <vector>
+
+using namespace largenet;
+
+namespace
+{
+struct SumState
+{
+	edge_state_t operator()(node_state_t a, node_state_t b) const
+	{
+		return a + b;
+	}
+};
+}
+
+BOOST_AUTO_TEST_SUITE( graph_snapshot )
+
+BOOST_AUTO_TEST_CASE( restore_node_states )
+{
+	Graph g(3, 1);
+	for (unsigned int i = 0; i < 10; ++i)
+		g.addNode(i % 3);
+	g.addEdge(0, 1, false);
+	GraphSnapshot snap(g);
+	BOOST_CHECK(!snap.empty());
+	BOOST_CHECK(!snap.hasTopology());
+	BOOST_CHECK_EQUAL(snap.numberOfNodes(0), 4);
+
+	for (unsigned int i = 0; i < 10; ++i)
+		g.setNodeState(i, 2);
+	snap.restore(g);
+	for (unsigned int i = 0; i < 10; ++i)
+		BOOST_CHECK_EQUAL(g.nodeState(i), i % 3);
+	BOOST_CHECK_EQUAL(g.numberOfNodes(0), 4);
+	BOOST_CHECK_EQUAL(g.numberOfEdges(), 1);
+
+	g.addNode();
+	BOOST_CHECK_THROW(snap.restore(g), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE( restore_topology )
+{
+	Graph g(2, 3);
+	StateConsistencyListener<SumState> scl(std::auto_ptr<SumState>(new SumState));
+	g.addGraphListener(&scl);
+	for (unsigned int i = 0; i < 6; ++i)
+		g.addNode(i < 2);
+	g.addEdge(0, 1, false);
+	g.addEdge(1, 2, false);
+	g.addEdge(3, 4, true);
+	GraphSnapshot snap(g, true);
+	BOOST_CHECK(snap.hasTopology());
+
+	// rewire and change states
+	g.removeEdge(0);
+	g.addEdge(0, 5, false);
+	g.addEdge(2, 3, true);
+	g.setNodeState(1, 0);
+	g.setNodeState(4, 1);
+
+	snap.restore(g);
+	BOOST_CHECK_EQUAL(g.numberOfEdges(), 3);
+	BOOST_CHECK(g.adjacent(0, 1));
+	BOOST_CHECK(g.adjacent(1, 2));
+	BOOST_CHECK(g.isEdge(3, 4));
+	BOOST_CHECK(!g.isEdge(4, 3));
+	BOOST_CHECK(!g.adjacent(0, 5));
+	BOOST_CHECK(!g.adjacent(2, 3));
+	BOOST_CHECK_EQUAL(g.numberOfNodes(1), 2);
+	BOOST_CHECK_EQUAL(g.numberOfEdges(2), 1);
+	BOOST_CHECK_EQUAL(g.numberOfEdges(1), 1);
+	BOOST_CHECK_EQUAL(g.numberOfEdges(0), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
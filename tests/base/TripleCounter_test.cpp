@@ -0,0 +1,108 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2.h>
+#include <largenet2/measures/TripleCounter.h>
+#include <largenet2/measures/counts.h>
+#include <stdexcept>
+#include "../sim/test_rng.h"
+
+using namespace largenet;
+
+namespace
+{
+
+void checkCounts(const Graph& g, const measures::TripleCounter& tc)
+{
+	for (motifs::TripleMotifSet::const_iterator t = tc.motifs().begin(); t
+			!= tc.motifs().end(); ++t)
+		BOOST_CHECK_EQUAL(tc.count(*t), measures::triples(g, *t));
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( triple_counter )
+
+BOOST_AUTO_TEST_CASE( star )
+{
+	Graph g(2, 1);
+	g.addNode(0);
+	for (unsigned int i = 0; i < 4; ++i)
+		g.addNode(i % 2);
+	for (node_id_t i = 1; i <= 4; ++i)
+		g.addEdge(0, i, false);
+	measures::TripleCounter tc(g);
+	BOOST_CHECK_EQUAL(tc.motifs().size(), 6);
+	// leaves in states 0, 1, 0, 1 around a center in state 0
+	BOOST_CHECK_EQUAL(tc.count(motifs::TripleMotif(0, 0, 0,
+							motifs::TripleMotif::NO_DIR)), 1);
+	BOOST_CHECK_EQUAL(tc.count(motifs::TripleMotif(1, 0, 0,
+							motifs::TripleMotif::NO_DIR)), 4);
+	BOOST_CHECK_EQUAL(tc.count(motifs::TripleMotif(1, 0, 1,
+							motifs::TripleMotif::NO_DIR)), 1);
+	g.setNodeState(0, 1);
+	BOOST_CHECK_EQUAL(tc.count(motifs::TripleMotif(0, 1, 1,
+							motifs::TripleMotif::NO_DIR)), 4);
+	checkCounts(g, tc);
+	BOOST_CHECK_THROW(tc.count(motifs::TripleMotif(0, 1, 1,
+							motifs::TripleMotif::LCR)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE( random_changes )
+{
+	TestRng rng(21);
+	const unsigned int N = 40;
+	Graph g(3, 1);
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(rng.IntFromTo(0u, 2u));
+	measures::TripleCounter tc(g);
+	for (unsigned int step = 0; step < 2000; ++step)
+	{
+		const node_id_t u = rng.IntFromTo<node_id_t>(0, N - 1), v =
+				rng.IntFromTo<node_id_t>(0, N - 1);
+		const double r = rng.Uniform01();
+		if (r < 0.4)
+		{
+			if (u != v && !g.adjacent(u, v))
+				g.addEdge(u, v, false);
+		}
+		else if (r < 0.6)
+		{
+			if (g.numberOfEdges() > 0)
+				g.removeEdge(g.randomEdge(rng)->id());
+		}
+		else if (r < 0.65)
+		{
+			// directed edges do not form undirected triples
+			if (u != v && !g.adjacent(u, v))
+				g.addEdge(u, v, true);
+		}
+		else
+			g.setNodeState(u, rng.IntFromTo(0u, 2u));
+		if (step % 100 == 0)
+			checkCounts(g, tc);
+	}
+	checkCounts(g, tc);
+
+	// few changes are applied node by node, many by recounting
+	std::vector<node_state_t> states;
+	for (unsigned int round = 0; round < 20; ++round)
+	{
+		g.nodeStates(states);
+		for (unsigned int i = 0; i < 8; ++i)
+			states[rng.IntFromTo<node_id_t>(0, N - 1)] = rng.IntFromTo(0u, 2u);
+		g.setNodeStates(states);
+		checkCounts(g, tc);
+	}
+	g.nodeStates(states);
+	for (unsigned int i = 0; i < states.size(); ++i)
+		states[i] = (states[i] + 1) % 3;
+	g.setNodeStates(states);
+	checkCounts(g, tc);
+
+	g.removeNode(3);
+	checkCounts(g, tc);
+	g.clear();
+	checkCounts(g, tc);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -96,6 +96,52 @@ BOOST_AUTO_TEST_CASE( ptr_repo_modification )
 	BOOST_CHECK_EQUAL(10, c2.size());
 }
 
+BOOST_AUTO_TEST_CASE( ptr_repo_set_categories )
+{
+	ptr_rep_type c(4, 100);
+	ptr_fillRepo(c, 60);
+	// remove some items to have gaps in the IDs
+	c.erase(repo::id_t(5));
+	c.erase(repo::id_t(17));
+
+	std::vector<repo::category_t> cats(c.maxID() + 1, 0);
+	for (unsigned int i = 0; i < cats.size(); ++i)
+		cats[i] = (i * 7) % 3;
+	c.setCategories(cats);
+
+	BOOST_CHECK_EQUAL(58, c.size());
+	unsigned int total = 0;
+	for (repo::category_t cat = 0; cat < c.numberOfCategories(); ++cat)
+	{
+		unsigned int n = 0;
+		for (ptr_rep_type::CategoryIterator it = c.begin(cat); it != c.end(cat); ++it, ++n)
+			BOOST_CHECK_EQUAL(cats[it.id()], cat);
+		BOOST_CHECK_EQUAL(n, c.count(cat));
+		total += n;
+	}
+	BOOST_CHECK_EQUAL(total, c.size());
+	for (repo::id_t i = 0; i <= c.maxID(); ++i)
+		if (c.valid(i))
+		{
+			BOOST_CHECK_EQUAL(cats[i], c.category(i));
+			BOOST_CHECK_EQUAL(val_type(i + 1), c[i]);
+		}
+
+	std::vector<repo::category_t> read;
+	c.categories(read);
+	BOOST_REQUIRE_EQUAL(read.size(), c.maxID() + 1);
+	for (repo::id_t i = 0; i <= c.maxID(); ++i)
+		if (c.valid(i))
+			BOOST_CHECK_EQUAL(read[i], cats[i]);
+
+	// single category changes still work afterwards
+	c.setCategory(repo::id_t(0), 3);
+	BOOST_CHECK_EQUAL(3, c.category(repo::id_t(0)));
+	BOOST_CHECK_EQUAL(1, c.count(3));
+	c << new val_type(99);
+	BOOST_CHECK_EQUAL(59, c.size());
+}
+
 BOOST_AUTO_TEST_CASE( ptr_repo_memory )
 {
 	// resize repository
@@ -8,6 +8,7 @@
 #include <boost/concept_check.hpp>
 #include <largenet2/boost/largenet2_boost.h>
 #include <largenet2/boost/property_graph.h>
+#include <largenet2/boost/mapped_graph_boost.h>
 
 using namespace largenet;
 
@@ -22,5 +23,9 @@ int main(int argc, char **argv)
 
 	BOOST_CONCEPT_ASSERT(
 			(boost::PropertyGraphConcept<Graph, boost::graph_traits<Graph>::vertex_descriptor, boost::vertex_index_t>));
+
+	BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<io::MappedGraph>));
+	BOOST_CONCEPT_ASSERT((boost::BidirectionalGraphConcept<io::MappedGraph>));
+	BOOST_CONCEPT_ASSERT((boost::AdjacencyGraphConcept<io::MappedGraph>));
 	return 0;
 }
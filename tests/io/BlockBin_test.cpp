@@ -0,0 +1,190 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2.h>
+#include <largenet2/io/BlockBinWriter.h>
+#include <largenet2/io/BlockBinReader.h>
+#include <largenet2/io/BinWriter.h>
+#include <largenet2/io/BinReader.h>
+#include <boost/scoped_ptr.hpp>
+#include <boost/foreach.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+using namespace largenet;
+
+namespace
+{
+
+/// graph with gaps in the node IDs, edge states and mixed directedness
+void build(Graph& g)
+{
+	for (unsigned int i = 0; i < 8; ++i)
+		g.addNode(i % 3);
+	g.addEdge(0, 1, true);
+	g.addEdge(1, 2, false);
+	g.addEdge(2, 7, true);
+	g.addEdge(6, 6, true);
+	g.addEdge(4, 7, false);
+	g.setEdgeState(g.addEdge(7, 0, true), 1);
+	g.removeNode(3);
+	g.removeNode(5);
+}
+
+/// source, target, state, directedness
+typedef boost::tuple<node_id_t, node_id_t, edge_state_t, bool> EdgeRecord;
+
+/**
+ * Sorted edge list of @p g, with node @p n renamed to @p label[n] and the
+ * ends of undirected edges ordered.
+ */
+std::vector<EdgeRecord> edgeList(const Graph& g,
+		const std::vector<node_id_t>& label)
+{
+	std::vector<EdgeRecord> edges;
+	BOOST_FOREACH(const Edge& e, g.edges())
+	{
+		node_id_t s = label[e.source()->id()], t = label[e.target()->id()];
+		if (!e.isDirected() && t < s)
+			std::swap(s, t);
+		edges.push_back(EdgeRecord(s, t, g.edgeState(e.id()), e.isDirected()));
+	}
+	std::sort(edges.begin(), edges.end());
+	return edges;
+}
+
+/**
+ * Check that @p h was read from @p g, with the nodes of @p g numbered in the
+ * order in which the writer visits them.
+ */
+void checkSame(const Graph& g, const Graph& h)
+{
+	BOOST_REQUIRE_EQUAL(h.numberOfNodes(), g.numberOfNodes());
+	BOOST_REQUIRE_EQUAL(h.numberOfEdges(), g.numberOfEdges());
+	for (node_state_t s = 0; s < g.numberOfNodeStates(); ++s)
+		BOOST_CHECK_EQUAL(h.numberOfNodes(s), g.numberOfNodes(s));
+	for (edge_state_t s = 0; s < g.numberOfEdgeStates(); ++s)
+		BOOST_CHECK_EQUAL(h.numberOfEdges(s), g.numberOfEdges(s));
+	unsigned int directed = 0, undirected = 0;
+	BOOST_FOREACH(const Edge& e, h.edges())
+	{
+		if (e.isDirected())
+			++directed;
+		else
+			++undirected;
+	}
+	BOOST_CHECK_EQUAL(directed, 4);
+	BOOST_CHECK_EQUAL(undirected, 2);
+
+	std::vector<node_id_t> label(g.maxNodeID() + 1), same(h.maxNodeID() + 1);
+	node_id_t k = 0;
+	BOOST_FOREACH(const Node& n, g.nodes())
+	{
+		BOOST_CHECK_EQUAL(h.nodeState(k), g.nodeState(n.id()));
+		label[n.id()] = k++;
+	}
+	for (node_id_t i = 0; i < same.size(); ++i)
+		same[i] = i;
+	BOOST_CHECK(edgeList(h, same) == edgeList(g, label));
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( block_bin )
+
+BOOST_AUTO_TEST_CASE( round_trip )
+{
+	Graph g(3, 2);
+	build(g);
+	io::BlockBinWriter writer(true, 2);
+	std::stringstream s;
+	writer.write(g, s);
+
+	io::BlockBinReader reader;
+	boost::scoped_ptr<Graph> h(reader.createFromStream(s));
+	BOOST_CHECK_EQUAL(h->numberOfNodeStates(), g.numberOfNodeStates());
+	checkSame(g, *h);
+
+	Graph filled(4, 2);
+	filled.addNode();
+	s.clear();
+	s.seekg(0);
+	BOOST_CHECK_EQUAL(reader.createFromStream(s, filled), &filled);
+	checkSame(g, filled);
+
+	Graph small(2, 2);
+	s.clear();
+	s.seekg(0);
+	BOOST_CHECK_THROW(reader.createFromStream(s, small), std::runtime_error);
+
+	Graph empty(1, 1);
+	std::stringstream e;
+	io::BlockBinWriter(false).write(empty, e);
+	h.reset(reader.createFromStream(e));
+	BOOST_CHECK_EQUAL(h->numberOfNodes(), 0);
+}
+
+BOOST_AUTO_TEST_CASE( corrupted_and_truncated_data )
+{
+	Graph g(3, 2);
+	build(g);
+	std::ostringstream s;
+	io::BlockBinWriter().write(g, s);
+	io::BlockBinReader reader;
+
+	std::string data = s.str();
+	data[data.size() - 10] ^= 0x10;
+	std::istringstream corrupt(data);
+	BOOST_CHECK_THROW(reader.createFromStream(corrupt), std::runtime_error);
+
+	std::istringstream truncated(s.str().substr(0, s.str().size() - 3));
+	BOOST_CHECK_THROW(reader.createFromStream(truncated), std::runtime_error);
+
+	std::istringstream garbage("this is not a graph at all, but long enough for a header");
+	BOOST_CHECK_THROW(reader.createFromStream(garbage), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( other_byte_order )
+{
+	Graph g(3, 2);
+	build(g);
+	std::ostringstream s;
+	io::BlockBinWriter(false).write(g, s);
+	std::string data = s.str();
+
+	// convert to the other byte order: header fields, then all 32 bit words
+	// of the single node and edge block except the directedness bytes
+	const std::size_t fields[][2] = { { 4, 2 }, { 10, 2 }, { 12, 4 },
+			{ 16, 4 }, { 20, 4 }, { 24, 4 }, { 28, 8 }, { 36, 8 }, { 44, 8 } };
+	for (unsigned int i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i)
+		std::reverse(data.begin() + fields[i][0], data.begin() + fields[i][0]
+				+ fields[i][1]);
+	const std::size_t N = g.numberOfNodes(), L = g.numberOfEdges();
+	for (std::size_t p = 52; p < 52 + 8 * N + 12 * L; p += 4)
+		std::reverse(data.begin() + p, data.begin() + p + 4);
+
+	std::istringstream in(data);
+	boost::scoped_ptr<Graph> h(io::BlockBinReader().createFromStream(in));
+	checkSame(g, *h);
+}
+
+BOOST_AUTO_TEST_CASE( bin_reader_fills_graph )
+{
+	Graph g(3, 2);
+	build(g);
+	std::stringstream s;
+	io::BinWriter().write(g, s);
+	Graph h(3, 2);
+	h.addNode();
+	BOOST_CHECK_EQUAL(io::BinReader().createFromStream(s, h), &h);
+	BOOST_CHECK_EQUAL(h.numberOfNodes(), g.numberOfNodes());
+	BOOST_CHECK_EQUAL(h.numberOfEdges(), g.numberOfEdges());
+	BOOST_CHECK_EQUAL(h.numberOfEdges(1), 1);
+	BOOST_CHECK_EQUAL(h.numberOfNodes(2), g.numberOfNodes(2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
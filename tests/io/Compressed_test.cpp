@@ -0,0 +1,192 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2.h>
+#include <largenet2/io/CompressedWriter.h>
+#include <largenet2/io/CompressedReader.h>
+#include <largenet2/io/CompressedStreamWriter.h>
+#include <largenet2/io/CompressedStreamReader.h>
+#include <largenet2/io/BinWriter.h>
+#include <boost/scoped_ptr.hpp>
+#include <boost/foreach.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include "../sim/test_rng.h"
+
+using namespace largenet;
+
+namespace
+{
+
+/// ring lattice with random shortcuts, undirected edges and removed nodes
+void build(Graph& g, TestRng& rng)
+{
+	const unsigned int N = 2000;
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(i < N / 2 ? 0 : rng.IntFromTo<node_state_t> (0, 2));
+	for (node_id_t i = 0; i < N; ++i)
+	{
+		g.addEdge(i, (i + 1) % N, true);
+		g.addEdge(i, (i + 3) % N, false);
+		const node_id_t j = rng.IntFromTo<node_id_t> (0, N - 1);
+		if (!g.adjacent(i, j))
+			g.setEdgeState(g.addEdge(i, j, true), 1);
+	}
+	g.addEdge(5, 5, true);
+	for (node_id_t i = 100; i < N; i += 150)
+		g.removeNode(i);
+}
+
+/// source, target, state, directedness
+typedef boost::tuple<node_id_t, node_id_t, edge_state_t, bool> EdgeRecord;
+
+/**
+ * Sorted edge list of @p g, with the nodes renumbered in the order of their
+ * IDs as CompressedWriter does and the ends of undirected edges ordered.
+ */
+std::vector<EdgeRecord> edgeList(const Graph& g)
+{
+	std::vector<node_id_t> ids;
+	BOOST_FOREACH(const Node& n, g.nodes())
+		ids.push_back(n.id());
+	std::sort(ids.begin(), ids.end());
+	std::vector<node_id_t> label(g.maxNodeID() + 1);
+	for (node_id_t i = 0; i < ids.size(); ++i)
+		label[ids[i]] = i;
+	std::vector<EdgeRecord> edges;
+	BOOST_FOREACH(const Edge& e, g.edges())
+	{
+		node_id_t s = label[e.source()->id()], t = label[e.target()->id()];
+		if (!e.isDirected() && t < s)
+			std::swap(s, t);
+		edges.push_back(EdgeRecord(s, t, g.edgeState(e.id()), e.isDirected()));
+	}
+	std::sort(edges.begin(), edges.end());
+	return edges;
+}
+
+void checkSame(const Graph& g, const Graph& h)
+{
+	BOOST_REQUIRE_EQUAL(h.numberOfNodes(), g.numberOfNodes());
+	BOOST_REQUIRE_EQUAL(h.numberOfEdges(), g.numberOfEdges());
+	for (node_state_t s = 0; s < g.numberOfNodeStates(); ++s)
+		BOOST_CHECK_EQUAL(h.numberOfNodes(s), g.numberOfNodes(s));
+	for (edge_state_t s = 0; s < g.numberOfEdgeStates(); ++s)
+		BOOST_CHECK_EQUAL(h.numberOfEdges(s), g.numberOfEdges(s));
+	// no node IDs are removed below 100, so these keep their IDs
+	for (node_id_t n = 0; n < 100; ++n)
+	{
+		BOOST_CHECK_EQUAL(h.nodeState(n), g.nodeState(n));
+		BOOST_CHECK_EQUAL(h.node(n)->outDegree(), g.node(n)->outDegree());
+		BOOST_CHECK_EQUAL(h.node(n)->inDegree(), g.node(n)->inDegree());
+		BOOST_CHECK_EQUAL(h.node(n)->undirectedDegree(),
+				g.node(n)->undirectedDegree());
+	}
+	// h is numbered consecutively, so renumbering leaves it unchanged
+	BOOST_CHECK(edgeList(h) == edgeList(g));
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( compressed )
+
+BOOST_AUTO_TEST_CASE( round_trip )
+{
+	TestRng rng(11);
+	Graph g(3, 2);
+	build(g, rng);
+	std::stringstream s;
+	io::CompressedWriter(500).write(g, s);
+
+	std::ostringstream raw;
+	io::BinWriter().write(g, raw);
+	BOOST_CHECK_LT(3 * s.str().size(), raw.str().size());
+
+	io::CompressedReader reader(4);
+	boost::scoped_ptr<Graph> h(reader.createFromStream(s));
+	checkSame(g, *h);
+
+	Graph filled(3, 3);
+	filled.addNode();
+	s.clear();
+	s.seekg(0);
+	BOOST_CHECK_EQUAL(reader.createFromStream(s, filled), &filled);
+	checkSame(g, filled);
+
+	Graph small(2, 2);
+	s.clear();
+	s.seekg(0);
+	BOOST_CHECK_THROW(reader.createFromStream(s, small), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( streaming_and_missing_index )
+{
+	std::ostringstream s;
+	{
+		io::CompressedStreamWriter out(s, 2, 3, 3);
+		for (node_id_t i = 0; i < 10; ++i)
+			out.addNode(2 * i, i % 2);
+		BOOST_CHECK_THROW(out.addNode(4, 0), std::invalid_argument);
+		out.addEdge(18, 0, 2, true);
+		for (node_id_t i = 0; i < 9; ++i)
+			out.addEdge(2 * i, 2 * i + 2, 0, i % 3 == 0);
+		BOOST_CHECK_THROW(out.addNode(20, 0), std::logic_error);
+		out.finish();
+		BOOST_CHECK_EQUAL(out.blocks(), 8);
+	}
+	const std::string data = s.str();
+
+	std::istringstream in(data);
+	io::CompressedStreamReader r(in);
+	BOOST_CHECK_EQUAL(r.numberOfNodeStates(), 2);
+	BOOST_CHECK_EQUAL(r.numberOfEdgeStates(), 3);
+	io::CompressedStreamReader::NodeRecord n;
+	unsigned int nodes = 0;
+	while (r.nextNode(n))
+	{
+		BOOST_CHECK_EQUAL(n.id, 2 * nodes);
+		BOOST_CHECK_EQUAL(n.state, nodes % 2);
+		++nodes;
+	}
+	BOOST_CHECK_EQUAL(nodes, 10);
+	io::CompressedStreamReader::EdgeRecord e;
+	BOOST_REQUIRE(r.nextEdge(e));
+	BOOST_CHECK_EQUAL(e.source, 18);
+	BOOST_CHECK_EQUAL(e.target, 0);
+	BOOST_CHECK_EQUAL(e.state, 2);
+	BOOST_CHECK(e.directed);
+	unsigned int edges = 1;
+	while (r.nextEdge(e))
+	{
+		BOOST_CHECK_EQUAL(e.target, e.source + 2);
+		BOOST_CHECK_EQUAL(e.directed, (e.source / 2) % 3 == 0);
+		++edges;
+	}
+	BOOST_CHECK_EQUAL(edges, 10);
+
+	// without index and footer, the blocks are found by scanning
+	const std::size_t indexSize = 1 + 1 + 1 + 8 + 12;
+	std::istringstream cut(data.substr(0, data.size() - indexSize));
+	boost::scoped_ptr<Graph> g(io::CompressedReader(2).createFromStream(cut));
+	BOOST_CHECK_EQUAL(g->numberOfNodes(), 10);
+	BOOST_CHECK_EQUAL(g->numberOfEdges(), 10);
+	BOOST_CHECK_EQUAL(g->numberOfEdges(2), 1);
+	BOOST_CHECK(g->isEdge(9, 0));
+	BOOST_CHECK(g->isEdge(0, 1));
+	BOOST_CHECK(!g->isEdge(1, 0));
+
+	std::string corrupt = data;
+	corrupt[7] = 9; // type of the first block
+	std::istringstream bad(corrupt);
+	BOOST_CHECK_THROW(io::CompressedReader().createFromStream(bad),
+			std::runtime_error);
+	std::istringstream truncated(data.substr(0, 30));
+	io::CompressedStreamReader t(truncated);
+	BOOST_CHECK_THROW(while (t.nextNode(n)) {}, std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
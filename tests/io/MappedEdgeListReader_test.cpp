@@ -0,0 +1,86 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2.h>
+#include <largenet2/io/MappedEdgeListReader.h>
+#include <largenet2/io/EdgeListReader.h>
+#include <boost/scoped_ptr.hpp>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <stdexcept>
+
+using namespace largenet;
+
+BOOST_AUTO_TEST_SUITE( mapped_edge_list_reader )
+
+BOOST_AUTO_TEST_CASE( states_comments_and_undirected )
+{
+	std::istringstream in("# a comment\n"
+		"0 1 0 0\r\n"
+		"\n"
+		"  % another comment\n"
+		"1 2\t0 2\n"
+		"4 1\n"
+		"3 4 1 1");
+	io::MappedEdgeListReader reader(2);
+	boost::scoped_ptr<Graph> g(reader.createFromStream(in));
+	BOOST_CHECK_EQUAL(g->numberOfNodes(), 5);
+	BOOST_CHECK_EQUAL(g->numberOfEdges(), 4);
+	BOOST_CHECK_EQUAL(g->numberOfNodeStates(), 3);
+	BOOST_CHECK_EQUAL(g->nodeState(2), 2);
+	BOOST_CHECK_EQUAL(g->nodeState(3), 1);
+	BOOST_CHECK_EQUAL(g->nodeState(4), 1);
+	BOOST_CHECK(g->node(4)->hasEdgeTo(g->node(1)));
+	BOOST_CHECK(!g->node(1)->hasEdgeTo(g->node(4)));
+
+	reader.setDirected(false);
+	in.clear();
+	in.seekg(0);
+	Graph h(3, 1);
+	h.addNode();
+	BOOST_CHECK_EQUAL(reader.createFromStream(in, h), &h);
+	BOOST_CHECK_EQUAL(h.numberOfNodes(), 5);
+	BOOST_CHECK_EQUAL(h.node(1)->undirectedDegree(), 3);
+
+	Graph small(2, 1);
+	in.clear();
+	in.seekg(0);
+	BOOST_CHECK_THROW(reader.createFromStream(in, small), std::runtime_error);
+	std::istringstream bad("0 1\n2 x\n");
+	BOOST_CHECK_THROW(reader.createFromStream(bad), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( large_file_matches_edge_list_reader )
+{
+	// large enough to be parsed in several chunks
+	const unsigned int N = 5000, L = 300000;
+	std::ostringstream data;
+	unsigned long x = 12345;
+	for (unsigned int i = 0; i < L; ++i)
+	{
+		x = x * 6364136223846793005UL + 1442695040888963407UL;
+		data << (x >> 20) % N << " " << (x >> 40) % N << "\n";
+	}
+	const std::string name = "mapped_edge_list_test.txt";
+	{
+		std::ofstream f(name.c_str(), std::ios::binary);
+		f << data.str();
+	}
+	io::MappedEdgeListReader reader(4);
+	boost::scoped_ptr<Graph> g(reader.createFromFile(name));
+	std::istringstream in(data.str());
+	io::EdgeListReader plain;
+	boost::scoped_ptr<Graph> expected(plain.createFromStream(in));
+	std::remove(name.c_str());
+
+	BOOST_CHECK_EQUAL(g->numberOfNodes(), expected->numberOfNodes());
+	BOOST_CHECK_EQUAL(g->numberOfEdges(), expected->numberOfEdges());
+	for (node_id_t n = 0; n < N; n += 97)
+	{
+		BOOST_CHECK_EQUAL(g->node(n)->outDegree(), expected->node(n)->outDegree());
+		BOOST_CHECK_EQUAL(g->node(n)->inDegree(), expected->node(n)->inDegree());
+	}
+	BOOST_CHECK_THROW(reader.createFromFile("no/such/file"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
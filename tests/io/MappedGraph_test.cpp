@@ -0,0 +1,230 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2.h>
+#include <largenet2/io/MappedGraph.h>
+#include <largenet2/io/MappedGraphWriter.h>
+#include <largenet2/measures/mapped_measures.h>
+#include <largenet2/measures/counts.h>
+#include <largenet2/boost/mapped_graph_boost.h>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/pending/queue.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/foreach.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+#include <boost/cstdint.hpp>
+#include <sstream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include "../sim/test_rng.h"
+
+using namespace largenet;
+
+namespace
+{
+
+/// random graph with directed, undirected and mutual edges and loops
+void build(Graph& g, TestRng& rng)
+{
+	const unsigned int N = 60;
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(rng.IntFromTo<node_state_t> (0, 2));
+	for (unsigned int i = 0; i < 250; ++i)
+	{
+		const node_id_t s = rng.IntFromTo<node_id_t> (0, N - 1);
+		const node_id_t t = rng.IntFromTo<node_id_t> (0, N - 1);
+		if (g.adjacent(s, t) || g.adjacent(t, s))
+			continue;
+		const bool directed = rng.Chance(0.6);
+		const edge_id_t e = g.addEdge(s, t, directed);
+		if (directed && rng.Chance(0.3) && s != t)
+			g.addEdge(t, s, true);
+		g.setEdgeState(e, rng.IntFromTo<edge_state_t> (0, 1));
+	}
+}
+
+/// source, target, state, directedness
+typedef boost::tuple<node_id_t, node_id_t, edge_state_t, bool> EdgeRecord;
+
+/**
+ * Sorted edge list of @p g, with the nodes renumbered in the order of their
+ * IDs as MappedGraphWriter does and the ends of undirected edges ordered.
+ */
+std::vector<EdgeRecord> edgeList(const Graph& g)
+{
+	std::vector<node_id_t> ids;
+	BOOST_FOREACH(const Node& n, g.nodes())
+		ids.push_back(n.id());
+	std::sort(ids.begin(), ids.end());
+	std::vector<node_id_t> label(g.maxNodeID() + 1);
+	for (node_id_t i = 0; i < ids.size(); ++i)
+		label[ids[i]] = i;
+	std::vector<EdgeRecord> edges;
+	BOOST_FOREACH(const Edge& e, g.edges())
+	{
+		node_id_t s = label[e.source()->id()], t = label[e.target()->id()];
+		if (!e.isDirected() && t < s)
+			std::swap(s, t);
+		edges.push_back(EdgeRecord(s, t, g.edgeState(e.id()), e.isDirected()));
+	}
+	std::sort(edges.begin(), edges.end());
+	return edges;
+}
+
+/// sorted edge list of @p m, with the ends of undirected edges ordered
+std::vector<EdgeRecord> edgeList(const io::MappedGraph& m)
+{
+	std::vector<EdgeRecord> edges;
+	for (node_id_t n = 0; n < m.numberOfNodes(); ++n)
+	{
+		// undirected edges are listed at both ends, loops once
+		const io::MappedGraph::NeighborIterator undirected =
+				m.outNeighbors(n).second;
+		io::MappedGraph::NeighborIteratorRange r = m.successors(n);
+		const boost::uint32_t* st = m.successorEdgeStates(n);
+		for (; r.first != r.second; ++r.first, ++st)
+		{
+			const bool directed = r.first < undirected;
+			if (directed || n <= *r.first)
+				edges.push_back(EdgeRecord(n, *r.first, *st, directed));
+		}
+	}
+	std::sort(edges.begin(), edges.end());
+	return edges;
+}
+
+/// copy of @p s in suitably aligned memory
+std::vector<boost::uint64_t> aligned(const std::string& s)
+{
+	std::vector<boost::uint64_t> v((s.size() + 7) / 8);
+	memcpy(&v[0], s.data(), s.size());
+	return v;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( mapped_graph )
+
+BOOST_AUTO_TEST_CASE( matches_graph )
+{
+	TestRng rng(7);
+	Graph g(3, 2);
+	build(g, rng);
+	const std::string name = "mapped_graph_test.lncs";
+	{
+		std::ofstream f(name.c_str(), std::ios::binary);
+		io::MappedGraphWriter().write(g, f);
+	}
+	{
+		io::MappedGraph m(name);
+		BOOST_REQUIRE_EQUAL(m.numberOfNodes(), g.numberOfNodes());
+		BOOST_CHECK_EQUAL(m.numberOfEdges(), g.numberOfEdges());
+		for (node_state_t s = 0; s < 3; ++s)
+			BOOST_CHECK_EQUAL(m.numberOfNodes(s), g.numberOfNodes(s));
+		BOOST_CHECK_EQUAL(m.numberOfEdges(1), g.numberOfEdges(1));
+		for (node_id_t n = 0; n < g.numberOfNodes(); ++n)
+		{
+			const Node& v = *g.node(n);
+			BOOST_CHECK_EQUAL(m.nodeState(n), g.nodeState(n));
+			BOOST_CHECK_EQUAL(m.outDegree(n), v.outDegree());
+			BOOST_CHECK_EQUAL(m.inDegree(n), v.inDegree());
+			BOOST_CHECK_EQUAL(m.undirectedDegree(n), v.undirectedDegree());
+			BOOST_CHECK_EQUAL(m.mutualDegree(n), v.mutualDegree());
+			io::MappedGraph::NeighborIteratorRange r = m.successors(n);
+			const boost::uint32_t* st = m.successorEdgeStates(n);
+			unsigned int states = 0, expected = 0;
+			for (; r.first != r.second; ++r.first, ++st)
+			{
+				BOOST_CHECK(g.isEdge(n, *r.first));
+				states += *st;
+			}
+			BOOST_FOREACH(const Edge* e, v.outEdges())
+				expected += g.edgeState(e->id());
+			BOOST_FOREACH(const Edge* e, v.undirectedEdges())
+				expected += g.edgeState(e->id());
+			BOOST_CHECK_EQUAL(states, expected);
+			// Graph::isEdge(n, n) holds for any node with undirected edges
+			for (node_id_t u = 0; u < g.numberOfNodes(); u += 7)
+				if (u != n)
+					BOOST_CHECK_EQUAL(m.adjacent(n, u), g.isEdge(n, u));
+		}
+
+		BOOST_CHECK(edgeList(m) == edgeList(g));
+
+		BOOST_CHECK_EQUAL(measures::triples(m), measures::triples(g));
+		BOOST_CHECK_EQUAL(measures::inOutTriples(m), measures::inOutTriples(g));
+		BOOST_CHECK_EQUAL(measures::outTriples(m), measures::outTriples(g));
+		BOOST_CHECK(measures::inDegreeRange(m) == measures::inDegreeRange(g));
+		BOOST_CHECK_EQUAL(measures::maxOutDegree(m), measures::maxOutDegree(g));
+		BOOST_CHECK_EQUAL(measures::edges(m, motifs::LinkMotif(0, 1)),
+				measures::edges(g, motifs::LinkMotif(0, 1)));
+		BOOST_CHECK_EQUAL(measures::edges(m, motifs::LinkMotif(2, 2, false)),
+				measures::edges(g, motifs::LinkMotif(2, 2, false)));
+
+		// BGL search along out- and undirected edges reaches what Graph does
+		std::vector<boost::default_color_type> color(m.numberOfNodes(),
+				boost::white_color);
+		boost::queue<node_id_t> q;
+		boost::breadth_first_visit(m, 0, q, boost::default_bfs_visitor(),
+				boost::make_iterator_property_map(color.begin(),
+						boost::identity_property_map()));
+		std::vector<node_id_t> stack(1, 0);
+		std::vector<bool> seen(g.numberOfNodes(), false);
+		seen[0] = true;
+		while (!stack.empty())
+		{
+			const node_id_t n = stack.back();
+			stack.pop_back();
+			for (node_id_t u = 0; u < g.numberOfNodes(); ++u)
+				if (!seen[u] && g.isEdge(n, u))
+				{
+					seen[u] = true;
+					stack.push_back(u);
+				}
+		}
+		for (node_id_t n = 0; n < g.numberOfNodes(); ++n)
+			BOOST_CHECK_EQUAL(color[n] != boost::white_color, seen[n]);
+	}
+	std::remove(name.c_str());
+	BOOST_CHECK_THROW(io::MappedGraph("no/such/file"), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( renumbering_and_invalid_data )
+{
+	Graph g(2, 1);
+	for (unsigned int i = 0; i < 5; ++i)
+		g.addNode(i % 2);
+	g.addEdge(0, 4, true);
+	g.addEdge(4, 2, false);
+	g.removeNode(1);
+	std::ostringstream s;
+	io::MappedGraphWriter().write(g, s);
+	std::vector<boost::uint64_t> data = aligned(s.str());
+	const char* p = reinterpret_cast<const char*> (&data[0]);
+
+	// nodes 0, 2, 3, 4 become 0, 1, 2, 3
+	io::MappedGraph m(p, s.str().size());
+	BOOST_REQUIRE_EQUAL(m.numberOfNodes(), 4);
+	BOOST_CHECK(m.adjacent(0, 3));
+	BOOST_CHECK(!m.adjacent(3, 0));
+	BOOST_CHECK(m.adjacent(3, 1));
+	BOOST_CHECK(m.adjacent(1, 3));
+	BOOST_CHECK_EQUAL(m.nodeState(3), 0);
+	BOOST_CHECK_EQUAL(m.nodeState(2), 1);
+	BOOST_CHECK_EQUAL(out_degree(3, m), 1);
+	BOOST_CHECK_EQUAL(in_degree(3, m), 2);
+	BOOST_CHECK(edgeList(m) == edgeList(g));
+
+	BOOST_CHECK_THROW(io::MappedGraph(p, s.str().size() - 8), std::runtime_error);
+	BOOST_CHECK_THROW(io::MappedGraph(p + 8, s.str().size() - 8), std::runtime_error);
+	std::swap(reinterpret_cast<char*> (&data[0])[4],
+			reinterpret_cast<char*> (&data[0])[5]);
+	BOOST_CHECK_THROW(io::MappedGraph(p, s.str().size()), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
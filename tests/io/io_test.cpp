@@ -4,17 +4,20 @@
  * @author gerd
  */
 
+#define BOOST_TEST_MODULE io tests
+#include <boost/test/unit_test.hpp>
+
 #include <largenet2.h>
 #include <largenet2/io/BinWriter.h>
 #include <largenet2/io/BinReader.h>
 #include <largenet2/io/DotWriter.h>
-#include <iostream>
 #include <fstream>
+#include <cstdio>
 
 using namespace std;
 using namespace largenet;
 
-int main(int argc, char **argv)
+BOOST_AUTO_TEST_CASE( bin_and_dot_files )
 {
 	Graph g(2, 4);
 	g.addNode(0); // 0
@@ -28,39 +31,25 @@ int main(int argc, char **argv)
 	e = g.addEdge(2, 3, true);
 	g.setEdgeState(e, 3);
 
-	cout << "Writing graph to binary file.\n";
-	cout << "Graph with " << g.numberOfNodes() << " nodes in "
-			<< g.numberOfNodeStates() << " states and " << g.numberOfEdges()
-			<< " edges.\n";
 	ofstream outfile("iotest.net", ios::binary);
-	if (outfile)
-	{
-		io::BinWriter writer;
-		writer.write(g, outfile);
-		outfile.close();
-	}
+	BOOST_REQUIRE(outfile);
+	io::BinWriter().write(g, outfile);
+	outfile.close();
 
-	cout << "Writing graph to DOT file.\n";
 	outfile.open("iotest.dot");
-	if (outfile)
-	{
-		io::DotWriter writer;
-		writer.write(g, outfile);
-		outfile.close();
-	}
+	BOOST_REQUIRE(outfile);
+	io::DotWriter().write(g, outfile);
+	outfile.close();
 
-	cout << "Trying to read graph from binary file.\n";
 	ifstream infile("iotest.net", ios::binary);
-	Graph* g2 = 0;
-	if (infile)
-	{
-		io::BinReader reader;
-		g2 = reader.createFromStream(infile);
-		infile.close();
-		cout << "Graph with " << g2->numberOfNodes() << " nodes in "
-				<< g2->numberOfNodeStates() << " states and "
-				<< g2->numberOfEdges() << " edges.\n";
-	}
+	BOOST_REQUIRE(infile);
+	Graph* g2 = io::BinReader().createFromStream(infile);
+	infile.close();
+	BOOST_CHECK_EQUAL(g2->numberOfNodes(), g.numberOfNodes());
+	BOOST_CHECK_EQUAL(g2->numberOfNodeStates(), g.numberOfNodeStates());
+	BOOST_CHECK_EQUAL(g2->numberOfEdges(), g.numberOfEdges());
+	BOOST_CHECK_EQUAL(g2->numberOfEdges(3), 1);
 	delete g2;
-	return 0;
+	remove("iotest.net");
+	remove("iotest.dot");
 }
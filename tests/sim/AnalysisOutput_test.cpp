@@ -0,0 +1,140 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/output/AnalysisOutput.h>
+#include <largenet2/measures/measures.h>
+#include <largenet2.h>
+#include <boost/thread/thread.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+using namespace sim::output;
+
+namespace
+{
+
+/// number of edges, computed slowly for some graphs to reorder the workers
+double slowEdges(const largenet::Graph& g)
+{
+	boost::this_thread::sleep(boost::posix_time::milliseconds(
+			(g.numberOfEdges() % 3) * 3));
+	return g.numberOfEdges();
+}
+
+double failing(const largenet::Graph& g)
+{
+	if (g.numberOfEdges() == 3)
+		throw std::runtime_error("three edges");
+	return 0;
+}
+
+std::vector<std::vector<double> > parse(const std::string& s)
+{
+	std::vector<std::vector<double> > lines;
+	std::istringstream in(s);
+	std::string line;
+	while (std::getline(in, line))
+	{
+		if (line.empty() || line[0] == '#')
+			continue;
+		std::istringstream l(line);
+		std::vector<double> v;
+		double x;
+		while (l >> x)
+			v.push_back(x);
+		lines.push_back(v);
+	}
+	return lines;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( analysis_output )
+
+BOOST_AUTO_TEST_CASE( results_in_time_order )
+{
+	largenet::Graph g(1, 1);
+	for (unsigned int i = 0; i < 40; ++i)
+		g.addNode();
+	std::ostringstream s;
+	{
+		AnalysisOutput out(s, g, 1.0, 4, 3);
+		out.addMeasure("edges", slowEdges);
+		out.addMeasure("kmax", largenet::measures::maxOutDegree);
+		out.writeHeader();
+		for (unsigned int t = 0; t < 30; ++t)
+		{
+			out.output(t);
+			g.addEdge(t, t + 1, true);
+		}
+		out.flush();
+		BOOST_CHECK_THROW(out.addMeasure("late", slowEdges), std::logic_error);
+	}
+	BOOST_CHECK_EQUAL(s.str().substr(0, 14), "# t\tedges\tkmax");
+	const std::vector<std::vector<double> > r = parse(s.str());
+	BOOST_REQUIRE_EQUAL(r.size(), 30);
+	for (unsigned int t = 0; t < 30; ++t)
+	{
+		BOOST_REQUIRE_EQUAL(r[t].size(), 3);
+		BOOST_CHECK_EQUAL(r[t][0], t);
+		BOOST_CHECK_EQUAL(r[t][1], t);
+		BOOST_CHECK_EQUAL(r[t][2], t > 0 ? 1 : 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( written_on_simulation_thread )
+{
+	largenet::Graph g(1, 1);
+	g.addNode();
+	g.addNode();
+	std::ostringstream s;
+	AnalysisOutput out(s, g, 1.0, 2);
+	out.addMeasure("edges", slowEdges);
+	out.output(0);
+	// a finished result waits for the next output or flush()
+	boost::this_thread::sleep(boost::posix_time::milliseconds(20));
+	BOOST_CHECK(s.str().empty());
+	g.addEdge(0, 1, true);
+	out.output(1);
+	out.flush();
+	const std::vector<std::vector<double> > r = parse(s.str());
+	BOOST_REQUIRE_EQUAL(r.size(), 2);
+	BOOST_CHECK_EQUAL(r[1][1], 1);
+}
+
+BOOST_AUTO_TEST_CASE( measure_errors )
+{
+	largenet::Graph g(1, 1);
+	for (unsigned int i = 0; i < 10; ++i)
+		g.addNode();
+	std::ostringstream s;
+	AnalysisOutput out(s, g, 1.0, 2);
+	out.addMeasure("x", failing);
+	// the error is reported once, by a later output or by flush()
+	unsigned int errors = 0;
+	for (unsigned int t = 0; t < 6; ++t)
+	{
+		try
+		{
+			out.output(t);
+		} catch (std::runtime_error&)
+		{
+			++errors;
+		}
+		g.addEdge(t, t + 1, true);
+	}
+	try
+	{
+		out.flush();
+	} catch (std::runtime_error&)
+	{
+		++errors;
+	}
+	BOOST_CHECK_EQUAL(errors, 1);
+	out.flush();
+	// the failed snapshot is skipped
+	BOOST_CHECK_EQUAL(parse(s.str()).size(), 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,138 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/output/Outputter.h>
+#include <largenet2/sim/output/RecordOutput.h>
+#include <largenet2/sim/output/AsyncWriter.h>
+#include <largenet2/sim/output/TimeSeriesOutput.h>
+#include <largenet2.h>
+#include <boost/thread/thread.hpp>
+#include <sstream>
+#include <string>
+
+using namespace sim::output;
+
+namespace
+{
+
+/// Records a counter and its square; optionally formats slowly
+class CounterOutput: public RecordOutput
+{
+public:
+	CounterOutput(std::ostream& out, const int& counter, bool slow = false) :
+			RecordOutput(out, 1.0), counter_(counter), slow_(slow)
+	{
+	}
+private:
+	std::size_t doRecordSize() const
+	{
+		return 2;
+	}
+	void doSample(double* record)
+	{
+		record[0] = counter_;
+		record[1] = counter_ * counter_;
+	}
+	void doFormat(std::ostream& out, double t, const double* record)
+	{
+		if (slow_)
+			boost::this_thread::sleep(boost::posix_time::milliseconds(2));
+		RecordOutput::doFormat(out, t, record);
+	}
+	void doWriteHeader()
+	{
+		stream() << commentChar() << " t\tn\tn2\n";
+	}
+	const int& counter_;
+	bool slow_;
+};
+
+std::string runCounter(std::size_t capacity, bool slow)
+{
+	std::ostringstream s;
+	int counter = 0;
+	Outputter out;
+	out.addOutput(new CounterOutput(s, counter, slow));
+	out.setAsync(capacity);
+	out.writeHeaders();
+	for (counter = 0; counter < 50; ++counter)
+		out.output(counter);
+	out.flush();
+	return s.str();
+}
+
+struct SumLinkState
+{
+	largenet::edge_state_t operator()(largenet::node_state_t a,
+			largenet::node_state_t b) const
+	{
+		return a + b;
+	}
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE( async_output )
+
+BOOST_AUTO_TEST_CASE( async_matches_sync )
+{
+	const std::string sync = runCounter(0, false);
+	BOOST_CHECK(sync.find("49\t49\t2401\n") != std::string::npos);
+	BOOST_CHECK_EQUAL(runCounter(1024, false), sync);
+	BOOST_CHECK_EQUAL(runCounter(1, false), sync);
+}
+
+BOOST_AUTO_TEST_CASE( backpressure )
+{
+	std::ostringstream s;
+	int counter = 0;
+	CounterOutput* c = new CounterOutput(s, counter, true);
+	{
+		AsyncWriter writer(2);
+		Outputter out;
+		out.addOutput(c);
+		c->setWriter(&writer);
+		for (counter = 0; counter < 20; ++counter)
+			out.output(counter);
+		BOOST_CHECK_GT(writer.stalls(), 0);
+		writer.flush();
+		c->setWriter(0);
+		// records arrive complete and in order
+		std::istringstream in(s.str());
+		double t, n, n2;
+		for (int i = 0; i < 20; ++i)
+		{
+			BOOST_REQUIRE(in >> t >> n >> n2);
+			BOOST_CHECK_EQUAL(n, i);
+			BOOST_CHECK_EQUAL(n2, i * i);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE( time_series )
+{
+	using namespace largenet;
+	Graph g(2, 3);
+	for (unsigned int i = 0; i < 6; ++i)
+		g.addNode(i % 2);
+	for (unsigned int i = 0; i < 5; ++i)
+		g.addEdge(i, i + 1, false);
+	SumLinkState lsc;
+	std::ostringstream sync, async;
+	for (int mode = 0; mode < 2; ++mode)
+	{
+		Outputter out;
+		out.addOutput(new TimeSeriesOutput<Graph, SumLinkState> (
+				mode == 0 ? sync : async, g, lsc, 0.5, false));
+		out.setAsync(mode == 0 ? 0 : 8);
+		BOOST_CHECK_EQUAL(out.async(), mode == 1);
+		out.writeHeaders();
+		out.output(0.0);
+		out.output(0.25);
+		out.output(0.5);
+	}
+	BOOST_CHECK_EQUAL(async.str(), sync.str());
+	// without a StateConsistencyListener, all edges stay in state 0
+	BOOST_CHECK(sync.str().find("0.5\t3\t3\t5\t0\t0\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
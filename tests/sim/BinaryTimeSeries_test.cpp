@@ -0,0 +1,167 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/output/BinaryTimeSeries.h>
+#include <largenet2/sim/output/BinaryTimeSeriesOutput.h>
+#include <largenet2/sim/output/Outputter.h>
+#include <largenet2.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+using namespace sim::output;
+
+namespace
+{
+
+std::vector<std::string> testColumns()
+{
+	std::vector<std::string> c;
+	c.push_back("count");
+	c.push_back("fraction");
+	return c;
+}
+
+/// 50 records with an integer and a non-integer column, blocks of 7
+std::string writeSeries(bool compress, bool finish = true)
+{
+	std::ostringstream s;
+	std::string partial;
+	{
+		BinaryTimeSeriesWriter w(s, testColumns(), compress, 7);
+		w.writeHeader();
+		for (int i = 0; i < 50; ++i)
+		{
+			const double v[2] = { 1000.0 + (i * 37) % 11, i / 3.0 };
+			w.append(0.5 * i, v);
+		}
+		partial = s.str();
+	}
+	return finish ? s.str() : partial;
+}
+
+struct SumLinkState
+{
+	largenet::edge_state_t operator()(largenet::node_state_t a,
+			largenet::node_state_t b) const
+	{
+		return a + b;
+	}
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE( binary_time_series )
+
+BOOST_AUTO_TEST_CASE( round_trip )
+{
+	for (int compress = 0; compress < 2; ++compress)
+	{
+		std::istringstream in(writeSeries(compress));
+		BinaryTimeSeriesReader r(in);
+		BOOST_CHECK_EQUAL(r.compressed(), compress == 1);
+		BOOST_CHECK_EQUAL(r.records(), 50);
+		BOOST_CHECK_EQUAL(r.blocks(), 8);
+		BOOST_REQUIRE_EQUAL(r.columns().size(), 2);
+		BOOST_CHECK_EQUAL(r.columns()[1], "fraction");
+		BOOST_CHECK_EQUAL(r.column("fraction"), 1);
+		BOOST_CHECK_THROW(r.column("nothing"), std::invalid_argument);
+
+		double t;
+		std::vector<double> v;
+		for (int i = 0; i < 50; ++i)
+		{
+			BOOST_REQUIRE(r.next(t, v));
+			BOOST_CHECK_EQUAL(t, 0.5 * i);
+			BOOST_CHECK_EQUAL(v[0], 1000.0 + (i * 37) % 11);
+			BOOST_CHECK_EQUAL(v[1], i / 3.0);
+		}
+		BOOST_CHECK(!r.next(t, v));
+
+		const std::vector<double> counts = r.values("count");
+		BOOST_REQUIRE_EQUAL(counts.size(), 50);
+		BOOST_CHECK_EQUAL(counts[49], 1000.0 + (49 * 37) % 11);
+		BOOST_CHECK_EQUAL(r.times()[13], 6.5);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( compression )
+{
+	const std::string raw = writeSeries(false), packed = writeSeries(true);
+	// times and the fraction column stay doubles, counts shrink from eight
+	// bytes to one or two
+	BOOST_CHECK_LE(packed.size() + 50 * 6, raw.size());
+}
+
+BOOST_AUTO_TEST_CASE( seeking )
+{
+	std::istringstream in(writeSeries(true));
+	BinaryTimeSeriesReader r(in);
+	double t;
+	std::vector<double> v;
+	r.seek(10.0);
+	BOOST_REQUIRE(r.next(t, v));
+	BOOST_CHECK_EQUAL(t, 10.0);
+	r.seek(3.2);
+	BOOST_REQUIRE(r.next(t, v));
+	BOOST_CHECK_EQUAL(t, 3.5);
+	BOOST_CHECK_EQUAL(v[1], 7 / 3.0);
+	r.seek(-1);
+	BOOST_REQUIRE(r.next(t, v));
+	BOOST_CHECK_EQUAL(t, 0);
+	r.seek(100);
+	BOOST_CHECK(!r.next(t, v));
+}
+
+BOOST_AUTO_TEST_CASE( unfinished_file )
+{
+	// without the index, the complete blocks are found by scanning
+	std::istringstream in(writeSeries(true, false));
+	BinaryTimeSeriesReader r(in);
+	BOOST_CHECK_EQUAL(r.blocks(), 7);
+	BOOST_CHECK_EQUAL(r.records(), 49);
+	r.seek(20);
+	double t;
+	std::vector<double> v;
+	BOOST_REQUIRE(r.next(t, v));
+	BOOST_CHECK_EQUAL(t, 20);
+
+	std::istringstream bad("LNTX and more");
+	BOOST_CHECK_THROW(BinaryTimeSeriesReader b(bad), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( text_conversion )
+{
+	using namespace largenet;
+	Graph g(2, 3);
+	for (unsigned int i = 0; i < 6; ++i)
+		g.addNode(i % 2);
+	SumLinkState lsc;
+	std::ostringstream text, bin;
+	{
+		Outputter out;
+		out.addOutput(new TimeSeriesOutput<Graph, SumLinkState> (text, g, lsc,
+				1.0, false));
+		out.addOutput(new BinaryTimeSeriesOutput<Graph, SumLinkState> (bin, g,
+				lsc, 1.0, false, true, 4));
+		out.writeHeaders();
+		for (unsigned int i = 0; i < 10; ++i)
+		{
+			out.output(i);
+			g.setNodeState(i % 6, 1);
+			if (i < 5)
+				g.addEdge(i, i + 1, false);
+		}
+	}
+	std::istringstream in(bin.str());
+	BinaryTimeSeriesReader r(in);
+	BOOST_CHECK_EQUAL(r.records(), 10);
+	std::ostringstream converted;
+	r.writeText(converted);
+	BOOST_CHECK_EQUAL(converted.str(), text.str());
+	// formatting leaves the stream precision unchanged
+	BOOST_CHECK_EQUAL(text.precision(), std::streamsize(6));
+	BOOST_CHECK_EQUAL(converted.precision(), std::streamsize(6));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
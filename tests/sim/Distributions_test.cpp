@@ -0,0 +1,182 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/random/distributions.h>
+#include <largenet2/sim/random/AliasTable.h>
+#include <vector>
+#include <cmath>
+#include "test_rng.h"
+
+using namespace sim::random;
+
+namespace
+{
+
+/// checks mean and variance of n draws against their exact values
+template<class Draw>
+void checkMoments(Draw draw, const unsigned int n, const double mean,
+		const double var)
+{
+	std::vector<double> x(n);
+	double m = 0;
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		x[i] = draw();
+		m += x[i];
+	}
+	m /= n;
+	double v = 0, m4 = 0;
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		const double d = (x[i] - m) * (x[i] - m);
+		v += d;
+		m4 += d * d;
+	}
+	v /= n;
+	m4 /= n;
+	BOOST_CHECK_LT(std::fabs(m - mean), 5 * std::sqrt(var / n));
+	// standard error of the sample variance from the fourth central moment
+	BOOST_CHECK_LT(std::fabs(v - var), 5 * std::sqrt((m4 - v * v) / n));
+}
+
+struct PoissonDraw
+{
+	PoissonDraw(TestRng& rng, double mean) :
+			rng(rng), mean(mean)
+	{
+	}
+	double operator()()
+	{
+		return poisson(rng, mean);
+	}
+	TestRng& rng;
+	double mean;
+};
+
+struct BinomialDraw
+{
+	BinomialDraw(TestRng& rng, unsigned long n, double p) :
+			rng(rng), n(n), p(p)
+	{
+	}
+	double operator()()
+	{
+		return binomial(rng, n, p);
+	}
+	TestRng& rng;
+	unsigned long n;
+	double p;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE( distributions )
+
+BOOST_AUTO_TEST_CASE( log_factorial )
+{
+	double f = 0;
+	for (unsigned int k = 1; k < 40; ++k)
+	{
+		f += std::log(static_cast<double> (k));
+		BOOST_CHECK_CLOSE(detail::logFactorial(k), f, 1e-10);
+	}
+	BOOST_CHECK_EQUAL(detail::logFactorial(0), 0);
+}
+
+BOOST_AUTO_TEST_CASE( poisson_moments )
+{
+	TestRng rng(5);
+	const double means[] = { 0.5, 3, 9.9, 10, 25, 300, 1e5 };
+	for (unsigned int i = 0; i < sizeof(means) / sizeof(means[0]); ++i)
+		checkMoments(PoissonDraw(rng, means[i]), 100000, means[i], means[i]);
+	BOOST_CHECK_EQUAL(poisson(rng, 0.0), 0);
+}
+
+BOOST_AUTO_TEST_CASE( poisson_probabilities )
+{
+	// P(k = 30) and P(k = 50) for mean 40, in the rejection regime
+	TestRng rng(7);
+	const unsigned int n = 400000;
+	unsigned int c30 = 0, c50 = 0;
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		const unsigned long k = poisson(rng, 40.0);
+		c30 += k == 30;
+		c50 += k == 50;
+	}
+	const double p30 = std::exp(-40 + 30 * std::log(40.0) - detail::logFactorial(30));
+	const double p50 = std::exp(-40 + 50 * std::log(40.0) - detail::logFactorial(50));
+	BOOST_CHECK_LT(std::fabs(c30 - n * p30), 5 * std::sqrt(n * p30));
+	BOOST_CHECK_LT(std::fabs(c50 - n * p50), 5 * std::sqrt(n * p50));
+}
+
+BOOST_AUTO_TEST_CASE( binomial_moments )
+{
+	TestRng rng(11);
+	const unsigned long ns[] = { 10, 40, 100, 1000, 100000 };
+	const double ps[] = { 0.01, 0.2, 0.5, 0.93 };
+	for (unsigned int i = 0; i < sizeof(ns) / sizeof(ns[0]); ++i)
+		for (unsigned int j = 0; j < sizeof(ps) / sizeof(ps[0]); ++j)
+			checkMoments(BinomialDraw(rng, ns[i], ps[j]), 50000,
+					ns[i] * ps[j], ns[i] * ps[j] * (1 - ps[j]));
+	BOOST_CHECK_EQUAL(binomial(rng, 10, 0.0), 0);
+	BOOST_CHECK_EQUAL(binomial(rng, 10, 1.0), 10);
+	BOOST_CHECK_EQUAL(binomial(rng, 0, 0.5), 0);
+}
+
+BOOST_AUTO_TEST_CASE( binomial_probabilities )
+{
+	// far from the mode, where BTRD uses its exact acceptance test
+	TestRng rng(13);
+	const unsigned int n = 400000;
+	const unsigned long N = 500;
+	const double p = 0.3;
+	unsigned int c120 = 0, c170 = 0;
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		const unsigned long k = binomial(rng, N, p);
+		BOOST_REQUIRE(k <= N);
+		c120 += k == 120;
+		c170 += k == 170;
+	}
+	const double lc = detail::logFactorial(N);
+	const double p120 = std::exp(lc - detail::logFactorial(120)
+			- detail::logFactorial(N - 120) + 120 * std::log(p) + (N - 120)
+			* std::log(1 - p));
+	const double p170 = std::exp(lc - detail::logFactorial(170)
+			- detail::logFactorial(N - 170) + 170 * std::log(p) + (N - 170)
+			* std::log(1 - p));
+	BOOST_CHECK_LT(std::fabs(c120 - n * p120), 5 * std::sqrt(n * p120));
+	BOOST_CHECK_LT(std::fabs(c170 - n * p170), 5 * std::sqrt(n * p170));
+}
+
+BOOST_AUTO_TEST_CASE( alias_table )
+{
+	std::vector<double> w;
+	w.push_back(1);
+	w.push_back(0);
+	w.push_back(3);
+	w.push_back(6);
+	AliasTable table(w);
+	BOOST_CHECK_EQUAL(table.size(), 4);
+	TestRng rng(17);
+	const unsigned int n = 200000;
+	std::vector<unsigned int> counts(4, 0);
+	for (unsigned int i = 0; i < n; ++i)
+		++counts[table.sample(rng)];
+	BOOST_CHECK_EQUAL(counts[1], 0);
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		const double expected = n * w[i] / 10;
+		BOOST_CHECK_LE(std::fabs(counts[i] - expected),
+				5 * std::sqrt(expected) + 1e-9);
+	}
+
+	w.assign(3, 0.0);
+	BOOST_CHECK_THROW(table.assign(w), std::invalid_argument);
+	w[0] = -1;
+	w[1] = 2;
+	BOOST_CHECK_THROW(table.assign(w), std::invalid_argument);
+	BOOST_CHECK_THROW(AliasTable(std::vector<double>()), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/ensemble/EnsembleRunner.h>
+#include <largenet2.h>
+#include <cmath>
+#include <stdexcept>
+
+#include "test_rng.h"
+
+using namespace sim::ensemble;
+
+/// Every infected node recovers with rate 1
+class RecoveryReplica: public Replica
+{
+public:
+	enum { S, I };
+	RecoveryReplica(unsigned int n, unsigned long seed) :
+			net_(2, 1), rng_(seed)
+	{
+		for (unsigned int i = 0; i < n; ++i)
+			net_.addNode(I);
+	}
+private:
+	double doStep()
+	{
+		const double tau = rng_.Exponential(1.0 / net_.numberOfNodes(I));
+		net_.setNodeState(net_.randomNode(I, rng_)->id(), S);
+		return tau;
+	}
+	bool doStopped() const
+	{
+		return net_.numberOfNodes(I) == 0;
+	}
+	void doObserve(std::vector<double>& values) const
+	{
+		values[0] = net_.numberOfNodes(I);
+		values[1] = net_.numberOfNodes(S);
+	}
+	largenet::Graph net_;
+	TestRng rng_;
+};
+
+class FailingReplica: public Replica
+{
+	double doStep()
+	{
+		throw std::runtime_error("boom");
+	}
+	void doObserve(std::vector<double>&) const
+	{
+	}
+};
+
+Replica* makeRecovery(unsigned int, unsigned long seed)
+{
+	return new RecoveryReplica(100, seed);
+}
+
+Replica* makeFailing(unsigned int, unsigned long)
+{
+	return new FailingReplica;
+}
+
+BOOST_AUTO_TEST_SUITE( ensemble_runner )
+
+BOOST_AUTO_TEST_CASE( statistics_merge )
+{
+	EnsembleStatistics all(1, 1, 1.0, true), a(1, 1, 1.0, true), b(1, 1, 1.0, true);
+	std::vector<double> v(1);
+	for (unsigned int i = 1; i <= 10; ++i)
+	{
+		v[0] = i;
+		all.add(0, v);
+		(i % 3 == 0 ? a : b).add(0, v);
+	}
+	a.merge(b);
+	BOOST_CHECK_EQUAL(a.count(0), 10);
+	BOOST_CHECK_CLOSE(a.mean(0, 0), 5.5, 1e-9);
+	BOOST_CHECK_CLOSE(a.variance(0, 0), all.variance(0, 0), 1e-9);
+	BOOST_CHECK_CLOSE(a.variance(0, 0), 55.0 / 6.0, 1e-9);
+	BOOST_CHECK_CLOSE(a.quantile(0, 0, 0.5), 5.5, 1e-9);
+	BOOST_CHECK_CLOSE(a.quantile(0, 0, 1.0), 10, 1e-9);
+	BOOST_CHECK_THROW(EnsembleStatistics(1, 1, 1.0).quantile(0, 0, 0.5), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE( replica_seeds_differ )
+{
+	BOOST_CHECK(EnsembleRunner::replicaSeed(1, 0) != EnsembleRunner::replicaSeed(1, 1));
+	BOOST_CHECK(EnsembleRunner::replicaSeed(1, 0) != EnsembleRunner::replicaSeed(2, 0));
+}
+
+BOOST_AUTO_TEST_CASE( recovery_ensemble )
+{
+	EnsembleRunner runner(makeRecovery, 2, 3.0, 0.5);
+	runner.setSeed(5);
+	runner.setThreads(4);
+	runner.setStoreSamples(true);
+	const EnsembleStatistics& stats = runner.run(400);
+	BOOST_REQUIRE_EQUAL(stats.gridPoints(), 7);
+	for (unsigned int g = 0; g < stats.gridPoints(); ++g)
+	{
+		BOOST_CHECK_EQUAL(stats.count(g), 400);
+		BOOST_CHECK_CLOSE(stats.mean(g, 0) + stats.mean(g, 1), 100, 1e-9);
+	}
+	BOOST_CHECK_EQUAL(stats.mean(0, 0), 100);
+	// binomial decay: mean N exp(-t), variance N p (1-p)
+	const double p = std::exp(-1.0);
+	BOOST_CHECK_CLOSE(stats.mean(2, 0), 100 * p, 3);
+	BOOST_CHECK_CLOSE(stats.variance(2, 0), 100 * p * (1 - p), 20);
+	BOOST_CHECK(stats.quantile(2, 0, 0.1) < stats.quantile(2, 0, 0.9));
+
+	// same ensemble on a single thread
+	EnsembleRunner serial(makeRecovery, 2, 3.0, 0.5);
+	serial.setSeed(5);
+	serial.setThreads(1);
+	serial.run(400);
+	for (unsigned int g = 0; g < stats.gridPoints(); ++g)
+	{
+		BOOST_CHECK_CLOSE(serial.statistics().mean(g, 0), stats.mean(g, 0), 1e-9);
+		BOOST_CHECK_CLOSE(serial.statistics().variance(g, 0) + 1,
+				stats.variance(g, 0) + 1, 1e-9);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( replica_errors_propagate )
+{
+	EnsembleRunner runner(makeFailing, 0, 1.0, 1.0);
+	runner.setThreads(2);
+	BOOST_CHECK_THROW(runner.run(4), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,125 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/rare/ForwardFluxSampling.h>
+#include <largenet2.h>
+#include <boost/bind.hpp>
+#include <vector>
+#include <cmath>
+#include "test_rng.h"
+
+using namespace largenet;
+using namespace sim::rare;
+
+namespace
+{
+
+enum FFSState
+{
+	FFS_S, FFS_I
+};
+
+/// SIS on a complete graph, reading its state from the graph
+class BirthDeathSIS
+{
+public:
+	BirthDeathSIS(Graph& g, double beta, double mu) :
+			g_(g), beta_(beta), mu_(mu)
+	{
+	}
+	bool stopped()
+	{
+		return g_.numberOfNodes(FFS_I) == 0;
+	}
+	double step(TestRng& rng)
+	{
+		const double n = g_.numberOfNodes(FFS_I), s = g_.numberOfNodes(FFS_S);
+		const double b = beta_ * n * s, d = mu_ * n;
+		if (b + d == 0)
+			return 1000;
+		const double dt = rng.Exponential(1.0 / (b + d));
+		if (rng.Uniform01() * (b + d) < b)
+			g_.setNodeState(g_.nodes(FFS_S).first.id(), FFS_I);
+		else
+			g_.setNodeState(g_.nodes(FFS_I).first.id(), FFS_S);
+		return dt;
+	}
+	double infected() const
+	{
+		return g_.numberOfNodes(FFS_I);
+	}
+private:
+	Graph& g_;
+	double beta_, mu_;
+};
+
+}
+
+BOOST_AUTO_TEST_SUITE( forward_flux_sampling )
+
+BOOST_AUTO_TEST_CASE( birth_death_chain )
+{
+	// subcritical SIS on a complete graph: probability of reaching 16 infected
+	// nodes before dropping below 3, starting from 3
+	const unsigned int N = 40;
+	const double beta = 0.015, mu = 1.0;
+	Graph g(2, 1);
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(i < 2 ? FFS_I : FFS_S);
+	BirthDeathSIS model(g, beta, mu);
+	TestRng rng(3);
+
+	std::vector<double> interfaces;
+	interfaces.push_back(3);
+	interfaces.push_back(5);
+	interfaces.push_back(7);
+	interfaces.push_back(9);
+	interfaces.push_back(12);
+	interfaces.push_back(16);
+	ForwardFluxSampling<BirthDeathSIS, TestRng> ffs(g, model, rng,
+			boost::bind(&BirthDeathSIS::infected, &model), interfaces);
+	ffs.setInitialCrossings(200);
+	ffs.setTrials(2000);
+	const ForwardFluxSampling<BirthDeathSIS, TestRng>::Result r = ffs.run();
+
+	// gambler's ruin with absorbing boundaries at 2 and 16
+	double sum = 0, pi = 1;
+	for (unsigned int j = 2; j < 16; ++j)
+	{
+		if (j > 2)
+			pi *= mu * j / (beta * j * (N - j));
+		sum += pi;
+	}
+	const double exact = 1.0 / sum;
+
+	BOOST_CHECK_EQUAL(r.probabilities.size(), interfaces.size() - 1);
+	BOOST_CHECK(r.flux > 0);
+	BOOST_CHECK(r.probabilityError > 0);
+	BOOST_CHECK(r.probabilityError < 0.3 * r.probability);
+	BOOST_CHECK_LT(std::fabs(r.probability - exact), 4 * r.probabilityError);
+	BOOST_CHECK_CLOSE(r.rate, r.flux * r.probability, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE( invalid_setup )
+{
+	Graph g(2, 1);
+	for (unsigned int i = 0; i < 10; ++i)
+		g.addNode(i < 5 ? FFS_I : FFS_S);
+	BirthDeathSIS model(g, 0.1, 1.0);
+	TestRng rng;
+	std::vector<double> interfaces(1, 3.0);
+	typedef ForwardFluxSampling<BirthDeathSIS, TestRng> ffs_t;
+	BOOST_CHECK_THROW(ffs_t(g, model, rng,
+					boost::bind(&BirthDeathSIS::infected, &model), interfaces),
+			std::invalid_argument);
+	interfaces.push_back(2.0);
+	BOOST_CHECK_THROW(ffs_t(g, model, rng,
+					boost::bind(&BirthDeathSIS::infected, &model), interfaces),
+			std::invalid_argument);
+	interfaces[1] = 8.0;
+	ffs_t ffs(g, model, rng, boost::bind(&BirthDeathSIS::infected, &model),
+			interfaces);
+	// 5 infected nodes are not in A
+	BOOST_CHECK_THROW(ffs.run(), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,150 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
+
+#include <largenet2/sim/event/NonMarkovianEpidemic.h>
+#include <largenet2.h>
+#include <largenet2/StateConsistencyListener.h>
+#include <limits>
+#include <memory>
+
+#include "test_rng.h"
+
+using namespace largenet;
+using namespace sim::event;
+
+typedef NonMarkovianEpidemic<TestRng> epidemic_t;
+
+enum SIRState { S, I, R };
+
+double constant(TestRng&, double value)
+{
+	return value;
+}
+
+double exponential(TestRng& rng, double mean)
+{
+	return rng.Exponential(mean);
+}
+
+struct InfectedEnds
+{
+	edge_state_t operator()(node_state_t a, node_state_t b) const
+	{
+		return (a == I) + (b == I);
+	}
+};
+
+BOOST_AUTO_TEST_SUITE( non_markovian_epidemic )
+
+BOOST_AUTO_TEST_CASE( deterministic_chain )
+{
+	// path 0 - 1 - 2 - 3 - 4, infection delay 1, infectious period 2.5
+	Graph g(3, 3);
+	StateConsistencyListener<InfectedEnds> scl(
+			std::auto_ptr<InfectedEnds>(new InfectedEnds));
+	g.addGraphListener(&scl);
+	for (unsigned int i = 0; i < 5; ++i)
+		g.addNode(S);
+	for (unsigned int i = 0; i < 4; ++i)
+		g.addEdge(i, i + 1, false);
+	g.setNodeState(0, I);
+
+	TestRng rng;
+	epidemic_t epi(g, rng, S, I, R, boost::bind(constant, _1, 1.0),
+			boost::bind(constant, _1, 2.5));
+	std::vector<double> infected(5, -1), recovered(5, -1);
+	infected[0] = 0;
+	double t = 0;
+	while (!epi.stopped())
+	{
+		t += epi.step();
+		BOOST_CHECK_CLOSE(t + 1, epi.time() + 1, 1e-9);
+		for (node_id_t n = 0; n < 5; ++n)
+		{
+			if (infected[n] < 0 && g.nodeState(n) == I)
+				infected[n] = epi.time();
+			if (recovered[n] < 0 && g.nodeState(n) == R)
+				recovered[n] = epi.time();
+		}
+		for (Graph::EdgeIterator e = g.edges().first; e != g.edges().second; ++e)
+			BOOST_CHECK_EQUAL(g.edgeState(e.id()),
+					InfectedEnds()(g.nodeState(e->source()->id()),
+							g.nodeState(e->target()->id())));
+	}
+	for (node_id_t n = 0; n < 5; ++n)
+	{
+		BOOST_CHECK_CLOSE(infected[n] + 1, n + 1.0, 1e-9);
+		BOOST_CHECK_CLOSE(recovered[n], n + 2.5, 1e-9);
+	}
+	BOOST_CHECK_EQUAL(g.numberOfNodes(R), 5);
+	BOOST_CHECK_EQUAL(epi.step(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE( external_changes_cancel_events )
+{
+	Graph g(3, 1);
+	g.addNode(I);
+	g.addNode(S);
+	g.addEdge(0, 1, true);
+	TestRng rng;
+	epidemic_t epi(g, rng, S, I, R, boost::bind(constant, _1, 1.0),
+			boost::bind(constant, _1, 10.0));
+	// cure node 0 externally: its transmission and recovery are cancelled
+	g.setNodeState(0, R);
+	BOOST_CHECK(epi.stopped());
+	BOOST_CHECK_EQUAL(epi.step(), 1000);
+	BOOST_CHECK_EQUAL(g.nodeState(1), S);
+	BOOST_CHECK_EQUAL(epi.events(), 0);
+
+	// removing the edge cancels transmission along it
+	g.setNodeState(0, I);
+	g.removeEdge(g.edges().first.id());
+	epi.step();
+	BOOST_CHECK_CLOSE(epi.time(), 10.0, 1e-9);
+	BOOST_CHECK_EQUAL(g.nodeState(1), S);
+	BOOST_CHECK_EQUAL(g.nodeState(0), R);
+
+	// new edges from infected nodes are used
+	g.setNodeState(0, I);
+	g.addEdge(0, 1, true);
+	epi.step();
+	BOOST_CHECK_CLOSE(epi.time(), 11.0, 1e-9);
+	BOOST_CHECK_EQUAL(g.nodeState(1), I);
+}
+
+BOOST_AUTO_TEST_CASE( markovian_limit )
+{
+	// independent infected-susceptible pairs, SIR with exponential times:
+	// each susceptible node is infected with probability beta / (beta + gamma)
+	const unsigned int pairs = 4000;
+	const double beta = 1.0, gamma = 3.0;
+	Graph g(3, 1);
+	for (unsigned int i = 0; i < pairs; ++i)
+		g.addEdge(g.addNode(I), g.addNode(S), false);
+	TestRng rng(11);
+	epidemic_t epi(g, rng, S, I, R, boost::bind(exponential, _1, 1.0 / beta),
+			boost::bind(exponential, _1, 1.0 / gamma));
+	while (!epi.stopped())
+		epi.step();
+	BOOST_CHECK_CLOSE((g.numberOfNodes(R) - pairs) / static_cast<double>(pairs),
+			beta / (beta + gamma), 8);
+}
+
+BOOST_AUTO_TEST_CASE( sis_no_recovery )
+{
+	Graph g(2, 1);
+	g.addNode(I);
+	g.addNode(S);
+	g.addEdge(0, 1, false);
+	TestRng rng;
+	// SIS: recovered state equals susceptible state; infinite recovery time
+	epidemic_t epi(g, rng, S, I, S, boost::bind(constant, _1, 0.5),
+			boost::bind(constant, _1, std::numeric_limits<double>::infinity()));
+	epi.step();
+	BOOST_CHECK_EQUAL(g.numberOfNodes(I), 2);
+	BOOST_CHECK(!epi.stopped());
+	BOOST_CHECK_THROW(epidemic_t(g, rng, S, S, R, boost::bind(constant, _1, 1.0),
+			boost::bind(constant, _1, 1.0)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,170 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/sweep/ParameterSweep.h>
+#include <vector>
+#include <cmath>
+#include "test_rng.h"
+
+using namespace sim::sweep;
+
+namespace
+{
+
+/// Immigration-death process with stationary mean p
+class ImmigrationDeath: public SweepReplica
+{
+public:
+	explicit ImmigrationDeath(unsigned long seed) :
+			rng_(seed), n_(0), p_(0)
+	{
+	}
+private:
+	void doSetParameter(double p)
+	{
+		p_ = p;
+	}
+	double doStep()
+	{
+		const double a = p_ + n_;
+		if (rng_.Uniform01() * a < p_)
+			++n_;
+		else
+			--n_;
+		return rng_.Exponential(1.0 / a);
+	}
+	void doObserve(std::vector<double>& values) const
+	{
+		values[0] = n_;
+	}
+	TestRng rng_;
+	unsigned int n_;
+	double p_;
+};
+
+SweepReplica* makeImmigrationDeath(unsigned int, unsigned long seed)
+{
+	return new ImmigrationDeath(seed);
+}
+
+/// Deterministic switch with hysteresis: on above 0.7, off below 0.3
+class Switch: public SweepReplica
+{
+public:
+	Switch() :
+			on_(false), p_(0)
+	{
+	}
+private:
+	void doSetParameter(double p)
+	{
+		p_ = p;
+	}
+	double doStep()
+	{
+		if (p_ > 0.7)
+			on_ = true;
+		else if (p_ < 0.3)
+			on_ = false;
+		return 1.0;
+	}
+	void doObserve(std::vector<double>& values) const
+	{
+		values[0] = on_;
+	}
+	bool on_;
+	double p_;
+};
+
+SweepReplica* makeSwitch(unsigned int, unsigned long)
+{
+	return new Switch;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( parameter_sweep )
+
+BOOST_AUTO_TEST_CASE( batch_means )
+{
+	std::vector<double> x;
+	for (unsigned int i = 0; i < 100; ++i)
+		x.push_back(i % 2);
+	double m, e;
+	sim::batchMeans(x, 0, 100, 10, m, e);
+	BOOST_CHECK_CLOSE(m, 0.5, 1e-9);
+	BOOST_CHECK_SMALL(e, 1e-12);
+	sim::batchMeans(x, 0, 0, 10, m, e);
+	BOOST_CHECK_EQUAL(m, 0);
+	// the remainder beyond the batches is left out of the mean
+	for (unsigned int i = 0; i < 11; ++i)
+		x[i] = i;
+	sim::batchMeans(x, 0, 11, 2, m, e);
+	BOOST_CHECK_CLOSE(m, 4.5, 1e-9);
+	BOOST_CHECK_CLOSE(e, 2.5, 1e-9);
+
+	BOOST_CHECK_EQUAL(sim::tQuantile975(19), 2.093);
+	BOOST_CHECK_CLOSE(sim::tQuantile975(30), 2.042, 0.05);
+	BOOST_CHECK_CLOSE(sim::tQuantile975(31), 2.040, 0.05);
+	BOOST_CHECK_CLOSE(sim::tQuantile975(120), 1.980, 0.05);
+	for (unsigned int i = 0; i < 100; ++i)
+		x[i] = i < 50 ? 0 : 1;
+	double h;
+	sim::batchMeansInterval(x, 0, 100, 2, m, h);
+	sim::batchMeans(x, 0, 100, 2, m, e);
+	BOOST_CHECK_CLOSE(h, 12.706 * e, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE( stationary_means )
+{
+	std::vector<double> p;
+	p.push_back(5);
+	p.push_back(10);
+	p.push_back(20);
+	ParameterSweep sweep(makeImmigrationDeath, 1, p, 0.5);
+	sweep.setThreads(2);
+	sweep.setDirection(ParameterSweep::Both);
+	sweep.setSamples(2000);
+	sweep.setWindow(50);
+	sweep.setSeed(3);
+	const std::vector<SweepPoint>& r = sweep.run();
+	BOOST_REQUIRE_EQUAL(r.size(), 6);
+	for (unsigned int i = 0; i < r.size(); ++i)
+	{
+		BOOST_CHECK_EQUAL(r[i].upward, i < 3);
+		BOOST_CHECK_EQUAL(r[i].parameter, i < 3 ? p[i] : p[5 - i]);
+		BOOST_CHECK(r[i].stationary);
+		BOOST_CHECK(r[i].error[0] > 0);
+		BOOST_CHECK_LT(std::fabs(r[i].mean[0] - r[i].parameter),
+				5 * r[i].error[0]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE( hysteresis_and_segments )
+{
+	std::vector<double> p;
+	p.push_back(0.0);
+	p.push_back(0.5);
+	p.push_back(1.0);
+	ParameterSweep sweep(makeSwitch, 1, p, 1.0);
+	sweep.setDirection(ParameterSweep::Both);
+	sweep.setSamples(10);
+	sweep.setWindow(10);
+	sweep.setThreads(3);
+	const std::vector<SweepPoint>& r = sweep.run();
+	BOOST_REQUIRE_EQUAL(r.size(), 6);
+	// up: 0, 0.5, 1 -> off, off, on; down: 1, 0.5, 0 -> on, on, off
+	const double expected[6] = { 0, 0, 1, 1, 1, 0 };
+	for (unsigned int i = 0; i < 6; ++i)
+	{
+		BOOST_CHECK_EQUAL(r[i].mean[0], expected[i]);
+		BOOST_CHECK(r[i].stationary);
+	}
+
+	// with one segment per point, every point starts from scratch
+	sweep.setSegments(3);
+	sweep.run();
+	BOOST_CHECK_EQUAL(r[1].mean[0], 0);
+	BOOST_CHECK_EQUAL(r[4].mean[0], 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
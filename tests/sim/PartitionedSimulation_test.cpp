@@ -0,0 +1,149 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/partitioned/PartitionedSimulation.h>
+#include <largenet2.h>
+#include <vector>
+#include <cmath>
+#include "test_rng.h"
+
+using namespace largenet;
+using namespace sim::partitioned;
+
+enum SISState
+{
+	S, I
+};
+
+/// SIS dynamics: infection along each SI link, recovery of I nodes
+struct SIS
+{
+	SIS(double beta, double mu) :
+			beta(beta), mu(mu)
+	{
+	}
+	double rate(node_state_t s, const unsigned int* nb) const
+	{
+		return s == I ? mu : beta * nb[I];
+	}
+	template<class RandomGen>
+	node_state_t transition(node_state_t s, const unsigned int*,
+			RandomGen&) const
+	{
+		return s == I ? S : I;
+	}
+	double beta, mu;
+};
+
+static void makeRing(Graph& g, unsigned int n, unsigned int infected)
+{
+	for (unsigned int i = 0; i < n; ++i)
+		g.addNode(i < infected ? I : S);
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		g.addEdge(i, (i + 1) % n, false);
+		g.addEdge(i, (i + 2) % n, false);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE( partitioned_simulation )
+
+BOOST_AUTO_TEST_CASE( partition_graph )
+{
+	Graph g(2, 1);
+	makeRing(g, 100, 0);
+	std::vector<unsigned int> owner;
+	partitionGraph(g, 4, owner);
+	BOOST_REQUIRE_EQUAL(owner.size(), 100);
+	std::vector<unsigned int> size(4, 0);
+	for (unsigned int i = 0; i < owner.size(); ++i)
+	{
+		BOOST_REQUIRE(owner[i] < 4);
+		++size[owner[i]];
+	}
+	for (unsigned int p = 0; p < 4; ++p)
+		BOOST_CHECK_EQUAL(size[p], 25);
+	BOOST_CHECK_THROW(partitionGraph(g, 0, owner), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE( pure_decay )
+{
+	const unsigned int N = 4000;
+	Graph g(2, 1);
+	makeRing(g, N, N);
+	PartitionedSimulation<SIS, TestRng> sim(g, SIS(0.0, 1.0), 4, 7);
+	BOOST_CHECK_EQUAL(sim.partitions(), 4);
+	sim.advance(1.0);
+	BOOST_CHECK_CLOSE(sim.time(), 1.0, 1e-9);
+	const double frac = static_cast<double>(g.numberOfNodes(I)) / N;
+	BOOST_CHECK_CLOSE(frac, std::exp(-1.0), 8.0);
+	sim.advance(50.0);
+	BOOST_CHECK(sim.stopped());
+	BOOST_CHECK_EQUAL(g.numberOfNodes(I), 0);
+	BOOST_CHECK_EQUAL(sim.events(), N);
+}
+
+BOOST_AUTO_TEST_CASE( deterministic_for_fixed_seed )
+{
+	std::vector<node_state_t> a, b;
+	unsigned long ea = 0, eb = 0;
+	for (unsigned int run = 0; run < 2; ++run)
+	{
+		Graph g(2, 1);
+		makeRing(g, 300, 30);
+		PartitionedSimulation<SIS, TestRng> sim(g, SIS(1.5, 1.0), 3, 11);
+		sim.setWindow(0.5);
+		sim.advance(4.0);
+		g.nodeStates(run == 0 ? a : b);
+		(run == 0 ? ea : eb) = sim.events();
+	}
+	BOOST_CHECK(a == b);
+	BOOST_CHECK_EQUAL(ea, eb);
+}
+
+BOOST_AUTO_TEST_CASE( equivalent_to_sequential )
+{
+	// mean prevalence with several partitions matches the sequential
+	// (single-partition) direct method
+	const unsigned int N = 120, runs = 150;
+	const double T = 1.5;
+	double mean[2] = { 0.0, 0.0 }, var[2] = { 0.0, 0.0 };
+	unsigned long rollbacks = 0;
+	const unsigned int parts[2] = { 1, 4 };
+	for (unsigned int k = 0; k < 2; ++k)
+	{
+		for (unsigned int r = 0; r < runs; ++r)
+		{
+			Graph g(2, 1);
+			makeRing(g, N, N / 4);
+			PartitionedSimulation<SIS, TestRng> sim(g, SIS(0.8, 1.0), parts[k],
+					1000 * k + r);
+			sim.advance(T);
+			const double x = g.numberOfNodes(I);
+			mean[k] += x;
+			var[k] += x * x;
+			if (k == 1)
+				rollbacks += sim.rollbacks();
+		}
+		mean[k] /= runs;
+		var[k] = var[k] / runs - mean[k] * mean[k];
+	}
+	// the optimistic synchronization has been exercised
+	BOOST_CHECK(rollbacks > 0);
+	const double se = std::sqrt((var[0] + var[1]) / runs);
+	BOOST_CHECK_LT(std::fabs(mean[0] - mean[1]), 4.0 * se);
+}
+
+BOOST_AUTO_TEST_CASE( refresh_after_external_change )
+{
+	Graph g(2, 1);
+	makeRing(g, 50, 0);
+	PartitionedSimulation<SIS, TestRng> sim(g, SIS(1.0, 1.0), 2);
+	sim.advance(1.0);
+	BOOST_CHECK(sim.stopped());
+	g.setNodeState(0, I);
+	sim.refresh();
+	BOOST_CHECK(!sim.stopped());
+	BOOST_CHECK_THROW(sim.setWindow(0.0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/random/PhiloxEngine.h>
+#include <vector>
+#include <set>
+
+using sim::random::PhiloxEngine;
+
+BOOST_AUTO_TEST_SUITE( philox_engine )
+
+BOOST_AUTO_TEST_CASE( known_answers )
+{
+	// test vectors of the Random123 distribution
+	const boost::uint32_t ctr0[4] = { 0, 0, 0, 0 }, key0[2] = { 0, 0 };
+	const boost::uint32_t ctr1[4] = { 0x243f6a88, 0x85a308d3, 0x13198a2e,
+			0x03707344 }, key1[2] = { 0xa4093822, 0x299f31d0 };
+	const boost::uint32_t out0[4] = { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c,
+			0x9b00dbd8 };
+	const boost::uint32_t out1[4] = { 0xd16cfe09, 0x94fdcceb, 0x5001e420,
+			0x24126ea1 };
+	boost::uint32_t out[4];
+	PhiloxEngine::block(ctr0, key0, out);
+	for (unsigned int i = 0; i < 4; ++i)
+		BOOST_CHECK_EQUAL(out[i], out0[i]);
+	PhiloxEngine::block(ctr1, key1, out);
+	for (unsigned int i = 0; i < 4; ++i)
+		BOOST_CHECK_EQUAL(out[i], out1[i]);
+
+	// seed 0, stream 0 starts with the block of counter 0
+	PhiloxEngine e;
+	for (unsigned int i = 0; i < 4; ++i)
+		BOOST_CHECK_EQUAL(e.next(), out0[i]);
+}
+
+BOOST_AUTO_TEST_CASE( discard_is_jump_ahead )
+{
+	PhiloxEngine a(7, 3), b(7, 3);
+	std::vector<boost::uint32_t> x;
+	for (unsigned int i = 0; i < 50; ++i)
+		x.push_back(a.next());
+	for (unsigned int skip = 0; skip < 13; ++skip)
+	{
+		b.setStream(3);
+		b.discard(skip);
+		BOOST_CHECK_EQUAL(b.next(), x[skip]);
+		// discarding from the middle of a block
+		b.discard(skip);
+		BOOST_CHECK_EQUAL(b.next(), x[2 * skip + 1]);
+	}
+	BOOST_CHECK_EQUAL(b.stream(), 3);
+}
+
+BOOST_AUTO_TEST_CASE( streams_and_seeds_differ )
+{
+	std::set<boost::uint32_t> first;
+	for (unsigned long s = 0; s < 4; ++s)
+		for (boost::uint64_t k = 0; k < 4; ++k)
+		{
+			PhiloxEngine e(s, k);
+			first.insert(e.next());
+		}
+	BOOST_CHECK_EQUAL(first.size(), 16);
+
+	PhiloxEngine e(5);
+	BOOST_CHECK_EQUAL(e.getSeed(), 5);
+	e.next();
+	e.seed(5);
+	PhiloxEngine f(5);
+	BOOST_CHECK_EQUAL(e.next(), f.next());
+}
+
+BOOST_AUTO_TEST_CASE( uniform_doubles )
+{
+	PhiloxEngine e(11, 1);
+	const unsigned int n = 100000;
+	double sum = 0;
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		const double u = e();
+		BOOST_REQUIRE(u > 0 && u < 1);
+		sum += u;
+	}
+	BOOST_CHECK_CLOSE(sum / n, 0.5, 1.0);
+}
+
+BOOST_AUTO_TEST_CASE( fill_matches_scalar )
+{
+	// from within a block, and across the carry of the block counter
+	const boost::uint64_t starts[] = { 0, 1, 2, 6, 4 * 0xFFFFFFF8ULL,
+			4 * 0xFFFFFFF8ULL + 2 };
+	for (unsigned int s = 0; s < sizeof(starts) / sizeof(starts[0]); ++s)
+	{
+		PhiloxEngine a(5, 2), b(5, 2);
+		a.discard(starts[s]);
+		b.discard(starts[s]);
+		std::vector<double> x(101);
+		a.fill(&x[0], x.size());
+		for (unsigned int i = 0; i < x.size(); ++i)
+			BOOST_REQUIRE_EQUAL(x[i], b());
+		BOOST_CHECK_EQUAL(a.next(), b.next());
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
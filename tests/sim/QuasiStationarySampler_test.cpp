@@ -0,0 +1,121 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/quasistationary/QuasiStationarySampler.h>
+#include <largenet2.h>
+#include <vector>
+#include <algorithm>
+#include "test_rng.h"
+
+using namespace largenet;
+using namespace sim::quasistationary;
+
+namespace
+{
+
+enum QSState
+{
+	QS_S, QS_I
+};
+
+/// SIS on a complete graph, reading its state from the graph
+class CompleteSIS
+{
+public:
+	CompleteSIS(Graph& g, double beta, double mu) :
+			g_(g), beta_(beta), mu_(mu)
+	{
+	}
+	bool stopped()
+	{
+		return g_.numberOfNodes(QS_I) == 0;
+	}
+	double step(TestRng& rng)
+	{
+		const double n = g_.numberOfNodes(QS_I), s = g_.numberOfNodes(QS_S);
+		const double b = beta_ * n * s, d = mu_ * n;
+		if (b + d == 0)
+			return 1000;
+		const double dt = rng.Exponential(1.0 / (b + d));
+		if (rng.Uniform01() * (b + d) < b)
+			g_.setNodeState(g_.nodes(QS_S).first.id(), QS_I);
+		else
+			g_.setNodeState(g_.nodes(QS_I).first.id(), QS_S);
+		return dt;
+	}
+private:
+	Graph& g_;
+	double beta_, mu_;
+};
+
+/// exact quasi-stationary mean by power iteration on the transient states
+double exactQSMean(unsigned int N, double beta, double mu)
+{
+	std::vector<double> b(N + 1), d(N + 1), p(N + 1, 1.0 / N), q(N + 1);
+	double lambda = 0;
+	for (unsigned int n = 1; n <= N; ++n)
+	{
+		b[n] = beta * n * (N - n);
+		d[n] = mu * n;
+		lambda = std::max(lambda, 1.01 * (b[n] + d[n]));
+	}
+	p[0] = 0;
+	for (unsigned int it = 0; it < 100000; ++it)
+	{
+		std::fill(q.begin(), q.end(), 0.0);
+		double norm = 0;
+		for (unsigned int n = 1; n <= N; ++n)
+		{
+			q[n] += p[n] * (1 - (b[n] + d[n]) / lambda);
+			if (n < N)
+				q[n + 1] += p[n] * b[n] / lambda;
+			if (n > 1)
+				q[n - 1] += p[n] * d[n] / lambda;
+		}
+		for (unsigned int n = 1; n <= N; ++n)
+			norm += q[n];
+		for (unsigned int n = 1; n <= N; ++n)
+			p[n] = q[n] / norm;
+	}
+	double mean = 0;
+	for (unsigned int n = 1; n <= N; ++n)
+		mean += n * p[n];
+	return mean;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( quasistationary_sampler )
+
+BOOST_AUTO_TEST_CASE( matches_exact_qs_distribution )
+{
+	const unsigned int N = 10;
+	const double beta = 0.15, mu = 1.0;
+	Graph g(2, 1);
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(i < N / 2 ? QS_I : QS_S);
+	CompleteSIS model(g, beta, mu);
+	TestRng rng(17);
+	QuasiStationarySampler<CompleteSIS, TestRng> qs(g, model, rng, 50, 0.5);
+	qs.advance(100);
+	BOOST_CHECK_EQUAL(qs.stored(), 50);
+	qs.resetAverages();
+	qs.advance(20100);
+	BOOST_CHECK(qs.reinjections() > 100);
+	BOOST_CHECK(!model.stopped());
+	BOOST_CHECK_CLOSE(qs.meanNodes(QS_I), exactQSMean(N, beta, mu), 4.0);
+	BOOST_CHECK_CLOSE(qs.meanNodes(QS_I) + qs.meanNodes(QS_S), N, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE( absorbing_without_stored_configuration )
+{
+	Graph g(2, 1);
+	g.addNode(QS_S);
+	CompleteSIS model(g, 1.0, 1.0);
+	TestRng rng;
+	QuasiStationarySampler<CompleteSIS, TestRng> qs(g, model, rng);
+	BOOST_CHECK_THROW(qs.step(), std::logic_error);
+	BOOST_CHECK_THROW((QuasiStationarySampler<CompleteSIS, TestRng>(g, model,
+							rng, 0)), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+#include <boost/test/unit_test.hpp>
+
+#include "../../examples/lib/RandomVariates.h"
+#include <largenet2/sim/random/PhiloxEngine.h>
+#include <vector>
+#include <cmath>
+
+typedef myrng::RandomVariates<sim::random::PhiloxEngine> rng_t;
+
+namespace
+{
+
+/// sample mean and variance of n draws of @p draw
+template<class Draw>
+void moments(rng_t& rng, Draw draw, unsigned int n, double& mean, double& var)
+{
+	double s = 0, s2 = 0;
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		const double x = (rng.*draw)();
+		s += x;
+		s2 += x * x;
+	}
+	mean = s / n;
+	var = s2 / n - mean * mean;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( random_variates )
+
+BOOST_AUTO_TEST_CASE( buffered_uniforms )
+{
+	rng_t a, b;
+	a.seed(9);
+	sim::random::PhiloxEngine e(9);
+	// buffering does not change the sequence
+	for (unsigned int i = 0; i < 3 * rng_t::BufferSize + 7; ++i)
+		BOOST_REQUIRE_EQUAL(a.Uniform01(), e());
+
+	// bulk generation matches scalar generation across refills
+	a.seed(4);
+	b.seed(4);
+	std::vector<double> x(1000);
+	b.Uniform01();
+	b.Uniform01(&x[1], x.size() - 1);
+	for (unsigned int i = 0; i < x.size(); ++i)
+	{
+		const double u = a.Uniform01();
+		if (i > 0)
+			BOOST_REQUIRE_EQUAL(u, x[i]);
+	}
+
+	// reseeding discards buffered numbers
+	a.seed(4);
+	b.seed(4);
+	BOOST_CHECK_EQUAL(a.Uniform01(), b.Uniform01());
+	a.seed(4);
+	BOOST_CHECK_EQUAL(a.Uniform01(), sim::random::PhiloxEngine(4)());
+}
+
+BOOST_AUTO_TEST_CASE( ziggurat_exponential )
+{
+	rng_t rng;
+	rng.seed(1);
+	const unsigned int n = 400000;
+	double s = 0, s2 = 0;
+	unsigned int tail = 0, below = 0;
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		const double x = rng.Exponential(2.0);
+		BOOST_REQUIRE(x >= 0);
+		s += x;
+		s2 += x * x;
+		if (x > 8.0)
+			++tail;
+		if (x < 0.2)
+			++below;
+	}
+	const double mean = s / n, var = s2 / n - mean * mean;
+	BOOST_CHECK_CLOSE(mean, 2.0, 1.0);
+	BOOST_CHECK_CLOSE(var, 4.0, 2.0);
+	// P(X > 8) = exp(-4), P(X < 0.2) = 1 - exp(-0.1)
+	BOOST_CHECK_CLOSE(tail / double(n), std::exp(-4.0), 5.0);
+	BOOST_CHECK_CLOSE(below / double(n), 1 - std::exp(-0.1), 2.0);
+
+	std::vector<double> y(10);
+	rng.Exponential(1.0, &y[0], y.size());
+	for (unsigned int i = 0; i < y.size(); ++i)
+		BOOST_CHECK(y[i] >= 0);
+}
+
+BOOST_AUTO_TEST_CASE( ziggurat_normal )
+{
+	rng_t rng;
+	rng.seed(2);
+	double mean, var;
+	moments(rng, &rng_t::Normal01, 400000, mean, var);
+	BOOST_CHECK_SMALL(mean, 0.01);
+	BOOST_CHECK_CLOSE(var, 1.0, 1.0);
+
+	// tail beyond the base strip, P(|X| > 3.7) = 2.156e-4
+	unsigned int tail = 0;
+	const unsigned int n = 2000000;
+	for (unsigned int i = 0; i < n; ++i)
+		if (std::fabs(rng.Normal01()) > 3.7)
+			++tail;
+	BOOST_CHECK_CLOSE(tail / double(n), 2.156e-4, 10.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
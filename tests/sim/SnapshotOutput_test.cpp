@@ -0,0 +1,167 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/output/SnapshotOutput.h>
+#include <largenet2.h>
+#include <boost/scoped_ptr.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "test_rng.h"
+
+using namespace sim::output;
+
+namespace
+{
+
+void checkEqual(const ArchivedSnapshot& a, const ArchivedSnapshot& b)
+{
+	BOOST_CHECK_EQUAL(a.nodeStates, b.nodeStates);
+	BOOST_CHECK_EQUAL(a.edgeStates, b.edgeStates);
+	BOOST_REQUIRE_EQUAL(a.nodes.size(), b.nodes.size());
+	for (std::size_t i = 0; i < a.nodes.size(); ++i)
+	{
+		BOOST_CHECK_EQUAL(a.nodes[i].id, b.nodes[i].id);
+		BOOST_CHECK_EQUAL(a.nodes[i].state, b.nodes[i].state);
+	}
+	BOOST_REQUIRE_EQUAL(a.edges.size(), b.edges.size());
+	for (std::size_t i = 0; i < a.edges.size(); ++i)
+	{
+		BOOST_CHECK_EQUAL(a.edges[i].source, b.edges[i].source);
+		BOOST_CHECK_EQUAL(a.edges[i].target, b.edges[i].target);
+		BOOST_CHECK_EQUAL(a.edges[i].state, b.edges[i].state);
+		BOOST_CHECK_EQUAL(a.edges[i].directed, b.edges[i].directed);
+	}
+}
+
+/// Evolve a random graph, writing a snapshot per time unit
+std::string simulate(bool delta, std::vector<ArchivedSnapshot>& expected)
+{
+	TestRng rng(11);
+	const unsigned int N = 50;
+	largenet::Graph g(3, 2);
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(rng.IntFromTo(0u, 2u));
+	std::ostringstream s;
+	SnapshotOutput out(s, g, 1.0, delta, 4);
+	out.writeHeader();
+	expected.clear();
+	for (unsigned int t = 0; t < 30; ++t)
+	{
+		out.output(t);
+		expected.push_back(ArchivedSnapshot());
+		expected.back().capture(g);
+		for (unsigned int k = 0; k < 20; ++k)
+		{
+			const largenet::node_id_t u = rng.IntFromTo<largenet::node_id_t>(0,
+					N - 1), v = rng.IntFromTo<largenet::node_id_t>(0, N - 1);
+			const double r = rng.Uniform01();
+			if (r < 0.4)
+			{
+				if (u != v && !g.adjacent(u, v))
+				{
+					const largenet::edge_id_t e = g.addEdge(u, v, k % 3 == 0);
+					g.setEdgeState(e, k % 2);
+				}
+			}
+			else if (r < 0.6)
+			{
+				if (g.numberOfEdges() > 0)
+					g.removeEdge(g.randomEdge(rng)->id());
+			}
+			else
+				g.setNodeState(u, rng.IntFromTo(0u, 2u));
+		}
+	}
+	out.finish();
+	return s.str();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( snapshot_output )
+
+BOOST_AUTO_TEST_CASE( random_access )
+{
+	std::vector<ArchivedSnapshot> expected;
+	const std::string packed = simulate(true, expected);
+	std::istringstream in(packed);
+	SnapshotArchiveReader r(in);
+	BOOST_REQUIRE_EQUAL(r.size(), expected.size());
+	BOOST_CHECK_EQUAL(r.time(7), 7);
+	BOOST_CHECK_EQUAL(r.find(7.5), 7);
+	BOOST_CHECK_EQUAL(r.find(-1), r.size());
+	// backwards, forwards, and across key frames
+	const std::size_t order[] = { 29, 3, 4, 5, 13, 12, 0, 17, 18, 19, 20 };
+	for (unsigned int i = 0; i < sizeof(order) / sizeof(order[0]); ++i)
+		checkEqual(r.read(order[i]), expected[order[i]]);
+	BOOST_CHECK_THROW(r.read(30), std::out_of_range);
+
+	boost::scoped_ptr<largenet::Graph> g(r.createGraph(29));
+	BOOST_CHECK_EQUAL(g->numberOfNodes(), 50);
+	ArchivedSnapshot copy;
+	copy.capture(*g);
+	checkEqual(copy, expected[29]);
+
+	std::vector<ArchivedSnapshot> again;
+	const std::string full = simulate(false, again);
+	BOOST_CHECK(packed.size() < full.size());
+	std::istringstream fin(full);
+	SnapshotArchiveReader fr(fin);
+	BOOST_REQUIRE_EQUAL(fr.size(), again.size());
+	checkEqual(fr.read(21), again[21]);
+}
+
+BOOST_AUTO_TEST_CASE( missing_index )
+{
+	std::vector<ArchivedSnapshot> expected;
+	const std::string packed = simulate(true, expected);
+	// drop the index and part of the last record
+	std::string cut = packed.substr(0, packed.size() - 30 * 24 - 20 - 10);
+	std::istringstream in(cut);
+	SnapshotArchiveReader r(in);
+	BOOST_REQUIRE_EQUAL(r.size(), 29);
+	checkEqual(r.read(28), expected[28]);
+
+	std::istringstream bad("LNTS....");
+	BOOST_CHECK_THROW(SnapshotArchiveReader x(bad), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( parallel_edges )
+{
+	largenet::Graph g(1, 2);
+	g.setElementFactory(std::auto_ptr<largenet::ElementFactory>(
+			new largenet::MultiEdgeElementFactory));
+	for (unsigned int i = 0; i < 3; ++i)
+		g.addNode();
+	const largenet::edge_id_t e = g.addEdge(0, 1, true);
+	g.addEdge(0, 1, true);
+	const largenet::edge_id_t f = g.addEdge(0, 1, true);
+	g.setEdgeState(f, 1);
+	g.addEdge(1, 2, true);
+	std::vector<ArchivedSnapshot> expected(3);
+	std::ostringstream s;
+	{
+		SnapshotArchiveWriter w(s, true, 10);
+		w.append(0, g);
+		expected[0].capture(g);
+		g.removeEdge(e);
+		w.append(1, g);
+		expected[1].capture(g);
+		g.addEdge(0, 1, true);
+		g.addEdge(0, 1, true);
+		g.removeEdge(f);
+		w.append(2, g);
+		expected[2].capture(g);
+		w.finish();
+	}
+	std::istringstream in(s.str());
+	SnapshotArchiveReader r(in);
+	BOOST_REQUIRE_EQUAL(r.size(), 3);
+	BOOST_CHECK_EQUAL(r.read(1).edges.size(), 3);
+	for (std::size_t i = 0; i < expected.size(); ++i)
+		checkEqual(r.read(i), expected[i]);
+	BOOST_CHECK_EQUAL(r.read(2).edges.size(), 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,72 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
+
+#include <largenet2/sim/gillespie/DirectMethod.h>
+#include <largenet2/sim/gillespie/StaticDirectMethod.h>
+#include <vector>
+
+#include "test_rng.h"
+
+using namespace sim::gillespie;
+
+class ConstantProcess
+{
+public:
+	ConstantProcess() : rate_(0), id_(0), log_(0) {}
+	ConstantProcess(double rate, unsigned int id, std::vector<unsigned int>& log) :
+		rate_(rate), id_(id), log_(&log) {}
+	double rate() const { return rate_; }
+	void operator()() { log_->push_back(id_); }
+private:
+	double rate_;
+	unsigned int id_;
+	std::vector<unsigned int>* log_;
+};
+
+BOOST_AUTO_TEST_SUITE( static_direct_method )
+
+BOOST_AUTO_TEST_CASE( zero_rates )
+{
+	std::vector<unsigned int> log;
+	StaticDirectMethod<ConstantProcess, ConstantProcess> stepper(
+			boost::make_tuple(ConstantProcess(0, 0, log),
+					ConstantProcess(0, 1, log)));
+	TestRng rng;
+	BOOST_CHECK_EQUAL(stepper.countReactions(), 2);
+	BOOST_CHECK_EQUAL(stepper.step(rng), 1000);
+	BOOST_CHECK(log.empty());
+}
+
+BOOST_AUTO_TEST_CASE( same_as_direct_method )
+{
+	std::vector<unsigned int> staticLog, dynamicLog;
+	ConstantProcess a(0.5, 0, staticLog), b(2.0, 1, staticLog), c(1.5, 2, staticLog);
+	StaticDirectMethod<ConstantProcess, ConstantProcess, ConstantProcess> stepper(
+			boost::make_tuple(a, b, c));
+
+	ConstantProcess da(0.5, 0, dynamicLog), db(2.0, 1, dynamicLog), dc(1.5, 2, dynamicLog);
+	DirectMethod dm;
+	dm.registerProcess(boost::bind(&ConstantProcess::rate, &da), da);
+	dm.registerProcess(boost::bind(&ConstantProcess::rate, &db), db);
+	dm.registerProcess(boost::bind(&ConstantProcess::rate, &dc), dc);
+
+	TestRng rng1(42), rng2(42);
+	double t1 = 0, t2 = 0;
+	for (unsigned int i = 0; i < 10000; ++i)
+	{
+		t1 += stepper.step(rng1);
+		t2 += dm.step(rng2);
+	}
+	BOOST_CHECK_CLOSE(t1, t2, 1e-9);
+	BOOST_CHECK(staticLog == dynamicLog);
+
+	// relative frequencies follow the rates
+	unsigned int counts[3] = { 0, 0, 0 };
+	for (std::vector<unsigned int>::const_iterator it = staticLog.begin(); it
+			!= staticLog.end(); ++it)
+		++counts[*it];
+	BOOST_CHECK_CLOSE(counts[1] / static_cast<double>(staticLog.size()), 0.5, 5);
+	BOOST_CHECK_CLOSE(counts[2] / static_cast<double>(staticLog.size()), 0.375, 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
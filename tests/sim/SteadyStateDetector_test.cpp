@@ -0,0 +1,80 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/output/SteadyStateDetector.h>
+#include <largenet2/sim/output/Outputter.h>
+#include <largenet2.h>
+#include <sstream>
+#include <cmath>
+#include "test_rng.h"
+
+using namespace sim::output;
+
+namespace
+{
+/// relaxation towards 50 with uniform noise
+struct Relaxing
+{
+	Relaxing(const double& t, TestRng& rng) :
+			t(t), rng(rng)
+	{
+	}
+	double operator()() const
+	{
+		return 50 + 100 * std::exp(-t / 10) + 4 * (rng.Uniform01() - 0.5);
+	}
+	const double& t;
+	TestRng& rng;
+};
+}
+
+BOOST_AUTO_TEST_SUITE( steady_state_detector )
+
+BOOST_AUTO_TEST_CASE( detects_end_of_transient )
+{
+	std::ostringstream report;
+	double t = 0;
+	TestRng rng(5);
+	SteadyStateDetector ssd(report, 0.5);
+	ssd.addObservable("x", Relaxing(t, rng));
+	ssd.setPrecision(0.002);
+	ssd.writeHeader();
+	for (; t < 10000 && !ssd.stopRequested(); t += 0.1)
+		ssd.output(t);
+	BOOST_REQUIRE(ssd.converged());
+	BOOST_CHECK_EQUAL(ssd.observables(), 1);
+	BOOST_CHECK_EQUAL(ssd.name(0), "x");
+	BOOST_CHECK(ssd.warmupTime() > 20);
+	BOOST_CHECK(ssd.convergenceTime() > ssd.warmupTime());
+	BOOST_CHECK(ssd.halfWidth(0) <= 0.1);
+	BOOST_CHECK_LT(std::fabs(ssd.mean(0) - 50), 0.2);
+	BOOST_CHECK(report.str().find("steady state at") != std::string::npos);
+	BOOST_CHECK_THROW(ssd.addObservable("y", Relaxing(t, rng)),
+			std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE( outputter_stop_request )
+{
+	largenet::Graph g(2, 3);
+	for (unsigned int i = 0; i < 10; ++i)
+		g.addNode(i % 2);
+	std::ostringstream report;
+	Outputter out;
+	SteadyStateDetector* ssd = new SteadyStateDetector(report, g, 1.0);
+	out.addOutput(ssd);
+	BOOST_CHECK_EQUAL(ssd->observables(), 5);
+	BOOST_CHECK_EQUAL(ssd->name(1), "n1");
+	BOOST_CHECK_EQUAL(ssd->name(2), "e0");
+	double t = 0;
+	// constant observables converge after the minimum of 20 batches
+	while (!out.stopRequested() && t < 1000)
+	{
+		out.output(t);
+		t += 0.25;
+	}
+	BOOST_CHECK(out.stopRequested());
+	BOOST_CHECK_CLOSE(ssd->mean(0), 5.0, 1e-9);
+	BOOST_CHECK_EQUAL(ssd->halfWidth(0), 0);
+	BOOST_CHECK(t < 110);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
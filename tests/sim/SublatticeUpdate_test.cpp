@@ -0,0 +1,119 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2.h>
+#include <largenet2/generators/lattice.h>
+#include <largenet2/sim/synchronous/SublatticeUpdate.h>
+#include <vector>
+#include <cmath>
+#include "test_rng.h"
+
+using namespace largenet;
+using namespace largenet::generators;
+using namespace sim::synchronous;
+
+/// Site becomes 0 with probability p
+struct Decay
+{
+	explicit Decay(double p) :
+			p(p)
+	{
+	}
+	template<class Range, class RandomGen>
+	node_state_t operator()(node_id_t n, Range,
+			const std::vector<node_state_t>& s, RandomGen& rng) const
+	{
+		return s[n] == 1 && rng.Uniform01() < p ? 0 : s[n];
+	}
+	double p;
+};
+
+/// Deterministic rule: count neighbors in state 1 (modulo 3)
+struct CountOnes
+{
+	template<class Range, class RandomGen>
+	node_state_t operator()(node_id_t, Range nb,
+			const std::vector<node_state_t>& s, RandomGen&) const
+	{
+		unsigned int k = 0;
+		for (const node_id_t* i = nb.first; i != nb.second; ++i)
+			k += s[*i] == 1;
+		return k % 3;
+	}
+};
+
+BOOST_AUTO_TEST_SUITE( sublattice_update )
+
+BOOST_AUTO_TEST_CASE( coloring_is_proper )
+{
+	Graph g(3, 1);
+	mooreLattice2DPeriodic(g, 8, 10);
+	SublatticeUpdate<CountOnes, TestRng> moore(g, 8, 10, Moore, true,
+			CountOnes(), 1);
+	BOOST_CHECK_EQUAL(moore.colors(), 4);
+	Graph::EdgeIteratorRange edges = g.edges();
+	for (Graph::EdgeIterator e = edges.first; e != edges.second; ++e)
+		BOOST_CHECK_NE(moore.color(e->source()->id()),
+				moore.color(e->target()->id()));
+
+	Graph h(3, 1);
+	vonNeumannLattice2D(h, 7, 5);
+	SublatticeUpdate<CountOnes, TestRng> vn(h, 7, 5, VonNeumann, false,
+			CountOnes(), 1);
+	BOOST_CHECK_EQUAL(vn.colors(), 2);
+	edges = h.edges();
+	for (Graph::EdgeIterator e = edges.first; e != edges.second; ++e)
+		BOOST_CHECK_NE(vn.color(e->source()->id()),
+				vn.color(e->target()->id()));
+
+	// odd periodic lattices cannot be colored this way
+	Graph odd(3, 1);
+	vonNeumannLattice2DPeriodic(odd, 5, 6);
+	BOOST_CHECK_THROW((SublatticeUpdate<CountOnes, TestRng>(odd, 5, 6,
+							VonNeumann, true, CountOnes())), std::invalid_argument);
+	BOOST_CHECK_THROW((SublatticeUpdate<CountOnes, TestRng>(odd, 6, 6,
+							VonNeumann, true, CountOnes())), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE( independent_of_thread_count )
+{
+	// a deterministic rule gives the same result for any number of threads
+	const unsigned int L = 12;
+	std::vector<node_state_t> ref(L * L);
+	for (unsigned int i = 0; i < L * L; ++i)
+		ref[i] = (i * 7 + i / 5) % 3 == 0;
+
+	std::vector<node_state_t> result[2];
+	const unsigned int threads[2] = { 1, 4 };
+	for (unsigned int k = 0; k < 2; ++k)
+	{
+		Graph g(3, 1);
+		mooreLattice2DPeriodic(g, L, L);
+		for (unsigned int i = 0; i < L * L; ++i)
+			g.setNodeState(i, ref[i]);
+		SublatticeUpdate<CountOnes, TestRng> sim(g, L, L, Moore, true,
+				CountOnes(), threads[k], 5);
+		BOOST_CHECK_EQUAL(sim.threads(), threads[k]);
+		sim.sweep(3);
+		BOOST_CHECK_EQUAL(sim.sweeps(), 3);
+		g.nodeStates(result[k]);
+	}
+	BOOST_CHECK(result[0] == result[1]);
+}
+
+BOOST_AUTO_TEST_CASE( independent_decay )
+{
+	const unsigned int L = 100;
+	Graph g(2, 1);
+	vonNeumannLattice2DPeriodic(g, L, L);
+	for (unsigned int i = 0; i < L * L; ++i)
+		g.setNodeState(i, 1);
+	SublatticeUpdate<Decay, TestRng> sim(g, L, L, VonNeumann, true, Decay(0.1),
+			3, 9);
+	const node_size_t changed = sim.sweep(5);
+	BOOST_CHECK_EQUAL(changed, L * L - g.numberOfNodes(1));
+	// each site is updated exactly once per sweep
+	BOOST_CHECK_CLOSE(static_cast<double>(g.numberOfNodes(1)) / (L * L),
+			std::pow(0.9, 5), 4.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/synchronous/SynchronousUpdate.h>
+#include <largenet2.h>
+#include <largenet2/StateConsistencyListener.h>
+#include <vector>
+#include <memory>
+
+using namespace largenet;
+using namespace sim::synchronous;
+
+/// Copy the state of the (single) predecessor
+struct Shift
+{
+	template<class Range>
+	node_state_t operator()(node_id_t n, Range nb,
+			const std::vector<node_state_t>& s, unsigned int) const
+	{
+		return nb.first == nb.second ? s[n] : s[*nb.first];
+	}
+};
+
+/// Two-state majority rule, keeping the state on ties
+struct Majority
+{
+	template<class Range>
+	node_state_t operator()(node_id_t n, Range nb,
+			const std::vector<node_state_t>& s, unsigned int) const
+	{
+		int up = 0;
+		for (const node_id_t* i = nb.first; i != nb.second; ++i)
+			up += s[*i] == 1 ? 1 : -1;
+		return up > 0 ? 1 : (up < 0 ? 0 : s[n]);
+	}
+};
+
+struct PairState
+{
+	edge_state_t operator()(node_state_t a, node_state_t b) const
+	{
+		return a + b;
+	}
+};
+
+BOOST_AUTO_TEST_SUITE( synchronous_update )
+
+BOOST_AUTO_TEST_CASE( directed_ring_shift )
+{
+	const unsigned int N = 100;
+	Graph g(2, 1);
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(i < 10 ? 1 : 0);
+	for (unsigned int i = 0; i < N; ++i)
+		g.addEdge(i, (i + 1) % N, true);
+
+	SynchronousUpdate<Shift> sync(g, Shift(), 3);
+	BOOST_CHECK_EQUAL(sync.step(), 2);
+	for (unsigned int k = 1; k < 25; ++k)
+		sync.step();
+	// the block of ones has moved by 25 nodes
+	for (unsigned int i = 0; i < N; ++i)
+		BOOST_CHECK_EQUAL(g.nodeState(i), (i >= 25 && i < 35) ? 1u : 0u);
+	BOOST_CHECK_EQUAL(g.numberOfNodes(1), 10);
+}
+
+BOOST_AUTO_TEST_CASE( majority_consistent_edges )
+{
+	// 2D periodic lattice with a pseudo-random initial pattern
+	const unsigned int L = 30;
+	Graph g(2, 3), ref(2, 3);
+	StateConsistencyListener<PairState> scl(std::auto_ptr<PairState>(new PairState)),
+			scl2(std::auto_ptr<PairState>(new PairState));
+	g.addGraphListener(&scl);
+	ref.addGraphListener(&scl2);
+	unsigned long x = 12345;
+	for (unsigned int i = 0; i < L * L; ++i)
+	{
+		x = x * 1103515245 + 12345;
+		const node_state_t s = (x >> 16) % 2;
+		g.addNode(s);
+		ref.addNode(s);
+	}
+	for (unsigned int i = 0; i < L; ++i)
+		for (unsigned int j = 0; j < L; ++j)
+		{
+			g.addEdge(i * L + j, i * L + (j + 1) % L, false);
+			g.addEdge(i * L + j, ((i + 1) % L) * L + j, false);
+			ref.addEdge(i * L + j, i * L + (j + 1) % L, false);
+			ref.addEdge(i * L + j, ((i + 1) % L) * L + j, false);
+		}
+
+	SynchronousUpdate<Majority> sync(g, Majority(), 4);
+	SynchronousUpdate<Majority> serial(ref, Majority(), 1);
+	for (unsigned int k = 0; k < 5; ++k)
+	{
+		sync.step();
+		// reference: same rule, committed node by node
+		std::vector<node_state_t> prev;
+		ref.nodeStates(prev);
+		serial.refresh();
+		Majority m;
+		std::vector<node_state_t> next(prev);
+		for (Graph::NodeIterator n = ref.nodes().first; n != ref.nodes().second; ++n)
+		{
+			std::vector<node_id_t> nb;
+			Node::UndirectedNeighborIteratorRange r = n->undirectedNeighbors();
+			for (Node::UndirectedNeighborIterator i = r.first; i != r.second; ++i)
+				nb.push_back(i.id());
+			next[n.id()] = m(n.id(), std::make_pair(&nb[0], &nb[0] + nb.size()), prev, 0);
+		}
+		for (node_id_t i = 0; i < next.size(); ++i)
+			ref.setNodeState(i, next[i]);
+
+		for (node_id_t i = 0; i < L * L; ++i)
+			BOOST_CHECK_EQUAL(g.nodeState(i), ref.nodeState(i));
+		for (edge_state_t s = 0; s < 3; ++s)
+			BOOST_CHECK_EQUAL(g.numberOfEdges(s), ref.numberOfEdges(s));
+		for (Graph::EdgeIterator e = g.edges().first; e != g.edges().second; ++e)
+			BOOST_CHECK_EQUAL(g.edgeState(e.id()),
+					g.nodeState(e->source()->id()) + g.nodeState(e->target()->id()));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
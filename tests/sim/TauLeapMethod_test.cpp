@@ -0,0 +1,198 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
+
+#include <largenet2/sim/gillespie/TauLeapMethod.h>
+#include <largenet2/sim/gillespie/GraphBatch.h>
+#include <largenet2.h>
+#include <largenet2/StateConsistencyListener.h>
+#include <cmath>
+#include <memory>
+
+#include "test_rng.h"
+
+using namespace sim::gillespie;
+
+/// Pure decay X -> 0 with rate c*X
+class Decay
+{
+public:
+	Decay(double c, long x) : c_(c), x_(x) {}
+	double rate() const { return c_ * x_; }
+	void fire() { --x_; }
+	void fireBatch(unsigned long k)
+	{
+		x_ -= std::min(static_cast<long>(k), x_);
+	}
+	double population() const { return x_; }
+	long x() const { return x_; }
+private:
+	double c_;
+	long x_;
+};
+
+/// SIS node and edge states
+enum NodeState { S, I };
+enum EdgeState { SS, SI, II };
+
+struct SISEdgeState
+{
+	largenet::edge_state_t operator()(largenet::node_state_t s,
+			largenet::node_state_t t) const
+	{
+		return s != t ? SI : (s == S ? SS : II);
+	}
+};
+
+/// Set a node to state @p s
+struct SetState
+{
+	SetState(largenet::Graph& g, largenet::node_state_t s) : g_(g), s_(s) {}
+	void operator()(largenet::node_id_t n) { g_.setNodeState(n, s_); }
+	largenet::Graph& g_;
+	largenet::node_state_t s_;
+};
+
+/// Infect the susceptible end of an SI edge
+struct Infect
+{
+	explicit Infect(largenet::Graph& g) : g_(g) {}
+	void operator()(largenet::edge_id_t e)
+	{
+		const largenet::Edge* edge = g_.edge(e);
+		const largenet::node_id_t n = g_.nodeState(edge->source()->id()) == S ?
+				edge->source()->id() : edge->target()->id();
+		g_.setNodeState(n, I);
+	}
+	largenet::Graph& g_;
+};
+
+BOOST_AUTO_TEST_SUITE( tau_leap_method )
+
+BOOST_AUTO_TEST_CASE( zero_rates )
+{
+	Decay d(1.0, 0);
+	TauLeapMethod stepper;
+	stepper.registerProcess(boost::bind(&Decay::rate, &d), boost::bind(&Decay::fire, &d));
+	TestRng rng;
+	BOOST_CHECK_EQUAL(stepper.countReactions(), 1);
+	BOOST_CHECK_EQUAL(stepper.step(rng), 1000);
+}
+
+BOOST_AUTO_TEST_CASE( exact_without_species )
+{
+	Decay d(1.0, 1000);
+	TauLeapMethod stepper;
+	stepper.registerProcess(boost::bind(&Decay::rate, &d), boost::bind(&Decay::fire, &d));
+	TestRng rng;
+	stepper.step(rng);
+	BOOST_CHECK(!stepper.lastStepWasLeap());
+	BOOST_CHECK_EQUAL(d.x(), 999);
+}
+
+BOOST_AUTO_TEST_CASE( invalid_state_change )
+{
+	TauLeapMethod stepper;
+	BOOST_CHECK_THROW(stepper.setStateChange(0, 0, -1), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE( decay_mean )
+{
+	const long x0 = 1000000;
+	Decay d(1.0, x0);
+	TauLeapMethod stepper(0.03);
+	unsigned int s = stepper.registerSpecies(boost::bind(&Decay::population, &d));
+	unsigned int p = stepper.registerProcess(boost::bind(&Decay::rate, &d),
+			boost::bind(&Decay::fire, &d), boost::bind(&Decay::fireBatch, &d, _1));
+	stepper.setStateChange(p, s, -1);
+
+	TestRng rng(7);
+	double t = 0;
+	unsigned int steps = 0, leaps = 0;
+	while (t < 1.0)
+	{
+		t += stepper.step(rng);
+		++steps;
+		if (stepper.lastStepWasLeap())
+			++leaps;
+	}
+	// the leap size keeps the relative change per step near epsilon,
+	// so far fewer than x0 steps are needed
+	BOOST_CHECK(steps < 200);
+	BOOST_CHECK_EQUAL(steps, leaps);
+	BOOST_CHECK_CLOSE(d.x() / (x0 * std::exp(-t)), 1.0, 3);
+}
+
+BOOST_AUTO_TEST_CASE( falls_back_to_exact_steps )
+{
+	Decay d(1.0, 20);
+	TauLeapMethod stepper;
+	unsigned int s = stepper.registerSpecies(boost::bind(&Decay::population, &d));
+	unsigned int p = stepper.registerProcess(boost::bind(&Decay::rate, &d),
+			boost::bind(&Decay::fire, &d));
+	stepper.setStateChange(p, s, -1);
+	TestRng rng(3);
+	for (long i = 20; i > 0; --i)
+	{
+		stepper.step(rng);
+		BOOST_CHECK(!stepper.lastStepWasLeap());
+		BOOST_CHECK_EQUAL(d.x(), i - 1);
+	}
+	BOOST_CHECK_EQUAL(stepper.step(rng), 1000);
+}
+
+BOOST_AUTO_TEST_CASE( graph_batches )
+{
+	// star with a susceptible centre and infected leaves
+	largenet::Graph g(2, 3);
+	largenet::StateConsistencyListener<SISEdgeState> scl(std::auto_ptr<
+			SISEdgeState>(new SISEdgeState));
+	g.addGraphListener(&scl);
+	g.addNode(S);
+	for (unsigned int i = 1; i <= 10; ++i)
+		g.addEdge(0, g.addNode(I), false);
+	BOOST_REQUIRE_EQUAL(g.numberOfEdges(SI), 10);
+	TestRng rng(5);
+
+	// the first infection turns all other SI edges into II edges
+	BOOST_CHECK_EQUAL(sim::gillespie::edgeBatch(g, SI, rng, Infect(g))(5), 1);
+	BOOST_CHECK_EQUAL(g.numberOfEdges(II), 10);
+
+	sim::gillespie::NodeBatch<TestRng, SetState> recover =
+			sim::gillespie::nodeBatch(g, I, rng, SetState(g, S));
+	BOOST_CHECK_EQUAL(recover(4), 4);
+	BOOST_CHECK_EQUAL(g.numberOfNodes(I), 7);
+	BOOST_CHECK_EQUAL(recover(100), 7);
+	BOOST_CHECK_EQUAL(g.numberOfNodes(I), 0);
+	BOOST_CHECK_EQUAL(recover(1), 0);
+}
+
+BOOST_AUTO_TEST_CASE( graph_batch_leaps )
+{
+	const unsigned int N = 100000;
+	largenet::Graph g(2, 1);
+	for (unsigned int i = 0; i < N; ++i)
+		g.addNode(I);
+	TestRng rng(7);
+	typedef largenet::node_size_t (largenet::Graph::*Count)(
+			largenet::node_state_t) const;
+	const Count count = &largenet::Graph::numberOfNodes;
+	TauLeapMethod stepper(0.03);
+	unsigned int s = stepper.registerSpecies(boost::bind(count, &g, I));
+	unsigned int p = stepper.registerProcess(boost::bind(count, &g, I),
+			TauLeapMethod::ProcFunctor(), sim::gillespie::nodeBatch(g, I, rng,
+					SetState(g, S)));
+	stepper.setStateChange(p, s, -1);
+
+	double t = 0;
+	unsigned int steps = 0;
+	while (t < 1.0)
+	{
+		t += stepper.step(rng);
+		++steps;
+		BOOST_REQUIRE(stepper.lastStepWasLeap());
+	}
+	BOOST_CHECK(steps < 200);
+	BOOST_CHECK_CLOSE(g.numberOfNodes(I) / (N * std::exp(-t)), 1.0, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
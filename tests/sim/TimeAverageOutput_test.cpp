@@ -0,0 +1,101 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/output/TimeAverageOutput.h>
+#include <largenet2.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace sim::output;
+
+namespace
+{
+
+std::vector<std::vector<double> > parse(const std::string& s)
+{
+	std::vector<std::vector<double> > lines;
+	std::istringstream in(s);
+	std::string line;
+	while (std::getline(in, line))
+	{
+		if (line.empty() || line[0] == '#')
+			continue;
+		std::istringstream l(line);
+		std::vector<double> v;
+		double x;
+		while (l >> x)
+			v.push_back(x);
+		lines.push_back(v);
+	}
+	return lines;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( time_average_output )
+
+BOOST_AUTO_TEST_CASE( piecewise_constant_counts )
+{
+	largenet::Graph g(2, 1);
+	g.addNode(0);
+	g.addNode(0);
+	std::ostringstream s;
+	TimeAverageOutput out(s, g, 1.0);
+	BOOST_CHECK_EQUAL(out.observables(), 3);
+	out.writeHeader();
+	BOOST_CHECK(s.str().find("n1_mean\tn1_var\tn1_min\tn1_max") != std::string::npos);
+
+	out.output(0);
+	g.setNodeState(0, 1);
+	out.output(0.5);
+	g.setNodeState(1, 1);
+	out.output(1.5);
+	out.output(2.25);
+	out.output(2.5, true);
+
+	const std::vector<std::vector<double> > r = parse(s.str());
+	BOOST_REQUIRE_EQUAL(r.size(), 3);
+	// columns: t, then mean, var, min, max of n0, n1, e0
+	BOOST_REQUIRE_EQUAL(r[0].size(), 13);
+	BOOST_CHECK_EQUAL(r[0][0], 1.0);
+	BOOST_CHECK_CLOSE(r[0][1], 1.5, 1e-9);
+	BOOST_CHECK_CLOSE(r[0][2], 0.25, 1e-9);
+	BOOST_CHECK_EQUAL(r[0][5], 0.5);
+	BOOST_CHECK_EQUAL(r[0][7], 0);
+	BOOST_CHECK_EQUAL(r[0][8], 1);
+	BOOST_CHECK_EQUAL(r[0][9], 0);
+
+	BOOST_CHECK_EQUAL(r[1][0], 2.0);
+	BOOST_CHECK_CLOSE(r[1][5], 1.5, 1e-9);
+	BOOST_CHECK_CLOSE(r[1][6], 0.25, 1e-9);
+	BOOST_CHECK_EQUAL(r[1][7], 1);
+	BOOST_CHECK_EQUAL(r[1][8], 2);
+
+	// forced output of the partial interval (2, 2.5]
+	BOOST_CHECK_EQUAL(r[2][0], 2.5);
+	BOOST_CHECK_EQUAL(r[2][5], 2);
+	BOOST_CHECK_EQUAL(r[2][6], 0);
+}
+
+BOOST_AUTO_TEST_CASE( long_gap_and_late_start )
+{
+	largenet::Graph g(1, 1);
+	g.addNode(0);
+	std::ostringstream s;
+	TimeAverageOutput out(s, g, 1.0);
+	// the first interval is only covered from 0.75 on
+	out.output(0.75);
+	g.addNode(0);
+	out.output(3.5);
+	const std::vector<std::vector<double> > r = parse(s.str());
+	BOOST_REQUIRE_EQUAL(r.size(), 3);
+	for (unsigned int i = 0; i < 3; ++i)
+	{
+		BOOST_CHECK_EQUAL(r[i][0], i + 1.0);
+		BOOST_CHECK_EQUAL(r[i][1], 1);
+		BOOST_CHECK_EQUAL(r[i][2], 0);
+	}
+	BOOST_CHECK_THROW(TimeAverageOutput(s, g, 0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,66 @@
+#include <boost/test/unit_test.hpp>
+
+#include <largenet2/sim/WorkerPool.h>
+#include <boost/bind.hpp>
+#include <vector>
+#include <stdexcept>
+
+namespace
+{
+
+/// Adds the sum of all workers' values to each worker's value
+struct Phases
+{
+	std::vector<int> values, sums;
+	sim::WorkerPool* pool;
+
+	void operator()(unsigned int w)
+	{
+		++values[w];
+		pool->barrier().wait();
+		int s = 0;
+		for (unsigned int i = 0; i < values.size(); ++i)
+			s += values[i];
+		sums[w] = s;
+	}
+};
+
+void failOn(unsigned int w, unsigned int bad)
+{
+	if (w == bad)
+		throw std::invalid_argument("bad worker");
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE( worker_pool )
+
+BOOST_AUTO_TEST_CASE( repeated_jobs_with_barrier )
+{
+	sim::WorkerPool pool(4);
+	BOOST_CHECK_EQUAL(pool.size(), 4);
+	Phases p;
+	p.values.assign(4, 0);
+	p.sums.assign(4, 0);
+	p.pool = &pool;
+	for (int k = 1; k <= 100; ++k)
+	{
+		pool.run(boost::ref(p));
+		for (unsigned int w = 0; w < 4; ++w)
+			BOOST_REQUIRE_EQUAL(p.sums[w], 4 * k);
+	}
+
+	BOOST_CHECK_THROW(pool.run(boost::bind(failOn, _1, 2)), std::runtime_error);
+	BOOST_CHECK_THROW(pool.run(boost::bind(failOn, _1, 0)), std::runtime_error);
+	pool.run(boost::bind(failOn, _1, 4));
+
+	sim::WorkerPool single(0);
+	BOOST_CHECK_EQUAL(single.size(), 1);
+	p.values.assign(1, 0);
+	p.sums.assign(1, 0);
+	p.pool = &single;
+	single.run(boost::ref(p));
+	BOOST_CHECK_EQUAL(p.sums[0], 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,41 @@
+#ifndef TEST_RNG_H_
+#define TEST_RNG_H_
+
+#include <cmath>
+
+/**
+ * Small deterministic random number generator for the simulation tests,
+ * providing the subset of the RandomVariates interface used by the steppers.
+ */
+class TestRng
+{
+public:
+	explicit TestRng(unsigned long long seed = 1) : state_(seed) {}
+	void seed(unsigned long s)
+	{
+		state_ = s;
+	}
+	double Uniform01()
+	{
+		// 64-bit LCG (Knuth's MMIX constants), upper 53 bits
+		state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+		return ((state_ >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+	}
+	double Exponential(double mean)
+	{
+		return -mean * std::log(Uniform01());
+	}
+	bool Chance(double p)
+	{
+		return Uniform01() <= p;
+	}
+	template<class T>
+	T IntFromTo(T from, T to)
+	{
+		return from + static_cast<T>((to - from + 1) * Uniform01());
+	}
+private:
+	unsigned long long state_;
+};
+
+#endif /* TEST_RNG_H_ */